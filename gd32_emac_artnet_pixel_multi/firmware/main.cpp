@@ -247,6 +247,7 @@ int main() {
 		remoteConfig.Run();
 		configStore.Flash();
 		pixelTestPattern.Run();
+		pixelDmxMulti.Run();
 		mDns.Run();
 #if defined (ENABLE_NTP_CLIENT)
 		ntpClient.Run();
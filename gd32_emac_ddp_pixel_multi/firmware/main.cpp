@@ -107,7 +107,7 @@ int main() {
 
 	const auto nActivePorts = pixelDmxConfiguration.GetOutputPorts();
 
-	ddpDisplay.SetCount(pixelDmxConfiguration.GetGroups(), pixelDmxConfiguration.GetLedsPerPixel(), nActivePorts);
+	ddpDisplay.SetCount(pixelDmxConfiguration.GetGroups(), pixelDmxConfiguration.GetChannelsPerPixel(), nActivePorts);
 
 	const auto nTestPattern = static_cast<pixelpatterns::Pattern>(pixelDmxParams.GetTestPattern());
 	PixelTestPattern pixelTestPattern(nTestPattern, nActivePorts);
@@ -188,6 +188,7 @@ int main() {
 		remoteConfig.Run();
 		configStore.Flash();
 		pixelTestPattern.Run();
+		pixelDmxMulti.Run();
 		mDns.Run();
 #if defined (ENABLE_NTP_CLIENT)
 		ntpClient.Run();
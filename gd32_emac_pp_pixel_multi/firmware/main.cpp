@@ -191,6 +191,7 @@ int main() {
 		remoteConfig.Run();
 		configStore.Flash();
 		pixelTestPattern.Run();
+		pixelDmxMulti.Run();
 		mDns.Run();
 #if defined (ENABLE_NTP_CLIENT)
 		ntpClient.Run();
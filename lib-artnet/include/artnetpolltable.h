@@ -39,6 +39,13 @@ static constexpr uint32_t POLL_INTERVAL_MILLIS = (POLL_INTERVAL_SECONDS * 1000U)
 static constexpr uint32_t POLL_TABLE_SIZE_ENRIES = 255;
 static constexpr uint32_t POLL_TABLE_SIZE_NODE_UNIVERSES = 64;
 static constexpr uint32_t POLL_TABLE_SIZE_UNIVERSES = 512;
+/*
+ * Open addressing hash from universe to m_pTableUniverses entry.
+ * Power of 2, at most half full.
+ */
+static constexpr uint32_t POLL_TABLE_UNIVERSES_HASH_SIZE = 1024;
+static_assert((POLL_TABLE_UNIVERSES_HASH_SIZE & (POLL_TABLE_UNIVERSES_HASH_SIZE - 1)) == 0);
+static_assert(POLL_TABLE_UNIVERSES_HASH_SIZE >= (2 * POLL_TABLE_SIZE_UNIVERSES));
 
 struct NodeEntryUniverse {
 	uint8_t ShortName[artnet::SHORT_NAME_LENGTH];
@@ -92,9 +99,17 @@ private:
 	void ProcessUniverse(const uint32_t nIpAddress, const uint16_t nUniverse);
 	void RemoveIpAddress(const uint16_t nUniverse, const uint32_t nIpAddress);
 
+	static uint32_t Hash(const uint16_t nUniverse) {
+		// Fibonacci hashing
+		return (nUniverse * 2654435769U) >> (32U - __builtin_ctz(artnet::POLL_TABLE_UNIVERSES_HASH_SIZE));
+	}
+	uint32_t FindSlot(const uint16_t nUniverse) const;
+	void RemoveSlot(uint32_t nSlot);
+
 private:
 	artnet::NodeEntry *m_pPollTable;
 	artnet::PollTableUniverses *m_pTableUniverses;
+	uint16_t *m_pUniverseIndex;	///< m_pTableUniverses entry + 1, 0 is an empty slot
 	uint32_t m_nPollTableEntries { 0 };
 	uint32_t m_nTableUniversesEntries { 0 };
 	artnet::PollTableClean m_PollTableClean;
@@ -68,6 +68,11 @@ ArtNetPollTable::ArtNetPollTable() {
 		assert(m_pTableUniverses[nIndex].pIpAddresses != nullptr);
 	}
 
+	m_pUniverseIndex = new uint16_t[artnet::POLL_TABLE_UNIVERSES_HASH_SIZE];
+	assert(m_pUniverseIndex != nullptr);
+
+	memset(m_pUniverseIndex, 0, sizeof(uint16_t[artnet::POLL_TABLE_UNIVERSES_HASH_SIZE]));
+
 	m_PollTableClean.nTableIndex = 0;
 	m_PollTableClean.nUniverseIndex = 0;
 	m_PollTableClean.bOffLine = true;
@@ -86,144 +91,161 @@ ArtNetPollTable::~ArtNetPollTable() {
 	delete[] m_pTableUniverses;
 	m_pTableUniverses = nullptr;
 
+	delete[] m_pUniverseIndex;
+	m_pUniverseIndex = nullptr;
+
 	delete[] m_pPollTable;
 	m_pPollTable = nullptr;
 }
 
-const struct artnet::PollTableUniverses *ArtNetPollTable::GetIpAddress(uint16_t nUniverse) const {
-	if (m_nTableUniversesEntries == 0) {
-		return nullptr;
-	}
-
-	// FIXME Universe lookup
-	for (uint32_t nEntry = 0; nEntry < m_nTableUniversesEntries; nEntry++) {
-		artnet::PollTableUniverses *pTableUniverses = &m_pTableUniverses[nEntry];
-		assert(pTableUniverses != nullptr);
+/**
+ * Linear probing, returns the slot of the universe or the empty slot where it can be inserted.
+ */
+uint32_t ArtNetPollTable::FindSlot(const uint16_t nUniverse) const {
+	auto nSlot = Hash(nUniverse);
 
-		if (pTableUniverses->nUniverse == nUniverse) {
-			return &m_pTableUniverses[nEntry];
+	while (m_pUniverseIndex[nSlot] != 0) {
+		if (m_pTableUniverses[m_pUniverseIndex[nSlot] - 1U].nUniverse == nUniverse) {
+			break;
 		}
+		nSlot = (nSlot + 1) & (artnet::POLL_TABLE_UNIVERSES_HASH_SIZE - 1);
 	}
 
-	return nullptr;
+	return nSlot;
 }
 
+/**
+ * Backward shift deletion, no tombstones are needed.
+ */
+void ArtNetPollTable::RemoveSlot(uint32_t nSlot) {
+	auto nNext = nSlot;
 
-void ArtNetPollTable::RemoveIpAddress(const uint16_t nUniverse, const uint32_t nIpAddress) {
-	if (m_nTableUniversesEntries == 0) {
-		return;
-	}
+	for (;;) {
+		nNext = (nNext + 1) & (artnet::POLL_TABLE_UNIVERSES_HASH_SIZE - 1);
 
-	uint32_t nEntry = 0;
+		if (m_pUniverseIndex[nNext] == 0) {
+			break;
+		}
 
-	// FIXME Universe lookup
-	for (nEntry = 0; nEntry < m_nTableUniversesEntries; nEntry++) {
-		artnet::PollTableUniverses *pTableUniverses = &m_pTableUniverses[nEntry];
-		assert(pTableUniverses != nullptr);
+		const auto nHome = Hash(m_pTableUniverses[m_pUniverseIndex[nNext] - 1U].nUniverse);
+		// Keep the entry when its home slot is cyclically in (nSlot, nNext]
+		const auto isInPlace = (nSlot <= nNext) ? ((nSlot < nHome) && (nHome <= nNext)) : ((nSlot < nHome) || (nHome <= nNext));
 
-		if (pTableUniverses->nUniverse == nUniverse) {
-			break;
+		if (!isInPlace) {
+			m_pUniverseIndex[nSlot] = m_pUniverseIndex[nNext];
+			nSlot = nNext;
 		}
 	}
 
-	if (nEntry == m_nTableUniversesEntries) {
+	m_pUniverseIndex[nSlot] = 0;
+}
+
+const struct artnet::PollTableUniverses *ArtNetPollTable::GetIpAddress(uint16_t nUniverse) const {
+	const auto nEntry = m_pUniverseIndex[FindSlot(nUniverse)];
+
+	if (nEntry == 0) {
+		return nullptr;
+	}
+
+	return &m_pTableUniverses[nEntry - 1U];
+}
+
+void ArtNetPollTable::RemoveIpAddress(const uint16_t nUniverse, const uint32_t nIpAddress) {
+	const auto nSlot = FindSlot(nUniverse);
+
+	if (m_pUniverseIndex[nSlot] == 0) {
 		// Universe not found
 		return;
 	}
 
-	artnet::PollTableUniverses *pTableUniverses = &m_pTableUniverses[nEntry];
+	const uint32_t nEntry = m_pUniverseIndex[nSlot] - 1U;
+	auto *pTableUniverses = &m_pTableUniverses[nEntry];
 	assert(pTableUniverses->nCount > 0);
 
 	uint32_t nIpAddressIndex = 0;
 
-	// FIXME IP lookup
 	for (nIpAddressIndex = 0; nIpAddressIndex < pTableUniverses->nCount; nIpAddressIndex++) {
 		if (pTableUniverses->pIpAddresses[nIpAddressIndex] == nIpAddress) {
 			break;
 		}
 	}
 
-	auto *p32 = pTableUniverses->pIpAddresses;
-	int32_t i;
-
-	for (i = static_cast<int32_t>(nIpAddressIndex); i < static_cast<int32_t>(pTableUniverses->nCount) - 1; i++) {
-		p32[i] = p32[i + 1];
+	if (nIpAddressIndex == pTableUniverses->nCount) {
+		// IP not found
+		return;
 	}
 
-	p32[i] = 0;
-
+	// The order of the IP addresses does not matter, the last one fills the hole
 	pTableUniverses->nCount--;
+	pTableUniverses->pIpAddresses[nIpAddressIndex] = pTableUniverses->pIpAddresses[pTableUniverses->nCount];
+	pTableUniverses->pIpAddresses[pTableUniverses->nCount] = 0;
 
 	if (pTableUniverses->nCount == 0) {
 		DEBUG_PRINTF("Delete Universe -> m_nTableUniversesEntries=%u, nEntry=%u", m_nTableUniversesEntries, nEntry);
 
-		artnet::PollTableUniverses *p = m_pTableUniverses;
+		RemoveSlot(nSlot);
 
-		for (i = static_cast<int32_t>(nEntry); i < static_cast<int32_t>(m_nTableUniversesEntries) - 1; i++) {
-			p[i].nUniverse = p[i + 1].nUniverse;
-			p[i].nCount = p[i + 1].nCount;
-			p[i].pIpAddresses = p[i + 1].pIpAddresses;
-		}
+		m_nTableUniversesEntries--;
 
-		p[i].nUniverse = 0;
-		p[i].nCount = 0;
+		if (nEntry != m_nTableUniversesEntries) {
+			// The last entry fills the hole, the IP address buffers are swapped
+			auto *pLast = &m_pTableUniverses[m_nTableUniversesEntries];
+			auto *pIpAddresses = pTableUniverses->pIpAddresses;
 
-		m_nTableUniversesEntries--;
+			pTableUniverses->nUniverse = pLast->nUniverse;
+			pTableUniverses->nCount = pLast->nCount;
+			pTableUniverses->pIpAddresses = pLast->pIpAddresses;
+
+			pLast->pIpAddresses = pIpAddresses;
+
+			m_pUniverseIndex[FindSlot(pTableUniverses->nUniverse)] = static_cast<uint16_t>(nEntry + 1U);
+		}
+
+		m_pTableUniverses[m_nTableUniversesEntries].nUniverse = 0;
+		m_pTableUniverses[m_nTableUniversesEntries].nCount = 0;
 	}
 }
 
 void ArtNetPollTable::ProcessUniverse(const uint32_t nIpAddress, const uint16_t nUniverse) {
 	DEBUG_ENTRY
 
-	if (artnet::POLL_TABLE_SIZE_UNIVERSES == m_nTableUniversesEntries) {
-		DEBUG_PUTS("m_pTableUniverses is full");
-		DEBUG_EXIT
-		return;
-	}
-
-	// FIXME Universe lookup
-	auto bFoundUniverse = false;
-	uint32_t nEntry = 0;
-
-	for (nEntry = 0; nEntry < m_nTableUniversesEntries; nEntry++) {
-		auto *pTableUniverses = &m_pTableUniverses[nEntry];
-		assert(pTableUniverses != nullptr);
+	const auto nSlot = FindSlot(nUniverse);
+	artnet::PollTableUniverses *pTableUniverses;
 
-		if (pTableUniverses->nUniverse == nUniverse) {
-			bFoundUniverse = true;
-			DEBUG_PRINTF("Universe found %u", nUniverse);
-			break;
-		}
-	}
+	if (m_pUniverseIndex[nSlot] != 0) {
+		DEBUG_PRINTF("Universe found %u", nUniverse);
 
-	auto *pTableUniverses = &m_pTableUniverses[nEntry];
-	auto bFoundIp = false;
-	uint32_t nCount = 0;
+		pTableUniverses = &m_pTableUniverses[m_pUniverseIndex[nSlot] - 1U];
 
-	if (bFoundUniverse) {
-		// FIXME IP lookup
-		for (nCount = 0; nCount < pTableUniverses->nCount; nCount++) {
+		for (uint32_t nCount = 0; nCount < pTableUniverses->nCount; nCount++) {
 			if (pTableUniverses->pIpAddresses[nCount] == nIpAddress) {
-				bFoundIp = true;
 				DEBUG_PUTS("IP found");
-				break;
+				DEBUG_EXIT
+				return;
 			}
 		}
 	} else {
+		if (artnet::POLL_TABLE_SIZE_UNIVERSES == m_nTableUniversesEntries) {
+			DEBUG_PUTS("m_pTableUniverses is full");
+			DEBUG_EXIT
+			return;
+		}
+
 		// New universe
+		pTableUniverses = &m_pTableUniverses[m_nTableUniversesEntries];
 		pTableUniverses->nUniverse = nUniverse;
+		pTableUniverses->nCount = 0;
 		m_nTableUniversesEntries++;
+		m_pUniverseIndex[nSlot] = static_cast<uint16_t>(m_nTableUniversesEntries);
 		DEBUG_PRINTF("New Universe %d", static_cast<int>(nUniverse));
 	}
 
-	if (!bFoundIp) {
-		if (pTableUniverses->nCount < artnet::POLL_TABLE_SIZE_ENRIES) {
-			pTableUniverses->pIpAddresses[pTableUniverses->nCount] = nIpAddress;
-			pTableUniverses->nCount++;
-			DEBUG_PUTS("It is a new IP for the Universe");
-		} else {
-			DEBUG_PUTS("New IP does not fit");
-		}
+	if (pTableUniverses->nCount < artnet::POLL_TABLE_SIZE_ENRIES) {
+		pTableUniverses->pIpAddresses[pTableUniverses->nCount] = nIpAddress;
+		pTableUniverses->nCount++;
+		DEBUG_PUTS("It is a new IP for the Universe");
+	} else {
+		DEBUG_PUTS("New IP does not fit");
 	}
 
 	DEBUG_EXIT
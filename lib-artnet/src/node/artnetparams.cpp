@@ -54,6 +54,7 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertieskeys.h"
 
 #include "propertiesbuilder.h"
 
@@ -73,6 +74,81 @@ static constexpr bool is_set(const uint16_t nValue, const uint32_t i) {
 	return (nValue & static_cast<uint16_t>(1U << (i + 8))) == static_cast<uint16_t>(1U << (i + 8));
 }
 #endif
+
+enum class Key: uint8_t {
+	ENABLE_RDM,
+	UNIVERSE_PORT,
+	DIRECTION,
+	MERGE_MODE_PORT,
+	NODE_LABEL,
+	OUTPUT_STYLE,
+	FAILSAFE,
+	NODE_LONG_NAME,
+	PROTOCOL_PORT,
+	DESTINATION_IP_PORT,
+	PRIORITY,
+	RDM_ENABLE_PORT,
+	MAP_UNIVERSE0,
+	DISABLE_MERGE_TIMEOUT
+};
+
+static_assert(artnet::PORTS == 4, "KEYS has 4 entries per port key");
+
+static constexpr properties::Key KEYS[] = {
+#if defined (RDM_CONTROLLER)
+	{ ArtNetParamsConst::ENABLE_RDM, static_cast<uint8_t>(Key::ENABLE_RDM), 0 },
+#endif
+	{ LightSetParamsConst::UNIVERSE_PORT[0], static_cast<uint8_t>(Key::UNIVERSE_PORT), 0 },
+	{ LightSetParamsConst::UNIVERSE_PORT[1], static_cast<uint8_t>(Key::UNIVERSE_PORT), 1 },
+	{ LightSetParamsConst::UNIVERSE_PORT[2], static_cast<uint8_t>(Key::UNIVERSE_PORT), 2 },
+	{ LightSetParamsConst::UNIVERSE_PORT[3], static_cast<uint8_t>(Key::UNIVERSE_PORT), 3 },
+	{ LightSetParamsConst::DIRECTION[0], static_cast<uint8_t>(Key::DIRECTION), 0 },
+	{ LightSetParamsConst::DIRECTION[1], static_cast<uint8_t>(Key::DIRECTION), 1 },
+	{ LightSetParamsConst::DIRECTION[2], static_cast<uint8_t>(Key::DIRECTION), 2 },
+	{ LightSetParamsConst::DIRECTION[3], static_cast<uint8_t>(Key::DIRECTION), 3 },
+	{ LightSetParamsConst::MERGE_MODE_PORT[0], static_cast<uint8_t>(Key::MERGE_MODE_PORT), 0 },
+	{ LightSetParamsConst::MERGE_MODE_PORT[1], static_cast<uint8_t>(Key::MERGE_MODE_PORT), 1 },
+	{ LightSetParamsConst::MERGE_MODE_PORT[2], static_cast<uint8_t>(Key::MERGE_MODE_PORT), 2 },
+	{ LightSetParamsConst::MERGE_MODE_PORT[3], static_cast<uint8_t>(Key::MERGE_MODE_PORT), 3 },
+	{ LightSetParamsConst::NODE_LABEL[0], static_cast<uint8_t>(Key::NODE_LABEL), 0 },
+	{ LightSetParamsConst::NODE_LABEL[1], static_cast<uint8_t>(Key::NODE_LABEL), 1 },
+	{ LightSetParamsConst::NODE_LABEL[2], static_cast<uint8_t>(Key::NODE_LABEL), 2 },
+	{ LightSetParamsConst::NODE_LABEL[3], static_cast<uint8_t>(Key::NODE_LABEL), 3 },
+#if defined (OUTPUT_HAVE_STYLESWITCH)
+	{ LightSetParamsConst::OUTPUT_STYLE[0], static_cast<uint8_t>(Key::OUTPUT_STYLE), 0 },
+	{ LightSetParamsConst::OUTPUT_STYLE[1], static_cast<uint8_t>(Key::OUTPUT_STYLE), 1 },
+	{ LightSetParamsConst::OUTPUT_STYLE[2], static_cast<uint8_t>(Key::OUTPUT_STYLE), 2 },
+	{ LightSetParamsConst::OUTPUT_STYLE[3], static_cast<uint8_t>(Key::OUTPUT_STYLE), 3 },
+#endif
+	{ LightSetParamsConst::FAILSAFE, static_cast<uint8_t>(Key::FAILSAFE), 0 },
+	{ LightSetParamsConst::NODE_LONG_NAME, static_cast<uint8_t>(Key::NODE_LONG_NAME), 0 },
+	{ ArtNetParamsConst::PROTOCOL_PORT[0], static_cast<uint8_t>(Key::PROTOCOL_PORT), 0 },
+	{ ArtNetParamsConst::PROTOCOL_PORT[1], static_cast<uint8_t>(Key::PROTOCOL_PORT), 1 },
+	{ ArtNetParamsConst::PROTOCOL_PORT[2], static_cast<uint8_t>(Key::PROTOCOL_PORT), 2 },
+	{ ArtNetParamsConst::PROTOCOL_PORT[3], static_cast<uint8_t>(Key::PROTOCOL_PORT), 3 },
+#if defined (ARTNET_HAVE_DMXIN)
+	{ ArtNetParamsConst::DESTINATION_IP_PORT[0], static_cast<uint8_t>(Key::DESTINATION_IP_PORT), 0 },
+	{ ArtNetParamsConst::DESTINATION_IP_PORT[1], static_cast<uint8_t>(Key::DESTINATION_IP_PORT), 1 },
+	{ ArtNetParamsConst::DESTINATION_IP_PORT[2], static_cast<uint8_t>(Key::DESTINATION_IP_PORT), 2 },
+	{ ArtNetParamsConst::DESTINATION_IP_PORT[3], static_cast<uint8_t>(Key::DESTINATION_IP_PORT), 3 },
+#endif
+#if defined (E131_HAVE_DMXIN)
+	{ LightSetParamsConst::PRIORITY[0], static_cast<uint8_t>(Key::PRIORITY), 0 },
+	{ LightSetParamsConst::PRIORITY[1], static_cast<uint8_t>(Key::PRIORITY), 1 },
+	{ LightSetParamsConst::PRIORITY[2], static_cast<uint8_t>(Key::PRIORITY), 2 },
+	{ LightSetParamsConst::PRIORITY[3], static_cast<uint8_t>(Key::PRIORITY), 3 },
+#endif
+#if defined (RDM_CONTROLLER)
+	{ ArtNetParamsConst::RDM_ENABLE_PORT[0], static_cast<uint8_t>(Key::RDM_ENABLE_PORT), 0 },
+	{ ArtNetParamsConst::RDM_ENABLE_PORT[1], static_cast<uint8_t>(Key::RDM_ENABLE_PORT), 1 },
+	{ ArtNetParamsConst::RDM_ENABLE_PORT[2], static_cast<uint8_t>(Key::RDM_ENABLE_PORT), 2 },
+	{ ArtNetParamsConst::RDM_ENABLE_PORT[3], static_cast<uint8_t>(Key::RDM_ENABLE_PORT), 3 },
+#endif
+	{ ArtNetParamsConst::MAP_UNIVERSE0, static_cast<uint8_t>(Key::MAP_UNIVERSE0), 0 },
+	{ LightSetParamsConst::DISABLE_MERGE_TIMEOUT, static_cast<uint8_t>(Key::DISABLE_MERGE_TIMEOUT), 0 }
+};
+
+static properties::KeyTable s_Keys(KEYS);
 }  // namespace artnetparams
 
 using namespace artnetparams;
@@ -151,24 +227,32 @@ void ArtNetParams::SetBool(const uint8_t nValue, const uint32_t nMask) {
 void ArtNetParams::callbackFunction(const char *pLine) {
 	assert(pLine != nullptr);
 
+	const auto *pKey = s_Keys.Find(pLine);
+
+	if (pKey == nullptr) {
+		return;
+	}
+
+	const auto *pName = pKey->pName;
+	const uint32_t nPortIndex = pKey->nPort;
 	char aValue[artnet::LONG_NAME_LENGTH];
 	uint8_t nValue8;
+	uint16_t nValue16;
+	uint32_t nLength;
 
+	switch (static_cast<artnetparams::Key>(pKey->nId)) {
 #if defined (RDM_CONTROLLER)
-	if (Sscan::Uint8(pLine, ArtNetParamsConst::ENABLE_RDM, nValue8) == Sscan::OK) {
-		SetBool(nValue8, Mask::ENABLE_RDM);
-		return;
-	}
+	case artnetparams::Key::ENABLE_RDM:
+		if (Sscan::Uint8(pLine, pName, nValue8) == Sscan::OK) {
+			SetBool(nValue8, Mask::ENABLE_RDM);
+		}
+		break;
 #endif
-
 	/*
 	 * Node
 	 */
-
-	for (uint32_t nPortIndex = 0; nPortIndex < artnet::PORTS; nPortIndex++) {
-		uint16_t nValue16;
-
-		if (Sscan::Uint16(pLine, LightSetParamsConst::UNIVERSE_PORT[nPortIndex], nValue16) == Sscan::OK) {
+	case artnetparams::Key::UNIVERSE_PORT:
+		if (Sscan::Uint16(pLine, pName, nValue16) == Sscan::OK) {
 			if (nValue16 != 0) {
 				m_Params.nUniverse[nPortIndex] = nValue16;
 				if (nValue16 != static_cast<uint16_t>(nPortIndex + 1)) {
@@ -177,12 +261,12 @@ void ArtNetParams::callbackFunction(const char *pLine) {
 					m_Params.nSetList &= ~(Mask::UNIVERSE_A << nPortIndex);
 				}
 			}
-			return;
 		}
+		break;
+	case artnetparams::Key::DIRECTION:
+		nLength = 7;
 
-		uint32_t nLength = 7;
-
-		if (Sscan::Char(pLine, LightSetParamsConst::DIRECTION[nPortIndex], aValue, nLength) == Sscan::OK) {
+		if (Sscan::Char(pLine, pName, aValue, nLength) == Sscan::OK) {
 			const auto portDir = lightset::get_direction(aValue);
 
 			m_Params.nDirection &= artnetparams::portdir_clear(nPortIndex);
@@ -197,21 +281,20 @@ void ArtNetParams::callbackFunction(const char *pLine) {
 			} else {
 				m_Params.nDirection |= portdir_set(nPortIndex, lightset::PortDir::OUTPUT);
 			}
-
-			return;
 		}
-
+		break;
+	case artnetparams::Key::MERGE_MODE_PORT:
 		nLength = 3;
 
-		if (Sscan::Char(pLine, LightSetParamsConst::MERGE_MODE_PORT[nPortIndex], aValue, nLength) == Sscan::OK) {
+		if (Sscan::Char(pLine, pName, aValue, nLength) == Sscan::OK) {
 			m_Params.nMergeMode &= artnetparams::mergemode_clear(nPortIndex);
 			m_Params.nMergeMode |= mergemode_set(nPortIndex, lightset::get_merge_mode(aValue));
-			return;
 		}
-
+		break;
+	case artnetparams::Key::NODE_LABEL:
 		nLength = artnet::SHORT_NAME_LENGTH - 1;
 
-		if (Sscan::Char(pLine, LightSetParamsConst::NODE_LABEL[nPortIndex], reinterpret_cast<char*>(m_Params.aLabel[nPortIndex]), nLength) == Sscan::OK) {
+		if (Sscan::Char(pLine, pName, reinterpret_cast<char*>(m_Params.aLabel[nPortIndex]), nLength) == Sscan::OK) {
 			m_Params.aLabel[nPortIndex][nLength] = '\0';
 			static_assert(sizeof(aValue) >= artnet::SHORT_NAME_LENGTH, "");
 			lightset::node::get_short_name_default(nPortIndex, aValue);
@@ -221,13 +304,13 @@ void ArtNetParams::callbackFunction(const char *pLine) {
 			} else {
 				m_Params.nSetList |= (Mask::LABEL_A << nPortIndex);
 			}
-			return;
 		}
-
+		break;
 #if defined (OUTPUT_HAVE_STYLESWITCH)
+	case artnetparams::Key::OUTPUT_STYLE:
 		nLength = 6;
 
-		if (Sscan::Char(pLine, LightSetParamsConst::OUTPUT_STYLE[nPortIndex], aValue, nLength) == Sscan::OK) {
+		if (Sscan::Char(pLine, pName, aValue, nLength) == Sscan::OK) {
 			const auto nOutputStyle = lightset::get_output_style(aValue);
 
 			if (nOutputStyle != lightset::OutputStyle::DELTA) {
@@ -235,58 +318,54 @@ void ArtNetParams::callbackFunction(const char *pLine) {
 			} else {
 				m_Params.nOutputStyle &= static_cast<uint8_t>(~(1U << nPortIndex));
 			}
-
-			return;
 		}
+		break;
 #endif
-	}
+	case artnetparams::Key::FAILSAFE:
+		nLength = 8;
 
-	uint32_t nLength = 8;
+		if (Sscan::Char(pLine, pName, aValue, nLength) == Sscan::OK) {
+			const auto failsafe = lightset::get_failsafe(aValue);
 
-	if (Sscan::Char(pLine, LightSetParamsConst::FAILSAFE, aValue, nLength) == Sscan::OK) {
-		const auto failsafe = lightset::get_failsafe(aValue);
+			if (failsafe == lightset::FailSafe::HOLD) {
+				m_Params.nSetList &= ~Mask::FAILSAFE;
+			} else {
+				m_Params.nSetList |= Mask::FAILSAFE;
+			}
 
-		if (failsafe == lightset::FailSafe::HOLD) {
-			m_Params.nSetList &= ~Mask::FAILSAFE;
-		} else {
-			m_Params.nSetList |= Mask::FAILSAFE;
+			m_Params.nFailSafe = static_cast<uint8_t>(failsafe);
 		}
-
-		m_Params.nFailSafe = static_cast<uint8_t>(failsafe);
-		return;
-	}
-
-	nLength = artnet::LONG_NAME_LENGTH - 1;
-
-	if (Sscan::Char(pLine, LightSetParamsConst::NODE_LONG_NAME, reinterpret_cast<char*>(m_Params.aLongName), nLength) == Sscan::OK) {
-		m_Params.aLongName[nLength] = '\0';
-		static_assert(sizeof(aValue) >= artnet::LONG_NAME_LENGTH, "");
-		ArtNetNode::Get()->GetLongNameDefault(aValue);
-		if (strcmp(reinterpret_cast<char*>(m_Params.aLongName), aValue) == 0) {
-			m_Params.nSetList &= ~Mask::LONG_NAME;
-		} else {
-			m_Params.nSetList |= Mask::LONG_NAME;
+		break;
+	case artnetparams::Key::NODE_LONG_NAME:
+		nLength = artnet::LONG_NAME_LENGTH - 1;
+
+		if (Sscan::Char(pLine, pName, reinterpret_cast<char*>(m_Params.aLongName), nLength) == Sscan::OK) {
+			m_Params.aLongName[nLength] = '\0';
+			static_assert(sizeof(aValue) >= artnet::LONG_NAME_LENGTH, "");
+			ArtNetNode::Get()->GetLongNameDefault(aValue);
+			if (strcmp(reinterpret_cast<char*>(m_Params.aLongName), aValue) == 0) {
+				m_Params.nSetList &= ~Mask::LONG_NAME;
+			} else {
+				m_Params.nSetList |= Mask::LONG_NAME;
+			}
 		}
-		return;
-	}
-
+		break;
 	/*
 	 * Art-Net
 	 */
+	case artnetparams::Key::PROTOCOL_PORT:
+		nLength = 4;
 
-	for (uint32_t nPortIndex = 0; nPortIndex < artnet::PORTS; nPortIndex++) {
-		uint32_t nLength = 4;
-
-		if (Sscan::Char(pLine, ArtNetParamsConst::PROTOCOL_PORT[nPortIndex], aValue, nLength) == Sscan::OK) {
+		if (Sscan::Char(pLine, pName, aValue, nLength) == Sscan::OK) {
 			m_Params.nProtocol &= artnetparams::protocol_clear(nPortIndex);
 			m_Params.nProtocol |= protocol_set(nPortIndex, artnet::get_protocol_mode(aValue));
-			return;
 		}
-
+		break;
 #if defined (ARTNET_HAVE_DMXIN)
+	case artnetparams::Key::DESTINATION_IP_PORT: {
 		uint32_t nValue32;
 
-		if (Sscan::IpAddress(pLine, ArtNetParamsConst::DESTINATION_IP_PORT[nPortIndex], nValue32) == Sscan::OK) {
+		if (Sscan::IpAddress(pLine, pName, nValue32) == Sscan::OK) {
 			m_Params.nDestinationIp[nPortIndex] = nValue32;
 
 			if (nValue32 != 0) {
@@ -294,50 +373,50 @@ void ArtNetParams::callbackFunction(const char *pLine) {
 			} else {
 				m_Params.nSetList &= ~(Mask::DESTINATION_IP_A << nPortIndex);
 			}
-			return;
 		}
+	}
+		break;
 #endif
-
 #if defined (E131_HAVE_DMXIN)
-		uint8_t value8;
-
-		if (Sscan::Uint8(pLine, LightSetParamsConst::PRIORITY[nPortIndex], value8) == Sscan::OK) {
-			if ((value8 >= e131::priority::LOWEST) && (value8 <= e131::priority::HIGHEST) && (value8 != e131::priority::DEFAULT)) {
-				m_Params.nPriority[nPortIndex] = value8;
+	case artnetparams::Key::PRIORITY:
+		if (Sscan::Uint8(pLine, pName, nValue8) == Sscan::OK) {
+			if ((nValue8 >= e131::priority::LOWEST) && (nValue8 <= e131::priority::HIGHEST) && (nValue8 != e131::priority::DEFAULT)) {
+				m_Params.nPriority[nPortIndex] = nValue8;
 				m_Params.nSetList |= (Mask::PRIORITY_A << nPortIndex);
 			} else {
 				m_Params.nPriority[nPortIndex] = e131::priority::DEFAULT;
 				m_Params.nSetList &= ~(Mask::PRIORITY_A << nPortIndex);
 			}
-			return;
 		}
+		break;
 #endif
-
 #if defined (RDM_CONTROLLER)
-		if (Sscan::Uint8(pLine, ArtNetParamsConst::RDM_ENABLE_PORT[nPortIndex], nValue8) == Sscan::OK) {
+	case artnetparams::Key::RDM_ENABLE_PORT:
+		if (Sscan::Uint8(pLine, pName, nValue8) == Sscan::OK) {
 			m_Params.nRdm &= artnetparams::clear_mask(nPortIndex);
 
 			if (nValue8 != 0) {
 				m_Params.nRdm |= artnetparams::shift_left(1, nPortIndex);
 				m_Params.nRdm |= static_cast<uint16_t>(1U << (nPortIndex + 8));
 			}
-			return;
 		}
+		break;
 #endif
-	}
-
-	if (Sscan::Uint8(pLine, ArtNetParamsConst::MAP_UNIVERSE0, nValue8) == Sscan::OK) {
-		SetBool(nValue8, Mask::MAP_UNIVERSE0);
-		return;
-	}
-
+	case artnetparams::Key::MAP_UNIVERSE0:
+		if (Sscan::Uint8(pLine, pName, nValue8) == Sscan::OK) {
+			SetBool(nValue8, Mask::MAP_UNIVERSE0);
+		}
+		break;
 	/**
 	 * Extra's
 	 */
-
-	if (Sscan::Uint8(pLine, LightSetParamsConst::DISABLE_MERGE_TIMEOUT, nValue8) == Sscan::OK) {
-		SetBool(nValue8, Mask::DISABLE_MERGE_TIMEOUT);
-		return;
+	case artnetparams::Key::DISABLE_MERGE_TIMEOUT:
+		if (Sscan::Uint8(pLine, pName, nValue8) == Sscan::OK) {
+			SetBool(nValue8, Mask::DISABLE_MERGE_TIMEOUT);
+		}
+		break;
+	default:
+		break;
 	}
 }
 
@@ -0,0 +1,164 @@
+/**
+ * @file test_artnetpolltable.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+
+#include "artnetpolltable.h"
+#include "hardware.h"
+
+static int s_nFailed;
+
+#define CHECK(x)	do { if (!(x)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #x); s_nFailed++; } } while (0)
+
+static constexpr uint32_t NODES = 170;
+static constexpr uint32_t BASES = 128;	///< Node i and node i + BASES share their universes
+
+// The universe table is full, so the hash is half full and has clusters
+static_assert((BASES * artnet::PORTS) == artnet::POLL_TABLE_SIZE_UNIVERSES);
+
+static std::map<uint16_t, std::set<uint32_t>> s_Model;
+
+static uint32_t ip_address(const uint32_t nNode) {
+	const uint8_t ip[4] = { 10, 0, static_cast<uint8_t>(nNode >> 8), static_cast<uint8_t>(nNode) };
+	uint32_t nIpAddress;
+	memcpy(&nIpAddress, ip, sizeof(nIpAddress));
+	return nIpAddress;
+}
+
+static uint32_t base(const uint32_t nNode) {
+	return ((nNode % BASES) * 37U) % 2048U;	// Net and Sub-Net
+}
+
+static void add(ArtNetPollTable& pollTable, const uint32_t nNode) {
+	artnet::ArtPollReply reply;
+	memset(&reply, 0, sizeof(reply));
+
+	const auto nIpAddress = ip_address(nNode);
+	memcpy(reply.IPAddress, &nIpAddress, 4);
+	reply.NetSwitch = static_cast<uint8_t>(base(nNode) >> 4);
+	reply.SubSwitch = static_cast<uint8_t>(base(nNode) & 0x0F);
+	reply.BindIndex = 1;
+
+	for (uint32_t nPort = 0; nPort < artnet::PORTS; nPort++) {
+		reply.PortTypes[nPort] = static_cast<uint8_t>(artnet::PortType::OUTPUT_ARTNET);
+		reply.SwOut[nPort] = static_cast<uint8_t>(nPort);
+		s_Model[artnet::make_port_address(reply.NetSwitch, reply.SubSwitch, nPort)].insert(nIpAddress);
+	}
+
+	pollTable.Add(&reply);
+}
+
+static void compare(const ArtNetPollTable& pollTable) {
+	for (uint32_t nUniverse = 0; nUniverse < 0x8000; nUniverse++) {
+		const auto *pTableUniverses = pollTable.GetIpAddress(static_cast<uint16_t>(nUniverse));
+		const auto it = s_Model.find(static_cast<uint16_t>(nUniverse));
+
+		if (it == s_Model.end()) {
+			CHECK(pTableUniverses == nullptr);
+			continue;
+		}
+
+		CHECK(pTableUniverses != nullptr);
+
+		if (pTableUniverses == nullptr) {
+			continue;
+		}
+
+		CHECK(pTableUniverses->nUniverse == nUniverse);
+		CHECK(pTableUniverses->nCount == it->second.size());
+
+		std::set<uint32_t> ipAddresses(pTableUniverses->pIpAddresses, pTableUniverses->pIpAddresses + pTableUniverses->nCount);
+		CHECK(ipAddresses == it->second);
+	}
+}
+
+int main() {
+	ArtNetPollTable pollTable;
+
+	Hardware::s_nMillis = 1000;
+
+	for (uint32_t nNode = 0; nNode < NODES; nNode++) {
+		add(pollTable, nNode);
+	}
+
+	CHECK(pollTable.GetPollTableEntries() == NODES);
+	CHECK(s_Model.size() == (BASES * artnet::PORTS));
+	compare(pollTable);
+
+	// A reply that is seen again changes nothing
+	add(pollTable, 7);
+	compare(pollTable);
+
+	/*
+	 * The odd nodes stop replying. Their universes time out,
+	 * the universes shared with an even node keep that node.
+	 */
+	Hardware::s_nMillis += 2 * artnet::POLL_INTERVAL_MILLIS;
+
+	s_Model.clear();
+
+	for (uint32_t nNode = 0; nNode < NODES; nNode += 2) {
+		add(pollTable, nNode);
+	}
+
+	for (uint32_t i = 0; i < (NODES * artnet::POLL_TABLE_SIZE_NODE_UNIVERSES); i++) {
+		pollTable.Clean();
+	}
+
+	CHECK(pollTable.GetPollTableEntries() == (NODES / 2));
+	compare(pollTable);
+
+	// All nodes time out
+	Hardware::s_nMillis += 2 * artnet::POLL_INTERVAL_MILLIS;
+
+	s_Model.clear();
+
+	for (uint32_t i = 0; i < (NODES * artnet::POLL_TABLE_SIZE_NODE_UNIVERSES); i++) {
+		pollTable.Clean();
+	}
+
+	CHECK(pollTable.GetPollTableEntries() == 0);
+	compare(pollTable);
+
+	// And come back
+	for (uint32_t nNode = 0; nNode < NODES; nNode++) {
+		add(pollTable, nNode);
+	}
+
+	compare(pollTable);
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return EXIT_FAILURE;
+	}
+
+	puts("artnetpolltable: passed");
+	return EXIT_SUCCESS;
+}
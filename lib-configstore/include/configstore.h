@@ -65,6 +65,7 @@ enum class Store {
 	RGBPANEL,
 	NODE,
 	PCA9685,
+	WS28XXDMX_PORTS,
 	LAST
 };
 
@@ -148,6 +149,25 @@ public:
 		return p->nUtcOffset;
 	}
 
+	void SetEnvDhcpLease(const uint32_t nIp, const uint32_t nNetmask, const uint32_t nGatewayIp) {
+		auto *p = reinterpret_cast<struct Env *>(&s_SpiFlashData[FlashStore::SIGNATURE_SIZE]);
+
+		if ((p->nDhcpLeaseIp != nIp) || (p->nDhcpLeaseNetmask != nNetmask) || (p->nDhcpLeaseGatewayIp != nGatewayIp)) {
+			p->nDhcpLeaseIp = nIp;
+			p->nDhcpLeaseNetmask = nNetmask;
+			p->nDhcpLeaseGatewayIp = nGatewayIp;
+			s_State = configstore::State::CHANGED;
+		}
+	}
+
+	void GetEnvDhcpLease(uint32_t& nIp, uint32_t& nNetmask, uint32_t& nGatewayIp) const {
+		const auto *p = reinterpret_cast<struct Env *>(&s_SpiFlashData[FlashStore::SIGNATURE_SIZE]);
+
+		nIp = p->nDhcpLeaseIp;
+		nNetmask = p->nDhcpLeaseNetmask;
+		nGatewayIp = p->nDhcpLeaseGatewayIp;
+	}
+
 	static ConfigStore *Get() {
 		return s_pThis;
 	}
@@ -158,7 +178,9 @@ private:
 private:
 	struct Env {
 		int32_t nUtcOffset;
-		uint8_t filler[12];
+		uint32_t nDhcpLeaseIp;		///< Last address bound by DHCP, used for INIT-REBOOT
+		uint32_t nDhcpLeaseNetmask;
+		uint32_t nDhcpLeaseGatewayIp;
 	};
 
 	struct FlashStore {
@@ -60,6 +60,15 @@ namespace dmx {
 }  // namespace dmx
 static constexpr uint32_t MAX_PORTS = configuration::pixel::MAX_PORTS + configuration::dmx::MAX_PORTS;
 }  // namespace configuration
+
+/**
+ * A contiguous range of the DDP data space that maps onto one lightset port.
+ */
+struct Segment {
+	uint32_t nOffset;			///< First DDP byte offset
+	uint32_t nEnd;				///< One past the last DDP byte offset
+	uint32_t nLightSetPortIndex;
+};
 }  // namespace ddpdisplay
 
 static_assert(ddpdisplay::lightset::MAX_PORTS == ddpdisplay::configuration::dmx::MAX_PORTS + ddpdisplay::configuration::pixel::MAX_PORTS * 4, "Configuration errror");
@@ -79,7 +88,7 @@ public:
 	void SetCount(uint32_t nCount, uint32_t nChannelsPerPixel, uint32_t nActivePorts) {
 		m_nCount = nCount;
 		m_nStripDataLength = nCount * nChannelsPerPixel;
-		m_nLightSetDataMaxLength = (nChannelsPerPixel == 4 ? 512U : 510U);
+		m_nLightSetDataMaxLength = (512U / nChannelsPerPixel) * nChannelsPerPixel;
 		m_nActivePorts = std::min(nActivePorts, ddpdisplay::configuration::pixel::MAX_PORTS);
 	}
 
@@ -104,7 +113,7 @@ public:
 	}
 
 private:
-	void CalculateOffsets();
+	void CalculateSegments();
 	void HandleQuery();
 	void HandleData();
 
@@ -121,8 +130,8 @@ private:
 
 	ddp::Packet m_Packet;
 
-	static uint32_t s_nLightsetPortLength[ddpdisplay::lightset::MAX_PORTS];
-	static uint32_t s_nOffsetCompare[ddpdisplay::configuration::MAX_PORTS];
+	static ddpdisplay::Segment s_Segments[ddpdisplay::lightset::MAX_PORTS];
+	static uint32_t s_nSegments;
 
 	static DdpDisplay *s_pThis;
 };
@@ -74,8 +74,8 @@ static constexpr auto START = sizeof(json::START) - 1U;
 }  // namespace size
 }  // namespace json
 
-uint32_t DdpDisplay::s_nLightsetPortLength[ddpdisplay::lightset::MAX_PORTS];
-uint32_t DdpDisplay::s_nOffsetCompare[ddpdisplay::configuration::MAX_PORTS];
+ddpdisplay::Segment DdpDisplay::s_Segments[ddpdisplay::lightset::MAX_PORTS];
+uint32_t DdpDisplay::s_nSegments;
 DdpDisplay *DdpDisplay::s_pThis;
 
 DdpDisplay::DdpDisplay() {
@@ -96,14 +96,29 @@ DdpDisplay::~DdpDisplay() {
 	DEBUG_EXIT
 }
 
-void DdpDisplay::CalculateOffsets() {
-	uint32_t nSum = 0;
-
-	for (uint32_t nPixelPortIndex = 0; nPixelPortIndex < ddpdisplay::configuration::pixel::MAX_PORTS; nPixelPortIndex++) {
-		nSum = nSum + m_nStripDataLength;
-		s_nOffsetCompare[nPixelPortIndex] = nSum;
+/**
+ * The DDP data space is the pixel strips back to back, each strip split
+ * over up to 4 lightset ports, followed by the DMX ports. The segments are
+ * in increasing offset order, inactive strips leave a gap.
+ */
+void DdpDisplay::CalculateSegments() {
+	s_nSegments = 0;
+
+	for (uint32_t nPixelPortIndex = 0; nPixelPortIndex < m_nActivePorts; nPixelPortIndex++) {
+		auto nOffset = nPixelPortIndex * m_nStripDataLength;
+		const auto nStripEnd = nOffset + m_nStripDataLength;
+
+		for (uint32_t nUniverse = 0; (nUniverse < 4) && (nOffset < nStripEnd); nUniverse++) {
+			auto& segment = s_Segments[s_nSegments++];
+			segment.nOffset = nOffset;
+			segment.nEnd = std::min(nOffset + m_nLightSetDataMaxLength, nStripEnd);
+			segment.nLightSetPortIndex = (nPixelPortIndex * 4) + nUniverse;
+			nOffset = segment.nEnd;
+		}
 	}
 
+	auto nOffset = ddpdisplay::configuration::pixel::MAX_PORTS * m_nStripDataLength;
+
 /*
   error: comparison of unsigned expression < 0 is always false [-Werror=type-limits]
   for (uint32_t nDmxPortIndex = 0; nDmxPortIndex < ddpdisplay::configuration::dmx::MAX_PORTS; nDmxPortIndex++) {
@@ -115,15 +130,18 @@ void DdpDisplay::CalculateOffsets() {
 #endif
 
 	for (uint32_t nDmxPortIndex = 0; nDmxPortIndex < ddpdisplay::configuration::dmx::MAX_PORTS; nDmxPortIndex++) {
-		nSum = nSum + lightset::dmx::UNIVERSE_SIZE;
-		const auto nIndexOffset = nDmxPortIndex + ddpdisplay::configuration::pixel::MAX_PORTS;
-		s_nOffsetCompare[nIndexOffset] = nSum;
+		auto& segment = s_Segments[s_nSegments++];
+		segment.nOffset = nOffset;
+		segment.nEnd = nOffset + lightset::dmx::UNIVERSE_SIZE;
+		segment.nLightSetPortIndex = ddpdisplay::lightset::MAX_PORTS - ddpdisplay::configuration::dmx::MAX_PORTS + nDmxPortIndex;
+		nOffset = segment.nEnd;
 	}
 
 #if __GNUC__ < 10
 # pragma GCC diagnostic pop
 #endif
 
+	assert(s_nSegments <= ddpdisplay::lightset::MAX_PORTS);
 }
 
 void DdpDisplay::Start() {
@@ -143,7 +161,7 @@ void DdpDisplay::Start() {
 
 	debug_dump(&m_Packet, HEADER_LEN + json::size::START);
 
-	CalculateOffsets();
+	CalculateSegments();
 	DEBUG_EXIT
 }
 
@@ -214,6 +232,12 @@ void DdpDisplay::HandleQuery() {
 	DEBUG_EXIT
 }
 
+/**
+ * The packet is scattered by its byte offset: the first segment is found
+ * with a binary search, then each part is written straight to its slot
+ * position in the lightset port. A packet can start anywhere and span
+ * any number of segments, so packets may arrive in any order.
+ */
 void DdpDisplay::HandleData() {
 	auto nOffset = static_cast<uint32_t>(
 			  (m_Packet.header.offset[0] << 24)
@@ -221,62 +245,44 @@ void DdpDisplay::HandleData() {
 			| (m_Packet.header.offset[2] << 8)
 			|  m_Packet.header.offset[3]);
 
-	auto nLength = ((static_cast<uint32_t>(m_Packet.header.len[0]) << 8) | m_Packet.header.len[1]);
-	const auto *receiveBuffer = m_Packet.data;
-
-//	DEBUG_PRINTF("nOffset=%u, nLength=%u, s_nOffsetCompare[0]=%u", nOffset, nLength, s_nOffsetCompare[0]);
-
-	uint32_t nLightSetPortIndex = 0;
-	uint32_t nReceiverBufferIndex = 0;
+	auto nLength = std::min(((static_cast<uint32_t>(m_Packet.header.len[0]) << 8) | m_Packet.header.len[1]), static_cast<uint32_t>(sizeof(m_Packet.data)));
+	const auto *pData = m_Packet.data;
 
-	for (uint32_t nPortIndex = 0; (nPortIndex < m_nActivePorts) && (nLength != 0); nPortIndex++) {
-		nLightSetPortIndex = nPortIndex * 4;
+	uint32_t nLow = 0;
+	uint32_t nHigh = s_nSegments;
 
-		const auto nLightSetPortIndexEnd = nLightSetPortIndex + 4;
+	while (nLow < nHigh) {
+		const auto nMiddle = (nLow + nHigh) / 2;
 
-//		DEBUG_PRINTF("nOffset=%u, nLength=%u, s_nOffsetCompare[%u]=%u", nOffset, nLength, nPortIndex, s_nOffsetCompare[nPortIndex]);
-
-		while ((nOffset < s_nOffsetCompare[nPortIndex]) && (nLightSetPortIndex < nLightSetPortIndexEnd)) {
-			const auto nLightSetLength = std::min(std::min(nLength, m_nLightSetDataMaxLength), m_nStripDataLength);
-
-//			DEBUG_PRINTF("==> nOffset=%u, nLength=%u, nLightSetLength=%u, nLightSetPortIndex=%u", nOffset, nLength, nLightSetLength, nLightSetPortIndex);
-
-			lightset::Data::SetSourceA(nLightSetPortIndex, &receiveBuffer[nReceiverBufferIndex], nLightSetLength);
-			s_nLightsetPortLength[nLightSetPortIndex] = nLightSetLength;
-
-			nReceiverBufferIndex += nLightSetLength;
-			nOffset += nLightSetLength;
-			nLength -= nLightSetLength;
-			nLightSetPortIndex++;
-
-//			DEBUG_PRINTF("nOffset=%u, nLength=%u, nLightSetLength=%u, nLightSetPortIndex=%u", nOffset, nLength, nLightSetLength, nLightSetPortIndex);
+		if (s_Segments[nMiddle].nEnd <= nOffset) {
+			nLow = nMiddle + 1;
+		} else {
+			nHigh = nMiddle;
 		}
 	}
 
-	/*
-	 * 2x DMX ports
-	 */
-
-	nLightSetPortIndex = ddpdisplay::lightset::MAX_PORTS - ddpdisplay::configuration::dmx::MAX_PORTS;
+	for (auto nIndex = nLow; (nIndex < s_nSegments) && (nLength != 0); nIndex++) {
+		const auto& segment = s_Segments[nIndex];
 
-	DEBUG_PRINTF("nLightSetPortIndex=%u", nLightSetPortIndex);
+		if (nOffset < segment.nOffset) {
+			const auto nSkip = segment.nOffset - nOffset;
 
-	for (uint32_t nPortIndex = ddpdisplay::configuration::pixel::MAX_PORTS; (nPortIndex < ddpdisplay::configuration::MAX_PORTS) && (nLength != 0); nPortIndex++) {
-		if (nOffset < s_nOffsetCompare[nPortIndex]) {
-			const auto nLightSetLength = std::min(nLength,lightset::dmx::UNIVERSE_SIZE);
+			if (nSkip >= nLength) {
+				break;
+			}
 
-//			DEBUG_PRINTF("==> nPortIndex=%u, nOffset=%u, nLength=%u, nLightSetLength=%u, nLightSetPortIndex=%u", nPortIndex, nOffset, nLength, nLightSetLength, nLightSetPortIndex);
+			pData += nSkip;
+			nOffset += nSkip;
+			nLength -= nSkip;
+		}
 
-			lightset::Data::SetSourceA(nLightSetPortIndex, &receiveBuffer[nReceiverBufferIndex], nLightSetLength);
-			s_nLightsetPortLength[nLightSetPortIndex] = nLightSetLength;
+		const auto nPart = std::min(nLength, segment.nEnd - nOffset);
 
-			nReceiverBufferIndex += nLightSetLength;
-			nOffset += nLightSetLength;
-			nLength -= nLightSetLength;
-			nLightSetPortIndex++;
+		lightset::Data::SetSourceA(segment.nLightSetPortIndex, nOffset - segment.nOffset, pData, nPart);
 
-//			DEBUG_PRINTF("nPortIndex=%u, nOffset=%u, nLength=%u, nLightSetLength=%u, nLightSetPortIndex=%u", nPortIndex, nOffset, nLength, nLightSetLength, nLightSetPortIndex);
-		}
+		pData += nPart;
+		nOffset += nPart;
+		nLength -= nPart;
 	}
 
 	if ((m_Packet.header.flags1 & flags1::PUSH) == flags1::PUSH) {
@@ -38,12 +38,16 @@
  * @tparam K
  * A compile-time constant that determines the weight of the EMA.
  * Higher K values mean a slower response to changes in the input, making the EMA smoother.
+ *
+ * @tparam T
+ * The type of the internal state. The state holds the input scaled by (2^K - 1),
+ * use uint32_t when the input can exceed the 16 - K bits.
  */
 
-template<uint8_t K>
+template<uint8_t K, typename T = uint16_t>
 class EMA {
 public:
-	EMA(uint16_t nIntitial = 0) : nState(static_cast<uint16_t>(nIntitial << K) - nIntitial) {}
+	EMA(uint16_t nIntitial = 0) : nState(static_cast<T>(static_cast<T>(static_cast<T>(nIntitial) << K) - nIntitial)) {}
 
 	/**
 	 * @brief
@@ -53,13 +57,13 @@ public:
 	 * @param nValue
 	 */
 	void Reset(const uint16_t nValue = 0) {
-		nState = static_cast<uint16_t>(nValue << K) - nValue;
+		nState = static_cast<T>(static_cast<T>(static_cast<T>(nValue) << K) - nValue);
 	}
 
 	uint16_t Filter(const uint16_t nInput) {
-		nState += nInput;
+		nState = static_cast<T>(nState + nInput);
 		const auto nOutput = static_cast<uint16_t>((nState + nHalf) >> K);
-		nState -= nOutput;
+		nState = static_cast<T>(nState - nOutput);
 		return nOutput;
 	}
 
@@ -71,7 +75,7 @@ public:
 	static constexpr uint16_t nHalf = K > 0 ? 1 << (K - 1) : 0;
 
 private:
-	uint16_t nState;
+	T nState;
 };
 
 #endif /* EMA_H_ */
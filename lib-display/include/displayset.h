@@ -72,6 +72,9 @@ public:
 
 	virtual void PrintInfo() {}
 
+	virtual void Run() {}
+	virtual void Flush() {}
+
 protected:
 	uint32_t m_nCols;
 	uint32_t m_nRows;
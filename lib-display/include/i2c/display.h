@@ -301,7 +301,22 @@ public:
 		return m_bIsSleep;
 	}
 
+	/**
+	 * Blocks until a display with deferred updates has written all pending changes.
+	 */
+	void Flush() {
+		if (m_LcdDisplay == nullptr) {
+			return;
+		}
+
+		m_LcdDisplay->Flush();
+	}
+
 	void Run() {
+		if (m_LcdDisplay != nullptr) {
+			m_LcdDisplay->Run();
+		}
+
 		if (m_nSleepTimeout == 0) {
 			return;
 		}
@@ -34,6 +34,12 @@
 
 #define OLED_I2C_SLAVE_ADDRESS_DEFAULT	0x3C
 
+#if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+# if !defined(CONFIG_DISPLAY_SSD1306_ASYNC_CELLS)
+#  define CONFIG_DISPLAY_SSD1306_ASYNC_CELLS	4	///< Characters written per Run(), 4 -> 31 bytes, ~0.8ms @ 400kHz
+# endif
+#endif
+
 enum TOledPanel {
 	OLED_PANEL_128x64_8ROWS,	///< Default
 	OLED_PANEL_128x64_4ROWS,
@@ -46,7 +52,7 @@ public:
 	Ssd1306 (TOledPanel);
 	Ssd1306 (uint8_t, TOledPanel);
 	~Ssd1306() override {
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
+#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY) || defined(CONFIG_DISPLAY_SSD1306_ASYNC)
 		delete[] m_pShadowRam;
 		m_pShadowRam = nullptr;
 #endif
@@ -73,6 +79,11 @@ public:
 
 	void PrintInfo() override;
 
+#if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+	void Run() override;
+	void Flush() override;
+#endif
+
 	bool IsSH1106() {
 		return m_bHaveSH1106;
 	}
@@ -86,6 +97,14 @@ private:
 	void InitMembers();
 	void SendCommand(uint8_t);
 	void SendData(const uint8_t *pData, uint32_t nLength);
+	void ClearGddram();
+#if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+	void SetCell(uint32_t nIndex, char c);
+	void MarkDirty(uint32_t nColumn, uint32_t nRow);
+	bool IsDirty() const;
+	void Update();
+	void Write();
+#endif
 
 	void SetCursorOn();
 	void SetCursorOff();
@@ -99,10 +118,14 @@ private:
 	TOledPanel m_OledPanel { OLED_PANEL_128x64_8ROWS };
 	bool m_bHaveSH1106 { false };
 	uint32_t m_nPages;
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
+#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY) || defined(CONFIG_DISPLAY_SSD1306_ASYNC)
 	char *m_pShadowRam { nullptr };
 	uint32_t m_nShadowRamIndex { 0 };
 #endif
+#if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+	uint32_t m_nDirty[8];	///< One bit for each character, one entry for each row
+	bool m_bAsync { false };	///< Set by the first Run() from the main loop
+#endif
 #if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
 	uint32_t m_nCursorMode { display::cursor::OFF };
 	uint8_t m_nCursorOnChar;
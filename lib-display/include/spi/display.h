@@ -226,6 +226,9 @@ public:
 		return m_bIsFlippedVertically;
 	}
 
+	void Flush() {
+	}
+
 	void Run() {
 		if (m_nSleepTimeout == 0) {
 			return;
@@ -296,13 +296,16 @@ bool Ssd1306::Start() {
 
 	CheckSH1106();
 
+#if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+	ClearGddram();
+#endif
 	Ssd1306::Cls();
 
 	SendCommand(cmd::DISPLAY_ON);
 	return true;
 }
 
-void Ssd1306::Cls() {
+void Ssd1306::ClearGddram() {
 	uint32_t nColumnAdd = 0;
 
 	if (m_bHaveSH1106) {
@@ -319,30 +322,55 @@ void Ssd1306::Cls() {
 	SendCommand(cmd::SET_LOWCOLUMN | (nColumnAdd & 0XF));
 	SendCommand(static_cast<uint8_t>(cmd::SET_HIGHCOLUMN | (nColumnAdd)));
 	SendCommand(cmd::SET_STARTPAGE);
+}
+
+void Ssd1306::Cls() {
+#if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+	for (uint32_t i = 0; i < oled::font8x6::COLS * m_nRows; i++) {
+		SetCell(i, ' ');
+	}
 
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)|| defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
+	m_nShadowRamIndex = 0;
+	Update();
+#else
+	ClearGddram();
+
+# if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
 	m_nShadowRamIndex = 0;
 	memset(m_pShadowRam, ' ', oled::font8x6::COLS * m_nRows);
+# endif
 #endif
 }
 
 void Ssd1306::PutChar(int c) {
+#if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+	if (c < 32 || c > 127) {
+		c = 32;
+	}
+
+	if (m_nShadowRamIndex < oled::font8x6::COLS * m_nRows) {
+		SetCell(m_nShadowRamIndex, static_cast<char>(c));
+	}
+	m_nShadowRamIndex++;
+	Update();
+#else
 	int i;
 
 	if (c < 32 || c > 127) {
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
+# if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
 		c = 32;
-#endif
+# endif
 		i = 0;
 	} else {
 		i = c - 32;
 	}
 
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
+# if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
 	m_pShadowRam[m_nShadowRamIndex++] = static_cast<char>(c);
-#endif
+# endif
 	const uint8_t *base = _OledFont8x6 + (oled::font8x6::CHAR_W + 1) * i;
 	SendData(base, oled::font8x6::CHAR_W + 1);
+#endif
 }
 
 void Ssd1306::PutString(const char *pString) {
@@ -370,8 +398,15 @@ void Ssd1306::ClearLine(uint32_t nLine) {
 	}
 
 	Ssd1306::SetCursorPos(0, static_cast<uint8_t>(nLine - 1));
+#if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+	for (uint32_t i = 0; i < oled::font8x6::COLS; i++) {
+		SetCell(m_nShadowRamIndex + i, ' ');
+	}
+	Update();
+#else
 	SendData(reinterpret_cast<const uint8_t*>(&_ClearBuffer), SSD1306_LCD_WIDTH + 1);
 	Ssd1306::SetCursorPos(0, static_cast<uint8_t>(nLine - 1));
+#endif
 
 #if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
 	memset(&m_pShadowRam[m_nShadowRamIndex], ' ', oled::font8x6::COLS);
@@ -416,15 +451,18 @@ void Ssd1306::SetCursorPos(uint32_t nCol, uint32_t nRow) {
 
 	nCol = static_cast<uint8_t>(nCol * oled::font8x6::CHAR_W);
 
+#if !defined(CONFIG_DISPLAY_SSD1306_ASYNC)
 	if (m_bHaveSH1106) {
 		nCol = static_cast<uint8_t>(nCol + 4);
 	}
 
+
 	SendCommand(cmd::SET_LOWCOLUMN | (nCol & 0XF));
 	SendCommand(static_cast<uint8_t>(cmd::SET_HIGHCOLUMN | (nCol >> 4)));
 	SendCommand(static_cast<uint8_t>(cmd::SET_STARTPAGE | nRow));
+#endif
 
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
+#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY) || defined(CONFIG_DISPLAY_SSD1306_ASYNC)
 	m_nShadowRamIndex = static_cast<uint16_t>((nRow * oled::font8x6::COLS) + (nCol / oled::font8x6::CHAR_W));
 #endif
 #if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
@@ -460,7 +498,12 @@ void Ssd1306::SetFlipVertically(bool doFlipVertically) {
 		SendCommand(cmd::COMSCAN_DEC);
 	}
 
-#if defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
+#if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+	for (uint32_t i = 0; i < m_nRows; i++) {
+		m_nDirty[i] = (1U << oled::font8x6::COLS) - 1;
+	}
+	Update();
+#elif defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
 	for (uint32_t i = 0; i < m_nRows; i++) {
 		Ssd1306::SetCursorPos(0, static_cast<uint8_t>(i));
 		for (uint32_t j = 0; j < oled::font8x6::COLS; j++) {
@@ -491,11 +534,14 @@ void Ssd1306::InitMembers() {
 
 	m_nPages = (m_OledPanel == OLED_PANEL_128x64_8ROWS ? 8 : 4);
 
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
+#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY) || defined(CONFIG_DISPLAY_SSD1306_ASYNC)
 	m_pShadowRam = new char[oled::font8x6::COLS * m_nRows];
 	assert(m_pShadowRam != nullptr);
 	memset(m_pShadowRam, ' ', oled::font8x6::COLS * m_nRows);
 #endif
+#if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+	memset(m_nDirty, 0, sizeof(m_nDirty));
+#endif
 }
 
 void Ssd1306::SendCommand(uint8_t nCmd) {
@@ -546,6 +592,10 @@ void Ssd1306::SetCursorOn() {
 	m_nCursorOnRow =  static_cast<uint8_t>(m_nShadowRamIndex / oled::font8x6::COLS);
 	m_nCursorOnChar = static_cast<uint8_t>(m_pShadowRam[m_nShadowRamIndex] - 32);
 
+# if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+	MarkDirty(m_nCursorOnCol, m_nCursorOnRow);
+	Update();
+# else
 	const auto *pBase = const_cast<uint8_t *>(_OledFont8x6) + 1 + (oled::font8x6::CHAR_W + 1) * m_nCursorOnChar;
 
 	uint8_t data[oled::font8x6::CHAR_W + 1];
@@ -558,6 +608,7 @@ void Ssd1306::SetCursorOn() {
 
 	SendData(data, oled::font8x6::CHAR_W + 1);
 	SetColumnRow(m_nCursorOnCol, m_nCursorOnRow);
+# endif
 #endif
 }
 
@@ -567,6 +618,10 @@ void Ssd1306::SetCursorBlinkOn() {
 	m_nCursorOnRow =  static_cast<uint8_t>(m_nShadowRamIndex / oled::font8x6::COLS);
 	m_nCursorOnChar = static_cast<uint8_t>(m_pShadowRam[m_nShadowRamIndex] - 32);
 
+# if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+	MarkDirty(m_nCursorOnCol, m_nCursorOnRow);
+	Update();
+# else
 	const uint8_t *pBase = const_cast<uint8_t *>(_OledFont8x6) + 1 + (oled::font8x6::CHAR_W + 1) * m_nCursorOnChar;
 
 	uint8_t data[oled::font8x6::CHAR_W + 1];
@@ -579,11 +634,16 @@ void Ssd1306::SetCursorBlinkOn() {
 
 	SendData(data, static_cast<uint32_t>(oled::font8x6::CHAR_W + 1));
 	SetColumnRow(m_nCursorOnCol, m_nCursorOnRow);
+# endif
 #endif
 }
 
 void Ssd1306::SetCursorOff() {
 #if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
+# if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+	MarkDirty(m_nCursorOnCol, m_nCursorOnRow);
+	Update();
+# else
 	const auto nCol = static_cast<uint8_t>(m_nShadowRamIndex % oled::font8x6::COLS);
 	const auto nRow = static_cast<uint8_t>(m_nShadowRamIndex / oled::font8x6::COLS);
 
@@ -593,11 +653,12 @@ void Ssd1306::SetCursorOff() {
 
 	SendData(pBase, (oled::font8x6::CHAR_W + 1));
 	SetColumnRow(nCol, nRow);
+# endif
 #endif
 }
 
-void Ssd1306::SetColumnRow(UNUSED uint8_t nColumn, UNUSED uint8_t nRow) {
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
+void Ssd1306::SetColumnRow([[maybe_unused]] uint8_t nColumn, [[maybe_unused]] uint8_t nRow) {
+#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_SSD1306_ASYNC)
 	auto nColumnAdd = static_cast<uint8_t>(nColumn * oled::font8x6::CHAR_W);
 
 	if (m_bHaveSH1106) {
@@ -611,7 +672,7 @@ void Ssd1306::SetColumnRow(UNUSED uint8_t nColumn, UNUSED uint8_t nRow) {
 }
 
 void Ssd1306::DumpShadowRam() {
-#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
+#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY) || defined(CONFIG_DISPLAY_SSD1306_ASYNC)
 #ifndef NDEBUG
 	for (uint32_t i = 0; i < m_nRows; i++) {
 		printf("%d: [%.*s]\n", i, oled::font8x6::COLS, &m_pShadowRam[i * oled::font8x6::COLS]);
@@ -619,3 +680,95 @@ void Ssd1306::DumpShadowRam() {
 #endif
 #endif
 }
+
+/**
+ * Deferred updates: the text functions only change the shadow RAM and mark
+ * the changed characters. Run() writes at most CONFIG_DISPLAY_SSD1306_ASYNC_CELLS
+ * adjacent characters of one row for each call.
+ * Until the first Run(), i.e. during the blocking initialization before the main loop,
+ * the changes are written immediately.
+ */
+
+#if defined(CONFIG_DISPLAY_SSD1306_ASYNC)
+void Ssd1306::SetCell(uint32_t nIndex, char c) {
+	if (m_pShadowRam[nIndex] != c) {
+		m_pShadowRam[nIndex] = c;
+		m_nDirty[nIndex / oled::font8x6::COLS] |= (1U << (nIndex % oled::font8x6::COLS));
+	}
+}
+
+void Ssd1306::MarkDirty(uint32_t nColumn, uint32_t nRow) {
+	if ((nColumn < oled::font8x6::COLS) && (nRow < m_nRows)) {
+		m_nDirty[nRow] |= (1U << nColumn);
+	}
+}
+
+bool Ssd1306::IsDirty() const {
+	for (uint32_t nRow = 0; nRow < m_nRows; nRow++) {
+		if (m_nDirty[nRow] != 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Ssd1306::Update() {
+	if (!m_bAsync) {
+		Flush();
+	}
+}
+
+void Ssd1306::Run() {
+	m_bAsync = true;
+	Write();
+}
+
+void Ssd1306::Write() {
+	for (uint32_t nRow = 0; nRow < m_nRows; nRow++) {
+		const auto nDirty = m_nDirty[nRow];
+
+		if (__builtin_expect((nDirty == 0), 1)) {
+			continue;
+		}
+
+		const auto nColumn = static_cast<uint32_t>(__builtin_ctz(nDirty));
+
+		uint8_t data[1 + CONFIG_DISPLAY_SSD1306_ASYNC_CELLS * oled::font8x6::CHAR_W];
+		data[0] = mode::DATA;
+
+		auto *pDst = &data[1];
+		uint32_t nCells = 0;
+
+		while ((nCells < CONFIG_DISPLAY_SSD1306_ASYNC_CELLS) && ((nColumn + nCells) < oled::font8x6::COLS) && ((nDirty & (1U << (nColumn + nCells))) != 0)) {
+			const auto nIndex = nRow * oled::font8x6::COLS + nColumn + nCells;
+			const auto *pBase = _OledFont8x6 + 1 + (oled::font8x6::CHAR_W + 1) * static_cast<uint32_t>(m_pShadowRam[nIndex] - 32);
+
+			memcpy(pDst, pBase, oled::font8x6::CHAR_W);
+
+#if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)
+			if ((m_nCursorMode != display::cursor::OFF) && (nRow == m_nCursorOnRow) && ((nColumn + nCells) == m_nCursorOnCol)) {
+				for (uint32_t i = 0; i < oled::font8x6::CHAR_W; i++) {
+					pDst[i] = (m_nCursorMode & display::cursor::BLINK_ON) ? static_cast<uint8_t>(~pDst[i]) : static_cast<uint8_t>(pDst[i] | 0x80);
+				}
+			}
+#endif
+			pDst += oled::font8x6::CHAR_W;
+			nCells++;
+		}
+
+		m_nDirty[nRow] &= ~(((1U << nCells) - 1) << nColumn);
+
+		SetColumnRow(static_cast<uint8_t>(nColumn), static_cast<uint8_t>(nRow));
+		SendData(data, 1 + nCells * oled::font8x6::CHAR_W);
+
+		return;
+	}
+}
+
+void Ssd1306::Flush() {
+	while (IsDirty()) {
+		Write();
+	}
+}
+#endif
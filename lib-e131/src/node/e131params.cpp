@@ -40,6 +40,7 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertieskeys.h"
 
 #include "propertiesbuilder.h"
 
@@ -64,6 +65,54 @@ static constexpr uint16_t portdir_shift_left(const lightset::PortDir portDir, co
 static constexpr uint16_t portdir_clear(const uint32_t i) {
 	return static_cast<uint16_t>(~(0x3 << (i * 2)));
 }
+
+enum class Key: uint8_t {
+	FAILSAFE,
+	UNIVERSE_PORT,
+	MERGE_MODE_PORT,
+	NODE_LABEL,
+	DIRECTION,
+	PRIORITY,
+	OUTPUT_STYLE,
+	DISABLE_MERGE_TIMEOUT
+};
+
+static_assert(e131params::MAX_PORTS == 4, "KEYS has 4 entries per port key");
+
+static constexpr properties::Key KEYS[] = {
+	{ LightSetParamsConst::FAILSAFE, static_cast<uint8_t>(Key::FAILSAFE), 0 },
+	{ LightSetParamsConst::UNIVERSE_PORT[0], static_cast<uint8_t>(Key::UNIVERSE_PORT), 0 },
+	{ LightSetParamsConst::UNIVERSE_PORT[1], static_cast<uint8_t>(Key::UNIVERSE_PORT), 1 },
+	{ LightSetParamsConst::UNIVERSE_PORT[2], static_cast<uint8_t>(Key::UNIVERSE_PORT), 2 },
+	{ LightSetParamsConst::UNIVERSE_PORT[3], static_cast<uint8_t>(Key::UNIVERSE_PORT), 3 },
+	{ LightSetParamsConst::MERGE_MODE_PORT[0], static_cast<uint8_t>(Key::MERGE_MODE_PORT), 0 },
+	{ LightSetParamsConst::MERGE_MODE_PORT[1], static_cast<uint8_t>(Key::MERGE_MODE_PORT), 1 },
+	{ LightSetParamsConst::MERGE_MODE_PORT[2], static_cast<uint8_t>(Key::MERGE_MODE_PORT), 2 },
+	{ LightSetParamsConst::MERGE_MODE_PORT[3], static_cast<uint8_t>(Key::MERGE_MODE_PORT), 3 },
+	{ LightSetParamsConst::NODE_LABEL[0], static_cast<uint8_t>(Key::NODE_LABEL), 0 },
+	{ LightSetParamsConst::NODE_LABEL[1], static_cast<uint8_t>(Key::NODE_LABEL), 1 },
+	{ LightSetParamsConst::NODE_LABEL[2], static_cast<uint8_t>(Key::NODE_LABEL), 2 },
+	{ LightSetParamsConst::NODE_LABEL[3], static_cast<uint8_t>(Key::NODE_LABEL), 3 },
+	{ LightSetParamsConst::DIRECTION[0], static_cast<uint8_t>(Key::DIRECTION), 0 },
+	{ LightSetParamsConst::DIRECTION[1], static_cast<uint8_t>(Key::DIRECTION), 1 },
+	{ LightSetParamsConst::DIRECTION[2], static_cast<uint8_t>(Key::DIRECTION), 2 },
+	{ LightSetParamsConst::DIRECTION[3], static_cast<uint8_t>(Key::DIRECTION), 3 },
+#if defined (E131_HAVE_DMXIN)
+	{ E131ParamsConst::PRIORITY[0], static_cast<uint8_t>(Key::PRIORITY), 0 },
+	{ E131ParamsConst::PRIORITY[1], static_cast<uint8_t>(Key::PRIORITY), 1 },
+	{ E131ParamsConst::PRIORITY[2], static_cast<uint8_t>(Key::PRIORITY), 2 },
+	{ E131ParamsConst::PRIORITY[3], static_cast<uint8_t>(Key::PRIORITY), 3 },
+#endif
+#if defined (OUTPUT_HAVE_STYLESWITCH)
+	{ LightSetParamsConst::OUTPUT_STYLE[0], static_cast<uint8_t>(Key::OUTPUT_STYLE), 0 },
+	{ LightSetParamsConst::OUTPUT_STYLE[1], static_cast<uint8_t>(Key::OUTPUT_STYLE), 1 },
+	{ LightSetParamsConst::OUTPUT_STYLE[2], static_cast<uint8_t>(Key::OUTPUT_STYLE), 2 },
+	{ LightSetParamsConst::OUTPUT_STYLE[3], static_cast<uint8_t>(Key::OUTPUT_STYLE), 3 },
+#endif
+	{ LightSetParamsConst::DISABLE_MERGE_TIMEOUT, static_cast<uint8_t>(Key::DISABLE_MERGE_TIMEOUT), 0 }
+};
+
+static properties::KeyTable s_Keys(KEYS);
 }  // namespace e131params
 
 using namespace e131params;
@@ -133,27 +182,37 @@ void E131Params::Load(const char* pBuffer, uint32_t nLength) {
 void E131Params::callbackFunction(const char *pLine) {
 	assert(pLine != nullptr);
 
+	const auto *pKey = s_Keys.Find(pLine);
+
+	if (pKey == nullptr) {
+		return;
+	}
+
+	const auto *pName = pKey->pName;
+	const uint32_t nPortIndex = pKey->nPort;
 	uint8_t value8;
 	uint16_t value16;
 	char aValue[lightset::node::LABEL_NAME_LENGTH];
+	uint32_t nLength;
 
-	uint32_t nLength = 8;
+	switch (static_cast<e131params::Key>(pKey->nId)) {
+	case e131params::Key::FAILSAFE:
+		nLength = 8;
 
-	if (Sscan::Char(pLine, LightSetParamsConst::FAILSAFE, aValue, nLength) == Sscan::OK) {
-		const auto failsafe = lightset::get_failsafe(aValue);
-
-		if (failsafe == lightset::FailSafe::HOLD) {
-			m_Params.nSetList &= ~Mask::FAILSAFE;
-		} else {
-			m_Params.nSetList |= Mask::FAILSAFE;
-		}
+		if (Sscan::Char(pLine, pName, aValue, nLength) == Sscan::OK) {
+			const auto failsafe = lightset::get_failsafe(aValue);
 
-		m_Params.nFailSafe = static_cast<uint8_t>(failsafe);
-		return;
-	}
+			if (failsafe == lightset::FailSafe::HOLD) {
+				m_Params.nSetList &= ~Mask::FAILSAFE;
+			} else {
+				m_Params.nSetList |= Mask::FAILSAFE;
+			}
 
-	for (uint32_t nPortIndex = 0; nPortIndex < e131params::MAX_PORTS; nPortIndex++) {
-		if (Sscan::Uint16(pLine, LightSetParamsConst::UNIVERSE_PORT[nPortIndex], value16) == Sscan::OK) {
+			m_Params.nFailSafe = static_cast<uint8_t>(failsafe);
+		}
+		break;
+	case e131params::Key::UNIVERSE_PORT:
+		if (Sscan::Uint16(pLine, pName, value16) == Sscan::OK) {
 			if ((value16 == 0) || (value16 > e131::universe::MAX)) {
 				m_Params.nUniverse[nPortIndex] = static_cast<uint16_t>(nPortIndex + 1);
 				m_Params.nSetList &= ~(Mask::UNIVERSE_A << nPortIndex);
@@ -161,20 +220,20 @@ void E131Params::callbackFunction(const char *pLine) {
 				m_Params.nUniverse[nPortIndex] = value16;
 				m_Params.nSetList |= (Mask::UNIVERSE_A << nPortIndex);
 			}
-			return;
 		}
-
+		break;
+	case e131params::Key::MERGE_MODE_PORT:
 		nLength = 3;
 
-		if (Sscan::Char(pLine, LightSetParamsConst::MERGE_MODE_PORT[nPortIndex], aValue, nLength) == Sscan::OK) {
+		if (Sscan::Char(pLine, pName, aValue, nLength) == Sscan::OK) {
 			m_Params.nMergeMode &= e131params::mergemode_clear(nPortIndex);
 			m_Params.nMergeMode |= mergemode_set(nPortIndex, lightset::get_merge_mode(aValue));
-			return;
 		}
-
+		break;
+	case e131params::Key::NODE_LABEL:
 		nLength = lightset::node::LABEL_NAME_LENGTH - 1;
 
-		if (Sscan::Char(pLine, LightSetParamsConst::NODE_LABEL[nPortIndex], reinterpret_cast<char*>(m_Params.aLabel[nPortIndex]), nLength) == Sscan::OK) {
+		if (Sscan::Char(pLine, pName, reinterpret_cast<char*>(m_Params.aLabel[nPortIndex]), nLength) == Sscan::OK) {
 			m_Params.aLabel[nPortIndex][nLength] = '\0';
 			static_assert(sizeof(aValue) >= lightset::node::LABEL_NAME_LENGTH, "");
 			lightset::node::get_short_name_default(nPortIndex, aValue);
@@ -184,12 +243,12 @@ void E131Params::callbackFunction(const char *pLine) {
 			} else {
 				m_Params.nSetList |= (Mask::LABEL_A << nPortIndex);
 			}
-			return;
 		}
-
+		break;
+	case e131params::Key::DIRECTION:
 		nLength = 7;
 
-		if (Sscan::Char(pLine, LightSetParamsConst::DIRECTION[nPortIndex], aValue, nLength) == Sscan::OK) {
+		if (Sscan::Char(pLine, pName, aValue, nLength) == Sscan::OK) {
 			const auto portDir = lightset::get_direction(aValue);
 			m_Params.nDirection &= e131params::portdir_clear(nPortIndex);
 
@@ -207,12 +266,11 @@ void E131Params::callbackFunction(const char *pLine) {
 			}
 
 			DEBUG_PRINTF("m_Params.nDirection=%x", m_Params.nDirection);
-
-			return;
 		}
-
+		break;
 #if defined (E131_HAVE_DMXIN)
-		if (Sscan::Uint8(pLine, E131ParamsConst::PRIORITY[nPortIndex], value8) == Sscan::OK) {
+	case e131params::Key::PRIORITY:
+		if (Sscan::Uint8(pLine, pName, value8) == Sscan::OK) {
 			if ((value8 >= e131::priority::LOWEST) && (value8 <= e131::priority::HIGHEST) && (value8 != e131::priority::DEFAULT)) {
 				m_Params.nPriority[nPortIndex] = value8;
 				m_Params.nSetList |= (Mask::PRIORITY_A << nPortIndex);
@@ -220,14 +278,14 @@ void E131Params::callbackFunction(const char *pLine) {
 				m_Params.nPriority[nPortIndex] = e131::priority::DEFAULT;
 				m_Params.nSetList &= ~(Mask::PRIORITY_A << nPortIndex);
 			}
-			return;
 		}
+		break;
 #endif
-
 #if defined (OUTPUT_HAVE_STYLESWITCH)
+	case e131params::Key::OUTPUT_STYLE:
 		nLength = 6;
 
-		if (Sscan::Char(pLine, LightSetParamsConst::OUTPUT_STYLE[nPortIndex], aValue, nLength) == Sscan::OK) {
+		if (Sscan::Char(pLine, pName, aValue, nLength) == Sscan::OK) {
 			const auto nOutputStyle = static_cast<uint32_t>(lightset::get_output_style(aValue));
 
 			if (nOutputStyle != 0) {
@@ -235,19 +293,20 @@ void E131Params::callbackFunction(const char *pLine) {
 			} else {
 				m_Params.nOutputStyle &= static_cast<uint8_t>(~(1U << nPortIndex));
 			}
-
-			return;
 		}
+		break;
 #endif
-	}
-
-	if (Sscan::Uint8(pLine, LightSetParamsConst::DISABLE_MERGE_TIMEOUT, value8) == Sscan::OK) {
-		if (value8 != 0) {
-			m_Params.nSetList |= Mask::DISABLE_MERGE_TIMEOUT;
-		} else {
-			m_Params.nSetList &= ~Mask::DISABLE_MERGE_TIMEOUT;
+	case e131params::Key::DISABLE_MERGE_TIMEOUT:
+		if (Sscan::Uint8(pLine, pName, value8) == Sscan::OK) {
+			if (value8 != 0) {
+				m_Params.nSetList |= Mask::DISABLE_MERGE_TIMEOUT;
+			} else {
+				m_Params.nSetList &= ~Mask::DISABLE_MERGE_TIMEOUT;
+			}
 		}
-		return;
+		break;
+	default:
+		break;
 	}
 }
 
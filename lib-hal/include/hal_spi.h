@@ -47,6 +47,17 @@
 
 class HAL_SPI {
 	void Setup() {
+		if (s_bBatch) {
+			if (s_bBatchSetup && (s_nBatchSpeedHz == m_nSpeedHz) && (s_nBatchChipSelect == m_nChipSelect) && (s_nBatchMode == m_nMode)) {
+				return;
+			}
+
+			s_bBatchSetup = true;
+			s_nBatchSpeedHz = m_nSpeedHz;
+			s_nBatchChipSelect = m_nChipSelect;
+			s_nBatchMode = m_nMode;
+		}
+
 		FUNC_PREFIX(spi_chipSelect(m_nChipSelect));
 		FUNC_PREFIX(spi_setDataMode	(m_nMode));
 		FUNC_PREFIX(spi_set_speed_hz(m_nSpeedHz));
@@ -57,6 +68,20 @@ public:
 		FUNC_PREFIX(spi_begin());
 	}
 
+	/**
+	 * Between BatchBegin() and BatchEnd() the bus is owned by the caller.
+	 * A transaction with the same chip select, mode and speed as the
+	 * previous one skips the controller setup.
+	 */
+	static void BatchBegin() {
+		s_bBatch = true;
+		s_bBatchSetup = false;
+	}
+
+	static void BatchEnd() {
+		s_bBatch = false;
+	}
+
 	void Write(const char *pData, uint32_t nLength, const bool bDoSetup = true) {
 		if (bDoSetup) {
 			Setup();
@@ -82,6 +107,12 @@ private:
 	uint32_t m_nSpeedHz;
 	uint8_t m_nChipSelect;
 	uint8_t m_nMode;
+
+	inline static uint32_t s_nBatchSpeedHz;
+	inline static uint8_t s_nBatchChipSelect;
+	inline static uint8_t s_nBatchMode;
+	inline static bool s_bBatch;
+	inline static bool s_bBatchSetup;
 };
 #endif
 
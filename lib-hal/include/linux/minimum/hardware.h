@@ -0,0 +1,142 @@
+/**
+ * @file hardware.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LINUX_MINIMUM_HARDWARE_H_
+#define LINUX_MINIMUM_HARDWARE_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <time.h>
+
+/**
+ * Host build with only the clock and the software timers.
+ * It is the HAL for the pcap EMAC back-end, see lib-network/include/emac/pcap.h
+ */
+
+#ifdef NDEBUG
+ extern "C" void console_error(const char *);
+#endif
+
+class Hardware {
+public:
+	Hardware();
+
+	uint32_t Millis() {
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return static_cast<uint32_t>((static_cast<uint64_t>(ts.tv_sec) * 1000U) + (static_cast<uint64_t>(ts.tv_nsec) / 1000000U));
+	}
+
+	uint32_t Micros() {
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return static_cast<uint32_t>((static_cast<uint64_t>(ts.tv_sec) * 1000000U) + (static_cast<uint64_t>(ts.tv_nsec) / 1000U));
+	}
+
+	struct Timer {
+	    uint32_t nExpireTime;
+	    uint32_t nIntervalMillis;
+	    int32_t nId;
+	    hal::TimerCallback callback;
+	};
+
+	int32_t SoftwareTimerAdd(const uint32_t nIntervalMillis, const hal::TimerCallback callback) {
+	    if (m_nTimersCount >= hal::SOFTWARE_TIMERS_MAX) {
+#ifdef NDEBUG
+            console_error("SoftwareTimerAdd\n");
+#endif
+	        return -1;
+	    }
+
+	    const auto nCurrentTime = Hardware::Millis();
+
+		Timer newTimer = {
+				.nExpireTime = nCurrentTime + nIntervalMillis,
+				.nIntervalMillis = nIntervalMillis,
+				.nId = m_nNextId++,
+				.callback = callback,
+		};
+
+	    m_Timers[m_nTimersCount++] = newTimer;
+
+	    return newTimer.nId;
+	}
+
+	bool SoftwareTimerDelete(int32_t& nId) {
+		if (nId >= 0) {
+			for (uint32_t i = 0; i < m_nTimersCount; ++i) {
+				if (m_Timers[i].nId == nId) {
+					for (uint32_t j = i; j < m_nTimersCount - 1; ++j) {
+						m_Timers[j] = m_Timers[j + 1];
+					}
+					--m_nTimersCount;
+					nId = -1;
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	bool SoftwareTimerChange(const int32_t nId, const uint32_t nIntervalMillis) {
+		if (nId >= 0) {
+			for (uint32_t i = 0; i < m_nTimersCount; ++i) {
+				if (m_Timers[i].nId == nId) {
+					m_Timers[i].nExpireTime = Hardware::Millis() + nIntervalMillis;
+					m_Timers[i].nIntervalMillis = nIntervalMillis;
+
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	void Run() {
+	    const auto nCurrentTime = Hardware::Get()->Millis();
+
+	    for (uint32_t i = 0; i < m_nTimersCount; i++) {
+	        if (m_Timers[i].nExpireTime <= nCurrentTime) {
+	        	m_Timers[i].callback();
+	            m_Timers[i].nExpireTime = nCurrentTime + m_Timers[i].nIntervalMillis;
+	        }
+	    }
+	}
+
+	static Hardware *Get() {
+		return s_pThis;
+	}
+
+private:
+	Timer m_Timers[hal::SOFTWARE_TIMERS_MAX];
+	uint32_t m_nTimersCount { 0 };
+	int32_t m_nNextId { 0 };
+
+	static Hardware *s_pThis;
+};
+
+#endif /* LINUX_MINIMUM_HARDWARE_H_ */
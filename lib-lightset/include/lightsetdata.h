@@ -65,6 +65,14 @@ public:
 		 Get().IMergeSourceA(nPortIndex, pData, nLength, mergeMode);
 	}
 
+	/**
+	 * LTP write of nLength slots starting at slot nOffset.
+	 * The port length grows to the highest slot written.
+	 */
+	static void SetSourceA(const uint32_t nPortIndex, const uint32_t nOffset, const uint8_t *pData, const uint32_t nLength) {
+		Get().ISetSourceA(nPortIndex, nOffset, pData, nLength);
+	}
+
 	static void SetSourceB(const uint32_t nPortIndex, const uint8_t *pData, uint32_t nLength) {
 		Get().IMergeSourceB(nPortIndex, pData, nLength, MergeMode::LTP);
 	}
@@ -124,6 +132,17 @@ private:
 		memcpy(m_OutputPort[nPortIndex].data, pData, nLength);
 	}
 
+	void ISetSourceA(const uint32_t nPortIndex, const uint32_t nOffset, const uint8_t *pData, const uint32_t nLength) {
+		assert(nPortIndex < PORTS);
+		assert(pData != nullptr);
+		assert((nOffset + nLength) <= dmx::UNIVERSE_SIZE);
+
+		memcpy(&m_OutputPort[nPortIndex].sourceA.data[nOffset], pData, nLength);
+		memcpy(&m_OutputPort[nPortIndex].data[nOffset], pData, nLength);
+
+		m_OutputPort[nPortIndex].nLength = std::max(m_OutputPort[nPortIndex].nLength, nOffset + nLength);
+	}
+
 	void IMergeSourceB(const uint32_t nPortIndex, const uint8_t *pData, const uint32_t nLength, const MergeMode mergeMode) {
 		assert(nPortIndex < PORTS);
 		assert(pData != nullptr);
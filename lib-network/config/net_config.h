@@ -78,4 +78,23 @@
 # error
 #endif
 
+/*
+ * An idle connection is closed by the server after this timeout.
+ * It is also the advertised HTTP Keep-Alive timeout.
+ */
+#if !defined (TCP_IDLE_TIMEOUT_SECONDS)
+# define TCP_IDLE_TIMEOUT_SECONDS		5
+#endif
+
+/*
+ * Number of segments kept for retransmission, shared by all connections.
+ * Each entry is one MSS. A connection with queued data cannot take the last
+ * free entry, so 3 entries give one connection 2 segments in flight and keep
+ * one for another connection. When no entry is available, tcp_write accepts
+ * less than requested and the application writes the remainder later.
+ */
+#if !defined (TCP_TX_MAX_ENTRIES)
+# define TCP_TX_MAX_ENTRIES				3
+#endif
+
 #endif /* NET_CONFIG_H_ */
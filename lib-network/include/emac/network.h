@@ -36,6 +36,9 @@
 
 namespace net {
 void dhcp_run();
+#if defined (ENABLE_HTTPD)
+void tcp_timer();
+#endif
 #if defined (CONFIG_ENET_ENABLE_PTP)
 void ptp_run();
 #endif
@@ -224,8 +227,15 @@ public:
 		return net::tcp_read(nHandleListen, ppBuffer, HandleConnection);
 	}
 
-	void TcpWrite(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLength, const uint32_t HandleConnection) {
-		net::tcp_write(nHandleListen, pBuffer, nLength, HandleConnection);
+	/**
+	 * @return the number of bytes accepted, the remainder must be written again later. -1 when the connection is closed.
+	 */
+	int32_t TcpWrite(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLength, const uint32_t HandleConnection) {
+		return net::tcp_write(nHandleListen, pBuffer, nLength, HandleConnection);
+	}
+
+	void TcpClose(const int32_t nHandleListen, const uint32_t HandleConnection) {
+		net::tcp_close(nHandleListen, HandleConnection);
 	}
 
 	/*
@@ -290,6 +300,9 @@ public:
 		}
 #endif
 		net::dhcp_run();
+#if defined (ENABLE_HTTPD)
+		net::tcp_timer();
+#endif
 	}
 
 	static Network *Get() {
@@ -0,0 +1,71 @@
+/**
+ * @file pcap.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef EMAC_PCAP_H_
+#define EMAC_PCAP_H_
+
+#include <cstdint>
+
+/**
+ * EMAC back-end for a host build.
+ * The received frames are replayed from a pcap capture, the transmitted frames are recorded in a pcap file.
+ * It replaces the src/emac/gd32 sources.
+ */
+namespace emac {
+namespace pcap {
+struct Statistics {
+	uint32_t nRxFrames;
+	uint32_t nRxBytes;
+	uint32_t nTxFrames;
+	uint32_t nTxBytes;
+	uint32_t nLatencyCount;		///< Frames sent while handling a received frame
+	uint64_t nLatencyTotalMicros;
+	uint32_t nLatencyMaxMicros;
+	uint64_t nElapsedMicros;	///< From the first replayed frame to the last frame sent
+};
+
+/**
+ * @param pFileName classic pcap file, link type Ethernet
+ * @param bRealTime true: the frames are delivered at the captured timestamps, false: as fast as possible
+ */
+bool replay_open(const char *pFileName, const bool bRealTime);
+
+/**
+ * The timestamps of the recorded frames start at 0 with the call of record_open.
+ */
+bool record_open(const char *pFileName);
+void close();
+
+/**
+ * @return true when all frames of the capture are delivered
+ */
+bool replay_done();
+
+const Statistics& statistics();
+void statistics_print();
+}  // namespace pcap
+}  // namespace emac
+
+#endif /* EMAC_PCAP_H_ */
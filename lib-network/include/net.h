@@ -71,7 +71,8 @@ void igmp_leave(uint32_t);
 
 int tcp_begin(const uint16_t);
 uint16_t tcp_read(const int32_t, const uint8_t **, uint32_t &);
-void tcp_write(const int32_t, const uint8_t *, uint32_t, const uint32_t);
+int32_t tcp_write(const int32_t, const uint8_t *, uint32_t, const uint32_t);
+void tcp_close(const int32_t, const uint32_t);
 
 /**
  * Must be provided by the application
@@ -84,7 +84,7 @@ private:
 	void Parse();
 	void HandleQuestions(const uint32_t nQuestions);
 	void SendAnswerLocalIpAddress(const uint16_t nTransActionID, const uint32_t nTTL);
-	void SendMessage(mdns::ServiceRecord const& serviceRecord, const uint16_t nTransActionID, const uint32_t nTTL);
+	void SendMessage(const uint32_t nIndex, const uint16_t nTransActionID, const uint32_t nTTL);
 	void SendTo(const uint32_t nLength);
 
 private:
@@ -47,11 +47,20 @@ public:
 	virtual bool FileClose()=0;
 	virtual size_t FileRead(void *pBuffer, size_t nCount, unsigned nBlockNumber)=0;
 	virtual size_t FileWrite(const void *pBuffer, size_t nCount, unsigned nBlockNumber)=0;
+	/**
+	 * Called on each Run() during a write request, a streaming sink can use it to advance its work.
+	 * When it returns false, the incoming blocks are dropped and not acknowledged.
+	 */
+	virtual bool FileWriteReady() {
+		return true;
+	}
 
 	virtual void Exit()=0;
 
 private:
 	void HandleRequest();
+	bool ParseOptions(const char *pOptions, const char *pEnd, const uint16_t nOpCode);
+	void SendOptionAck();
 	void HandleRecvAck();
 	void HandleRecvData();
 	void SendError (const uint16_t nsErrorCode, const char *pErrorMessage);
@@ -74,9 +83,16 @@ private:
 	uint32_t m_nLength { 0 };
 	uint32_t m_nDataLength { 0 };
 	uint32_t m_nPacketLength { 0 };
+	uint32_t m_nBlockCount { 0 };		///< Number of blocks written, does not wrap
 	uint16_t m_nFromPort { 0 };
 	uint16_t m_nBlockNumber { 0 };
+	uint16_t m_nBlockSize { 512 };		///< RFC 2348
+	uint16_t m_nWindowSize { 1 };		///< RFC 7440
+	uint16_t m_nWindowCount { 0 };		///< Blocks received since the last ACK
 	bool m_bIsLastBlock { false };
+	bool m_bHasOptions { false };
+	bool m_bIsGapAcked { false };
+	bool m_bIsStalled { false };
 
 	static TFTPDaemon* Get() {
 		return s_pThis;
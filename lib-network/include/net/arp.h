@@ -36,6 +36,14 @@ namespace arp {
 enum class Flags {
 	FLAG_INSERT, FLAG_UPDATE
 };
+
+struct Statistics {
+	uint32_t nHits;			///< Destination found in the cache
+	uint32_t nMisses;		///< Destination not resolved, the packet is queued
+	uint32_t nEvictions;	///< A resolved destination was replaced by another one
+	uint32_t nQueued;		///< Packets queued while waiting for a resolution
+	uint32_t nDropped;		///< Packets dropped: queue full or the resolution failed
+};
 }  // namespace arp
 
 void arp_init();
@@ -46,6 +54,8 @@ void arp_send_timestamp(struct t_udp *, const uint32_t, const uint32_t);
 #endif
 void arp_acd_probe(const ip4_addr_t ipaddr);
 void arp_acd_send_announcement(const ip4_addr_t ipaddr);
+
+const arp::Statistics& arp_statistics();
 }  // namespace net
 
 #endif /* ARP_PRIVATE_H_ */
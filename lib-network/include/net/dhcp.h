@@ -48,6 +48,7 @@ static constexpr uint32_t DHCP_COARSE_TIMER_MSECS = (DHCP_COARSE_TIMER_SECS * 10
 static constexpr uint32_t DHCP_FINE_TIMER_MSECS =  500;
 
 #define DHCP_FLAG_SUBNET_MASK_GIVEN 0x01
+#define DHCP_FLAG_REMEMBERED_LEASE  0x02
 #define DHCP_AUTOIP_COOP_TRIES     9
 
 enum class AutoipCoopState {
@@ -91,6 +92,7 @@ struct Dhcp {
 }  // namespace dhcp
 
 bool dhcp_start();
+bool dhcp_start(const ip4_addr_t ipaddr, const ip4_addr_t netmask, const ip4_addr_t gw);
 bool dhcp_renew();
 bool dhcp_release();
 void dhcp_stop();
@@ -134,6 +136,17 @@ inline bool dhcp_supplied_address() {
 	}
 	return false;
 }
+
+/**
+ * The lease was refused (DHCPNAK) or the address is in use by another host (ACD).
+ */
+inline bool dhcp_is_backing_off() {
+	const auto *dhcp = reinterpret_cast<struct dhcp::Dhcp *>(globals::netif_default.dhcp);
+	if ((dhcp != nullptr)) {
+		return (dhcp->state == dhcp::State::STATE_BACKING_OFF);
+	}
+	return false;
+}
 }  // namespace net
 
 #endif /* NET_DHCP_H_ */
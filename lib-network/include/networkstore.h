@@ -55,6 +55,14 @@ public:
 	static void SaveDhcp(bool bIsDhcpUsed) {
 		ConfigStore::Get()->Update(configstore::Store::NETWORK, offsetof(struct networkparams::Params, bIsDhcpUsed), &bIsDhcpUsed, sizeof(bool), networkparams::Mask::DHCP);
 	}
+
+	static void SaveDhcpLease(uint32_t nIp, uint32_t nNetMask, uint32_t nGatewayIp) {
+		ConfigStore::Get()->SetEnvDhcpLease(nIp, nNetMask, nGatewayIp);
+	}
+
+	static void GetDhcpLease(uint32_t& nIp, uint32_t& nNetMask, uint32_t& nGatewayIp) {
+		ConfigStore::Get()->GetEnvDhcpLease(nIp, nNetMask, nGatewayIp);
+	}
 };
 
 #endif /* NETWORKSTORE_H_ */
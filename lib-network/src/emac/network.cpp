@@ -74,6 +74,18 @@ static void netif_ext_callback(const uint16_t reason, [[maybe_unused]] const net
 		printf("ip: " IPSTR " -> " IPSTR "\n", IP2STR(args->ipv4_changed.old_address.addr), IP2STR(net::netif_ipaddr()));
 	}
 
+	/*
+	 * Remember the lease for INIT-REBOOT at the next boot.
+	 * The store is only written when the lease has changed.
+	 */
+	if ((reason & net::NetifReason::NSC_IPV4_ADDR_VALID) == net::NetifReason::NSC_IPV4_ADDR_VALID) {
+		if (net::dhcp_supplied_address()) {
+			NetworkStore::SaveDhcpLease(net::netif_ipaddr(), net::netif_netmask(), net::netif_gw());
+		}
+	} else if ((net::netif_ipaddr() == 0) && net::dhcp_is_backing_off()) {
+		NetworkStore::SaveDhcpLease(0, 0, 0);
+	}
+
 	if ((reason & net::NetifReason::NSC_IPV4_NETMASK_CHANGED) == net::NetifReason::NSC_IPV4_NETMASK_CHANGED) {
 		net::display_netmask();
 
@@ -163,6 +175,10 @@ Network::Network() {
 
 	bool isDhcpUsed = params.isDhcpUsed();
 
+	if (isDhcpUsed) {
+		NetworkStore::GetDhcpLease(ipaddr.addr, netmask.addr, gw.addr);
+	}
+
 	net::display_emac_status(net::Link::STATE_UP == s_lastState);
 	net::net_init(s_lastState, ipaddr, netmask, gw, isDhcpUsed);
 
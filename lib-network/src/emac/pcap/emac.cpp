@@ -0,0 +1,316 @@
+/**
+ * @file emac.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * https://wiki.wireshark.org/Development/LibpcapFileFormat
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <cassert>
+
+#include "emac/pcap.h"
+#include "emac/phy.h"
+#include "emac/emac.h"
+#include "emac/net_link_check.h"
+
+#include "debug.h"
+
+namespace emac {
+namespace pcap {
+static constexpr uint32_t MAGIC_MICROS = 0xa1b2c3d4;
+static constexpr uint32_t MAGIC_NANOS = 0xa1b23c4d;
+static constexpr uint32_t LINKTYPE_ETHERNET = 1;
+static constexpr uint32_t SNAPLEN = 1536;
+
+struct FileHeader {
+	uint32_t nMagic;
+	uint16_t nVersionMajor;
+	uint16_t nVersionMinor;
+	int32_t nThisZone;
+	uint32_t nSigFigs;
+	uint32_t nSnapLen;
+	uint32_t nLinkType;
+};
+
+struct RecordHeader {
+	uint32_t nSeconds;
+	uint32_t nFraction;
+	uint32_t nIncludedLength;
+	uint32_t nOriginalLength;
+};
+
+static FILE *s_pReplay;
+static FILE *s_pRecord;
+static bool s_bRealTime;
+static bool s_bSwapped;
+static bool s_bNanos;
+static bool s_bDone = true;
+static bool s_bPending;
+
+static uint8_t s_RxFrame[SNAPLEN];
+static uint32_t s_nRxLength;
+static uint64_t s_nCaptureMicros;		///< Timestamp of the pending frame
+static uint64_t s_nCaptureStartMicros;
+static uint64_t s_nReplayStartMicros;
+static uint64_t s_nRxMicros;			///< Time the last frame was delivered
+static uint64_t s_nRecordStartMicros;
+static bool s_bRxHandled = true;
+
+static Statistics s_Statistics;
+
+static uint64_t micros() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (static_cast<uint64_t>(ts.tv_sec) * 1000000U) + (static_cast<uint64_t>(ts.tv_nsec) / 1000U);
+}
+
+static uint32_t get(const uint32_t n) {
+	return s_bSwapped ? __builtin_bswap32(n) : n;
+}
+
+static bool read_next() {
+	RecordHeader header;
+
+	while (fread(&header, sizeof(header), 1, s_pReplay) == 1) {
+		const auto nLength = get(header.nIncludedLength);
+
+		if (nLength > SNAPLEN) {
+			DEBUG_PRINTF("Skip %u", nLength);
+			if (fseek(s_pReplay, static_cast<long>(nLength), SEEK_CUR) != 0) {
+				break;
+			}
+			continue;
+		}
+
+		if (fread(s_RxFrame, 1, nLength, s_pReplay) != nLength) {
+			break;
+		}
+
+		s_nRxLength = nLength;
+		s_nCaptureMicros = (static_cast<uint64_t>(get(header.nSeconds)) * 1000000U) + (s_bNanos ? get(header.nFraction) / 1000U : get(header.nFraction));
+		return true;
+	}
+
+	return false;
+}
+
+bool replay_open(const char *pFileName, const bool bRealTime) {
+	DEBUG_ENTRY
+	assert(pFileName != nullptr);
+
+	if ((s_pReplay = fopen(pFileName, "rb")) == nullptr) {
+		perror(pFileName);
+		DEBUG_EXIT
+		return false;
+	}
+
+	FileHeader header;
+
+	if (fread(&header, sizeof(header), 1, s_pReplay) != 1) {
+		fclose(s_pReplay);
+		s_pReplay = nullptr;
+		DEBUG_EXIT
+		return false;
+	}
+
+	s_bSwapped = (header.nMagic == __builtin_bswap32(MAGIC_MICROS)) || (header.nMagic == __builtin_bswap32(MAGIC_NANOS));
+	s_bNanos = (get(header.nMagic) == MAGIC_NANOS);
+
+	if (((get(header.nMagic) != MAGIC_MICROS) && !s_bNanos) || (get(header.nLinkType) != LINKTYPE_ETHERNET)) {
+		printf("%s: not a pcap Ethernet capture\n", pFileName);
+		fclose(s_pReplay);
+		s_pReplay = nullptr;
+		DEBUG_EXIT
+		return false;
+	}
+
+	s_bRealTime = bRealTime;
+	s_bPending = read_next();
+	s_bDone = !s_bPending;
+	s_nCaptureStartMicros = s_nCaptureMicros;
+	s_nReplayStartMicros = micros();
+
+	memset(&s_Statistics, 0, sizeof(s_Statistics));
+
+	DEBUG_EXIT
+	return true;
+}
+
+bool record_open(const char *pFileName) {
+	DEBUG_ENTRY
+	assert(pFileName != nullptr);
+
+	if ((s_pRecord = fopen(pFileName, "wb")) == nullptr) {
+		perror(pFileName);
+		DEBUG_EXIT
+		return false;
+	}
+
+	const FileHeader header = { MAGIC_MICROS, 2, 4, 0, 0, SNAPLEN, LINKTYPE_ETHERNET };
+	fwrite(&header, sizeof(header), 1, s_pRecord);
+
+	s_nRecordStartMicros = micros();
+
+	DEBUG_EXIT
+	return true;
+}
+
+void close() {
+	if (s_pReplay != nullptr) {
+		fclose(s_pReplay);
+		s_pReplay = nullptr;
+	}
+
+	if (s_pRecord != nullptr) {
+		fclose(s_pRecord);
+		s_pRecord = nullptr;
+	}
+
+	s_bPending = false;
+	s_bDone = true;
+}
+
+bool replay_done() {
+	return s_bDone;
+}
+
+const Statistics& statistics() {
+	return s_Statistics;
+}
+
+void statistics_print() {
+	const auto& s = s_Statistics;
+	const auto nSeconds = static_cast<double>(s.nElapsedMicros) / 1000000.0;
+
+	printf("RX %u frames, %u bytes\n", s.nRxFrames, s.nRxBytes);
+	printf("TX %u frames, %u bytes\n", s.nTxFrames, s.nTxBytes);
+
+	if (s.nElapsedMicros != 0) {
+		printf("%.3f s, %.1f frames/s\n", nSeconds, static_cast<double>(s.nRxFrames) / nSeconds);
+	}
+
+	if (s.nLatencyCount != 0) {
+		printf("RX -> TX latency avg %u us, max %u us\n", static_cast<uint32_t>(s.nLatencyTotalMicros / s.nLatencyCount), s.nLatencyMaxMicros);
+	}
+}
+}  // namespace pcap
+}  // namespace emac
+
+using namespace emac::pcap;
+
+/*
+ * There is no PHY, the link is always up
+ */
+namespace net {
+void phy_customized_led() {}
+void phy_customized_timing() {}
+void phy_customized_status([[maybe_unused]] PhyStatus& phyStatus) {}
+
+net::Link link_status_read() {
+	return net::Link::STATE_UP;
+}
+}  // namespace net
+
+void emac_config() {
+	DEBUG_ENTRY
+	DEBUG_EXIT
+}
+
+void emac_start(uint8_t macAddress[], net::Link& link) {
+	DEBUG_ENTRY
+
+	static constexpr uint8_t MAC_ADDRESS[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };	// Locally administered
+	memcpy(macAddress, MAC_ADDRESS, sizeof(MAC_ADDRESS));
+
+	link = net::Link::STATE_UP;
+
+	DEBUG_EXIT
+}
+
+int emac_eth_recv(uint8_t **ppPacket) {
+	if (!s_bPending) {
+		return -1;
+	}
+
+	const auto nNow = micros();
+
+	if (s_bRealTime && ((nNow - s_nReplayStartMicros) < (s_nCaptureMicros - s_nCaptureStartMicros))) {
+		return -1;
+	}
+
+	*ppPacket = s_RxFrame;
+
+	s_nRxMicros = nNow;
+	s_bRxHandled = false;
+
+	return static_cast<int>(s_nRxLength);
+}
+
+void emac_free_pkt() {
+	assert(s_bPending);
+
+	s_Statistics.nRxFrames++;
+	s_Statistics.nRxBytes += s_nRxLength;
+	s_Statistics.nElapsedMicros = micros() - s_nReplayStartMicros;
+
+	s_bRxHandled = true;
+	s_bPending = read_next();
+	s_bDone = !s_bPending;
+}
+
+void emac_eth_send(void *pBuffer, uint32_t nLength) {
+	assert(pBuffer != nullptr);
+
+	const auto nNow = micros();
+
+	s_Statistics.nTxFrames++;
+	s_Statistics.nTxBytes += nLength;
+	s_Statistics.nElapsedMicros = nNow - s_nReplayStartMicros;
+
+	if (!s_bRxHandled) {
+		// Sent while the received frame is handled, i.e. a reply
+		const auto nLatency = static_cast<uint32_t>(nNow - s_nRxMicros);
+		s_Statistics.nLatencyCount++;
+		s_Statistics.nLatencyTotalMicros += nLatency;
+		if (nLatency > s_Statistics.nLatencyMaxMicros) {
+			s_Statistics.nLatencyMaxMicros = nLatency;
+		}
+	}
+
+	if (s_pRecord != nullptr) {
+		// The frames sent before the replay is started are recorded too
+		const auto nMicros = nNow - s_nRecordStartMicros;
+		const RecordHeader header = { static_cast<uint32_t>(nMicros / 1000000U), static_cast<uint32_t>(nMicros % 1000000U), nLength, nLength };
+		fwrite(&header, sizeof(header), 1, s_pRecord);
+		fwrite(pBuffer, 1, nLength, s_pRecord);
+	}
+}
+
+void emac_eth_send_timestamp(void *pBuffer, uint32_t nLength) {
+	emac_eth_send(pBuffer, nLength);
+}
@@ -58,7 +58,7 @@ static constexpr uint32_t ACD_TMR_INTERVAL = 100;
 static constexpr uint32_t ACD_TICKS_PER_SECOND = (1000U / ACD_TMR_INTERVAL);
 }  // namespace acd
 
-static int32_t nTimerId;
+static int32_t nTimerId = -1;
 
 static void acd_timer() {
 	auto *acd = reinterpret_cast<struct acd::Acd *>(globals::netif_default.acd);
@@ -208,8 +208,11 @@ void acd_start(struct acd::Acd *acd, const ip4_addr_t ipaddr) {
 	acd->state = acd::State::ACD_STATE_PROBE_WAIT;
 	acd->ttw = static_cast<uint16_t>(random() % (PROBE_WAIT * acd::ACD_TICKS_PER_SECOND));
 
-	nTimerId = Hardware::Get()->SoftwareTimerAdd(acd::ACD_TMR_INTERVAL, acd_timer);
-	assert(nTimerId >= 0);
+	/* A restart (i.e. DHCP confirming an address already probed in the background) keeps the timer */
+	if (nTimerId < 0) {
+		nTimerId = Hardware::Get()->SoftwareTimerAdd(acd::ACD_TMR_INTERVAL, acd_timer);
+		assert(nTimerId >= 0);
+	}
 
 	DEBUG_EXIT
 }
@@ -220,9 +223,10 @@ void acd_stop(struct acd::Acd *acd) {
 
 	acd->state = acd::State::ACD_STATE_OFF;
 
-	assert(nTimerId >= 0);
-	Hardware::Get()->SoftwareTimerDelete(nTimerId);
-	nTimerId = -1;
+	if (nTimerId >= 0) {
+		Hardware::Get()->SoftwareTimerDelete(nTimerId);
+		nTimerId = -1;
+	}
 
 	DEBUG_EXIT
 }
@@ -52,6 +52,7 @@ static constexpr auto SERVICE_RECORDS_MAX = MDNS_SERVICE_RECORDS_MAX;
 #endif
 
 static constexpr uint32_t MDNS_RESPONSE_TTL = 3600;		///< (in seconds)
+static constexpr uint32_t RATE_LIMIT_MILLIS = 1000;		///< RFC 6762, 6. A record is multicast at most once per second
 
 static constexpr size_t DOMAIN_MAXLEN = 256;
 static constexpr size_t LABEL_MAXLEN = 63;
@@ -154,34 +155,6 @@ struct Domain {
 			putchar('\n');
 		}
 	}
-
-	friend bool operator== (Domain const &DomainA, Domain const &DomainB) {
-		if (DomainA.nLength != DomainB.nLength) {
-			return false;
-		}
-
-		auto const *pNameA = DomainA.aName;
-		auto const *pNameB = DomainB.aName;
-
-		while(*pNameA && *pNameB && (pNameA < &DomainA.aName[DomainA.nLength])) {
-			if (*pNameA != *pNameB) {
-				return false;
-			}
-
-			auto nLength = static_cast<size_t>(*pNameA);
-			pNameA++;
-			pNameB++;
-
-			if (strncasecmp(reinterpret_cast<const char *>(pNameA), reinterpret_cast<const char *>(pNameB), nLength) != 0) {
-				return false;
-			}
-
-			pNameA += nLength;
-			pNameB += nLength;
-		}
-
-		return true;
-	}
 };
 
 static constexpr Domain DOMAIN_DNSSD {
@@ -189,10 +162,38 @@ static constexpr Domain DOMAIN_DNSSD {
 	10 + 8 + 5 + 6 + 1
 };
 
+#if !defined (MDNS_ANSWER_DATA_SIZE)
+static constexpr size_t ANSWER_DATA_SIZE = 128 + SERVICE_RECORDS_MAX * 256;
+#else
+static constexpr size_t ANSWER_DATA_SIZE = MDNS_ANSWER_DATA_SIZE;
+#endif
+
+static constexpr uint32_t HOST_ANSWERS = 2;		///< A, PTR
+static constexpr uint32_t SERVICE_ANSWERS = 4;	///< TYPE_PTR, NAME_PTR, SRV, TXT
+
+/*
+ * The answers are serialized once and rebuilt only when a service record,
+ * the IP address or the host name changes. A compression pointer is relative
+ * to the start of its answer and is relocated when the answer is copied
+ * into a message. The TTL is filled in at send time.
+ */
+struct Answer {
+	uint16_t nOffset;			///< Into s_AnswerData
+	uint16_t nLength;			///< 0 when the answer is not available
+	uint16_t nTtlOffset;
+	uint16_t nPointerOffset;	///< 0 when the answer has no compression pointer
+	uint32_t nMulticastMillis;	///< Last time the answer was multicast
+};
+
 static ServiceRecord s_ServiceRecords[mdns::SERVICE_RECORDS_MAX];
 static HostReply s_HostReplies;
-static ServiceReply s_ServiceReplies;
+static ServiceReply s_ServiceReplies[mdns::SERVICE_RECORDS_MAX];
 static uint8_t s_RecordsData[net::dns::MULTICAST_MESSAGE_SIZE];
+static Answer s_HostAnswers[HOST_ANSWERS];
+static Answer s_ServiceAnswers[mdns::SERVICE_RECORDS_MAX][SERVICE_ANSWERS];
+static uint8_t s_AnswerData[ANSWER_DATA_SIZE];
+static uint16_t s_nAnswerDataLength;
+static bool s_bAnswersValid;
 static bool s_isUnicast;
 static bool s_bLegacyQuery;
 
@@ -228,6 +229,7 @@ void mdns_announcement() {
 	DEBUG_ENTRY
 
 	assert(MDNS::Get() != nullptr);
+	s_bAnswersValid = false;
 	MDNS::Get()->SendAnnouncement(MDNS_RESPONSE_TTL);
 
 	DEBUG_ENTRY
@@ -390,8 +392,7 @@ uint8_t *find_compression_pointer(const uint8_t *const base, const uint8_t *cons
  * https://opensource.apple.com/source/mDNSResponder/mDNSResponder-26.2/mDNSCore/mDNS.c.auto.html
  * mDNSlocal mDNSu8 *putDomainNameAsLabels(const DNSMessage *const msg, mDNSu8 *ptr, const mDNSu8 *const limit, const domainname *const name)
  */
-static uint8_t *put_domain_name_as_labels(uint8_t *ptr, Domain const &domain) {
-	const uint8_t *const base = s_RecordsData;
+static uint8_t *put_domain_name_as_labels(const uint8_t *const base, uint8_t *ptr, Domain const &domain) {
 	const auto *np = domain.aName;
 	uint8_t *pointer = nullptr;
 	const auto *const searchlimit = ptr;
@@ -418,7 +419,7 @@ static uint8_t *put_domain_name_as_labels(uint8_t *ptr, Domain const &domain) {
 }
 
 static uint8_t *add_question(uint8_t *pDestination, const Domain& domain, const net::dns::RRType type, const bool bFlush) {
-	auto *pDst = put_domain_name_as_labels(pDestination, domain);
+	auto *pDst = put_domain_name_as_labels(pDestination, pDestination, domain);
 
 	*reinterpret_cast<volatile uint16_t*>(pDst) = __builtin_bswap16(static_cast<uint16_t>(type));
 	pDst += 2;
@@ -447,7 +448,7 @@ static uint32_t add_answer_srv(mdns::ServiceRecord const& serviceRecord, uint8_t
 	auto *pBegin = pDst;
 
 	create_host_domain(domain);
-	pDst = put_domain_name_as_labels(pDst, domain);
+	pDst = put_domain_name_as_labels(pDestination, pDst, domain);
 
 	*reinterpret_cast<uint16_t*>(lengtPointer) = __builtin_bswap16(static_cast<uint16_t>(6U + pDst - pBegin));
 
@@ -500,7 +501,7 @@ static uint32_t add_answer_ptr(mdns::ServiceRecord const& serviceRecord, uint8_t
 	auto *pBegin = pDst;
 
 	create_service_domain(domain, serviceRecord, true);
-	pDst = put_domain_name_as_labels(pDst, domain);
+	pDst = put_domain_name_as_labels(pDestination, pDst, domain);
 
 	*reinterpret_cast<uint16_t*>(lengtPointer) = __builtin_bswap16(static_cast<uint16_t>(pDst - pBegin));
 
@@ -522,7 +523,7 @@ static uint32_t add_answer_dnsd_ptr(mdns::ServiceRecord const& serviceRecord, ui
 	Domain domain;
 
 	create_service_domain(domain, serviceRecord, false);
-	pDst = put_domain_name_as_labels(pDst, domain);
+	pDst = put_domain_name_as_labels(pDestination, pDst, domain);
 
 	*reinterpret_cast<uint16_t*>(lengtPointer) = __builtin_bswap16(static_cast<uint16_t>(pDst - pBegin));
 
@@ -565,7 +566,7 @@ static uint32_t add_answer_hostv4_ptr(uint8_t *pDestination, const uint32_t nTTL
 	auto *pBegin = pDst;
 
 	create_host_domain(domain);
-	pDst = put_domain_name_as_labels(pDst, domain);
+	pDst = put_domain_name_as_labels(pDestination, pDst, domain);
 
 	*reinterpret_cast<uint16_t*>(lengtPointer) = __builtin_bswap16(static_cast<uint16_t>(pDst - pBegin));
 
@@ -649,43 +650,258 @@ const uint8_t *get_domain_name(const uint8_t *const msg, const uint8_t *ptr, con
 		return (ptr);
 }
 
+static uint32_t domain_name_length(const uint8_t *pName) {
+	const auto *p = pName;
+
+	while (*p != 0) {
+		p += 1U + *p;
+	}
+
+	return static_cast<uint32_t>(p - pName) + 1;
+}
+
+static bool domain_name_equal(const uint8_t *pNameA, const uint8_t *pNameB) {
+	while (*pNameA == *pNameB) {
+		const auto nLength = static_cast<size_t>(*pNameA);
+
+		if (nLength == 0) {
+			return true;
+		}
+
+		pNameA++;
+		pNameB++;
+
+		if (strncasecmp(reinterpret_cast<const char *>(pNameA), reinterpret_cast<const char *>(pNameB), nLength) != 0) {
+			return false;
+		}
+
+		pNameA += nLength;
+		pNameB += nLength;
+	}
+
+	return false;
+}
+
+/**
+ * @return offset of the domain name in the RDATA, -1 when there is none
+ */
+static int32_t rdata_name_offset(const net::dns::RRType type) {
+	if (type == net::dns::RRType::RRTYPE_PTR) {
+		return 0;
+	}
+
+	if (type == net::dns::RRType::RRTYPE_SRV) {
+		return 6;	// Priority, Weight and Port
+	}
+
+	return -1;
+}
+
+static net::dns::RRType answer_type(const uint8_t *pAnswer, const uint32_t nTtlOffset) {
+	return static_cast<net::dns::RRType>(__builtin_bswap16(*reinterpret_cast<const uint16_t *>(&pAnswer[nTtlOffset - 4])));
+}
+
+static uint16_t answer_pointer_offset(const uint8_t *pAnswer, const uint32_t nTtlOffset) {
+	const auto nNameOffset = rdata_name_offset(answer_type(pAnswer, nTtlOffset));
+
+	if (nNameOffset < 0) {
+		return 0;
+	}
+
+	auto nOffset = nTtlOffset + 6U + static_cast<uint32_t>(nNameOffset);
+
+	while (pAnswer[nOffset] != 0) {
+		if ((pAnswer[nOffset] & 0xC0) == 0xC0) {
+			return static_cast<uint16_t>(nOffset);
+		}
+
+		nOffset += 1U + pAnswer[nOffset];
+	}
+
+	return 0;
+}
+
+/*
+ * The answer is serialized in s_RecordsData
+ */
+static void answer_store(Answer& answer, const uint32_t nLength) {
+	if (s_nAnswerDataLength + nLength > sizeof(s_AnswerData)) {
+		DEBUG_PUTS("Answer does not fit");
+		answer.nLength = 0;
+		return;
+	}
+
+	memcpy(&s_AnswerData[s_nAnswerDataLength], s_RecordsData, nLength);
+
+	answer.nOffset = s_nAnswerDataLength;
+	answer.nLength = static_cast<uint16_t>(nLength);
+	answer.nTtlOffset = static_cast<uint16_t>(domain_name_length(s_RecordsData) + 4);	// Type and Class
+	answer.nPointerOffset = answer_pointer_offset(s_RecordsData, answer.nTtlOffset);
+	answer.nMulticastMillis = Hardware::Get()->Millis() - RATE_LIMIT_MILLIS;
+
+	s_nAnswerDataLength = static_cast<uint16_t>(s_nAnswerDataLength + nLength);
+}
+
+static void answers_update() {
+	if (s_bAnswersValid) {
+		return;
+	}
+
+	DEBUG_ENTRY
+
+	s_nAnswerDataLength = 0;
+
+	for (auto &answer : s_HostAnswers) {
+		answer.nLength = 0;
+	}
+
+	answer_store(s_HostAnswers[0], add_answer_a(s_RecordsData, 0));
+#if defined (CONFIG_MDNS_DOMAIN_REVERSE)
+	answer_store(s_HostAnswers[1], add_answer_hostv4_ptr(s_RecordsData, 0));
+#endif
+
+	for (uint32_t nIndex = 0; nIndex < SERVICE_RECORDS_MAX; nIndex++) {
+		auto const& record = s_ServiceRecords[nIndex];
+		auto *pAnswers = s_ServiceAnswers[nIndex];
+
+		if (record.services < Services::LAST_NOT_USED) {
+			answer_store(pAnswers[0], add_answer_dnsd_ptr(record, s_RecordsData, 0));
+			answer_store(pAnswers[1], add_answer_ptr(record, s_RecordsData, 0));
+			answer_store(pAnswers[2], add_answer_srv(record, s_RecordsData, 0));
+			answer_store(pAnswers[3], add_answer_txt(record, s_RecordsData, 0));
+		} else {
+			for (uint32_t i = 0; i < SERVICE_ANSWERS; i++) {
+				pAnswers[i].nLength = 0;
+			}
+		}
+	}
+
+	s_bAnswersValid = true;
+
+	DEBUG_PRINTF("s_nAnswerDataLength=%u", s_nAnswerDataLength);
+	DEBUG_EXIT
+}
+
+static bool answer_owner_equal(Answer const& answer, const uint8_t *pName) {
+	return (answer.nLength != 0) && domain_name_equal(&s_AnswerData[answer.nOffset], pName);
+}
+
+static bool answer_fits(Answer const& answer, const uint8_t *pDestination) {
+	return (answer.nLength != 0) && (pDestination + answer.nLength <= &s_RecordsData[sizeof(s_RecordsData)]);
+}
+
+static bool answer_is_rate_limited(Answer const& answer, const uint32_t nMillis) {
+	return (nMillis - answer.nMulticastMillis) < RATE_LIMIT_MILLIS;
+}
+
+static uint8_t *answer_put(Answer& answer, uint8_t *pDestination, const uint32_t nTTL) {
+	memcpy(pDestination, &s_AnswerData[answer.nOffset], answer.nLength);
+
+	*reinterpret_cast<uint32_t *>(&pDestination[answer.nTtlOffset]) = __builtin_bswap32(nTTL);
+
+	if (answer.nPointerOffset != 0) {
+		auto *pPointer = &pDestination[answer.nPointerOffset];
+		const auto nOffset = static_cast<uint16_t>(((static_cast<uint32_t>(pPointer[0] & 0x3F) << 8) | pPointer[1]) + static_cast<uint32_t>(pDestination - s_RecordsData));
+		pPointer[0] = static_cast<uint8_t>(0xC0 | (nOffset >> 8));
+		pPointer[1] = static_cast<uint8_t>(nOffset);
+	}
+
+	if (!s_isUnicast) {
+		answer.nMulticastMillis = Hardware::Get()->Millis();
+	}
+
+	return pDestination + answer.nLength;
+}
+
+/*
+ * RFC 6762, 7.1. Known-Answer Suppression
+ * pName is the uncompressed owner name, pRData points into the received message pMessage.
+ */
+static bool answer_is_known(Answer const& answer, const uint8_t *pMessage, const uint8_t *pName, const net::dns::RRType type, const uint8_t *pRData, const uint32_t nRDLength) {
+	if (answer.nLength == 0) {
+		return false;
+	}
+
+	const auto *pAnswer = &s_AnswerData[answer.nOffset];
+
+	if ((answer_type(pAnswer, answer.nTtlOffset) != type) || !domain_name_equal(pAnswer, pName)) {
+		return false;
+	}
+
+	const auto *pAnswerRData = &pAnswer[answer.nTtlOffset + 6];
+	const auto nNameOffset = rdata_name_offset(type);
+
+	if (nNameOffset < 0) {
+		const auto nAnswerRDLength = __builtin_bswap16(*reinterpret_cast<const uint16_t *>(&pAnswer[answer.nTtlOffset + 4]));
+		return (nRDLength == nAnswerRDLength) && (memcmp(pRData, pAnswerRData, nRDLength) == 0);
+	}
+
+	const auto nPrefixLength = static_cast<uint32_t>(nNameOffset);
+
+	if ((nRDLength <= nPrefixLength) || (memcmp(pRData, pAnswerRData, nPrefixLength) != 0)) {
+		return false;
+	}
+
+	uint8_t aAnswerName[DOMAIN_MAXLEN];
+	uint8_t aKnownName[DOMAIN_MAXLEN];
+
+	if (get_domain_name(pAnswer, &pAnswerRData[nPrefixLength], &pAnswer[answer.nLength], aAnswerName) == nullptr) {
+		return false;
+	}
+
+	if (get_domain_name(pMessage, &pRData[nPrefixLength], &pRData[nRDLength], aKnownName) == nullptr) {
+		return false;
+	}
+
+	return domain_name_equal(aAnswerName, aKnownName);
+}
+
 void MDNS::SendAnswerLocalIpAddress(const uint16_t nTransActionID, const uint32_t nTTL) {
 	DEBUG_ENTRY
 
+	answers_update();
+
+	uint32_t nQuestions = 0;
 	uint32_t nAnswers = 0;
 	uint8_t *pDst = reinterpret_cast<uint8_t *>(&s_RecordsData) + sizeof(struct net::dns::Header);
 
 #if defined (CONFIG_MDNS_DOMAIN_REVERSE)
-	if ((HostReply::PTR & s_HostReplies) == HostReply::PTR) {
-		if (s_bLegacyQuery) {
-			Domain domain;
-			create_reverse_domain(domain);
-			pDst = add_question(pDst, domain, net::dns::RRType::RRTYPE_PTR, false);
+	if (((HostReply::PTR & s_HostReplies) == HostReply::PTR) && s_bLegacyQuery) {
+		/*
+		 * The question is the owner name, type and class of the answer, without the cache flush bit.
+		 */
+		auto const& answer = s_HostAnswers[1];
+
+		if (answer.nLength != 0) {
+			memcpy(pDst, &s_AnswerData[answer.nOffset], answer.nTtlOffset);
+			pDst[answer.nTtlOffset - 2] = static_cast<uint8_t>(pDst[answer.nTtlOffset - 2] & 0x7F);
+			pDst += answer.nTtlOffset;
+			nQuestions++;
 		}
 	}
 #endif
 
-	if ((HostReply::A & s_HostReplies) == HostReply::A) {
-		nAnswers++;
-		pDst += add_answer_a(pDst, nTTL);
+	for (uint32_t i = 0; i < HOST_ANSWERS; i++) {
+		const auto reply = static_cast<HostReply>(1U << i);
+		auto &answer = s_HostAnswers[i];
+
+		if (((reply & s_HostReplies) == reply) && answer_fits(answer, pDst)) {
+			pDst = answer_put(answer, pDst, nTTL);
+			nAnswers++;
+		}
 	}
-#if defined (CONFIG_MDNS_DOMAIN_REVERSE)
-	if ((HostReply::PTR & s_HostReplies) == HostReply::PTR) {
-		nAnswers++;
-		pDst += add_answer_hostv4_ptr(pDst, nTTL);
+
+	if (nAnswers == 0) {
+		DEBUG_EXIT
+		return;
 	}
-#endif
 
 	auto *pHeader = reinterpret_cast< net::dns::Header *>(&s_RecordsData);
 
 	pHeader->xid = nTransActionID;
 	pHeader->nFlag1 = net::dns::Flag1::FLAG1_RESPONSE | net::dns::Flag1::FLAG1_AUTHORATIVE;
 	pHeader->nFlag2 = 0;
-#if defined (CONFIG_MDNS_DOMAIN_REVERSE)
-	pHeader->nQueryCount = __builtin_bswap16(static_cast<uint16_t>(s_bLegacyQuery));
-#else
-	pHeader->nQueryCount = 0;
-#endif
+	pHeader->nQueryCount = __builtin_bswap16(static_cast<uint16_t>(nQuestions));
 	pHeader->nAnswerCount = __builtin_bswap16(static_cast<uint16_t>(nAnswers));
 	pHeader->nAuthorityCount = 0;
 	pHeader->nAdditionalCount = 0;
@@ -735,17 +951,18 @@ void MDNS::SendAnnouncement(const uint32_t nTTL) {
 	DEBUG_ENTRY
 
 	s_nRemotePort = net::iana::IANA_PORT_MDNS; //FIXME Hack ;-)
+	s_isUnicast = false;
 	s_HostReplies = HostReply::A;
 
 	SendAnswerLocalIpAddress(0, nTTL);
 
-	for (auto &record : s_ServiceRecords) {
-		if (record.services < Services::LAST_NOT_USED) {
-			s_ServiceReplies = ServiceReply::TYPE_PTR
-							 | ServiceReply::NAME_PTR
-							 | ServiceReply::SRV
-							 | ServiceReply::TXT;
-			SendMessage(record, 0, nTTL);
+	for (uint32_t nIndex = 0; nIndex < SERVICE_RECORDS_MAX; nIndex++) {
+		if (s_ServiceRecords[nIndex].services < Services::LAST_NOT_USED) {
+			s_ServiceReplies[nIndex] = ServiceReply::TYPE_PTR
+									 | ServiceReply::NAME_PTR
+									 | ServiceReply::SRV
+									 | ServiceReply::TXT;
+			SendMessage(nIndex, 0, nTTL);
 		}
 	}
 
@@ -756,7 +973,9 @@ bool MDNS::ServiceRecordAdd(const char *pName, const mdns::Services services, co
 	DEBUG_ENTRY
 	assert(services < mdns::Services::LAST_NOT_USED);
 
-	for (auto &record : s_ServiceRecords) {
+	for (uint32_t nIndex = 0; nIndex < SERVICE_RECORDS_MAX; nIndex++) {
+		auto &record = s_ServiceRecords[nIndex];
+
 		if (record.services == Services::LAST_NOT_USED) {
 			if (pName != nullptr) {
 				const auto nLength = std::min(LABEL_MAXLEN, strlen(pName));
@@ -790,14 +1009,17 @@ bool MDNS::ServiceRecordAdd(const char *pName, const mdns::Services services, co
 				record.nTextContentLength = static_cast<uint16_t>(nLength);
 			}
 
+			s_bAnswersValid = false;
+
 			s_nRemotePort = net::iana::IANA_PORT_MDNS; //FIXME Hack ;-)
+			s_isUnicast = false;
 
-			s_ServiceReplies = ServiceReply::TYPE_PTR
+			s_ServiceReplies[nIndex] = ServiceReply::TYPE_PTR
 					| ServiceReply::NAME_PTR
 					| ServiceReply::SRV
 					| ServiceReply::TXT;
 
-			SendMessage(record, 0, MDNS_RESPONSE_TTL);
+			SendMessage(nIndex, 0, MDNS_RESPONSE_TTL);
 			return true;
 		}
 	}
@@ -810,18 +1032,35 @@ bool MDNS::ServiceRecordDelete(const mdns::Services service) {
 	DEBUG_ENTRY
 	assert(service < mdns::Services::LAST_NOT_USED);
 
-	for (auto &record : s_ServiceRecords) {
+	for (uint32_t nIndex = 0; nIndex < SERVICE_RECORDS_MAX; nIndex++) {
+		auto &record = s_ServiceRecords[nIndex];
+
 		if (record.services == service) {
-			SendMessage(record, 0, 0);
+			s_nRemotePort = net::iana::IANA_PORT_MDNS; //FIXME Hack ;-)
+			s_isUnicast = false;
+
+			s_ServiceReplies[nIndex] = ServiceReply::TYPE_PTR
+					| ServiceReply::NAME_PTR
+					| ServiceReply::SRV
+					| ServiceReply::TXT;
+
+			SendMessage(nIndex, 0, 0);
 
 			if (record.pName != nullptr) {
 				delete[] record.pName;
+				record.pName = nullptr;
 			}
 
 			if (record.pTextContent != nullptr) {
 				delete[] record.pTextContent;
+				record.pTextContent = nullptr;
 			}
 
+			record.nTextContentLength = 0;
+			record.services = Services::LAST_NOT_USED;
+
+			s_bAnswersValid = false;
+
 			DEBUG_EXIT
 			return true;
 		}
@@ -840,33 +1079,40 @@ void MDNS::SendTo(const uint32_t nLength) {
 	Network::Get()->SendTo(s_nHandle, s_RecordsData, nLength, s_nRemoteIp, s_nRemotePort);
 }
 
-void MDNS::SendMessage(mdns::ServiceRecord const& serviceRecord, const uint16_t nTransActionID, const uint32_t nTT) {
+void MDNS::SendMessage(const uint32_t nIndex, const uint16_t nTransActionID, const uint32_t nTTL) {
 	DEBUG_ENTRY
+	assert(nIndex < SERVICE_RECORDS_MAX);
+
+	answers_update();
 
 	uint32_t nAnswers = 0;
 	auto *pDst = reinterpret_cast<uint8_t *>(&s_RecordsData) + sizeof(struct net::dns::Header);
 
-	if ((s_ServiceReplies & ServiceReply::TYPE_PTR) == ServiceReply::TYPE_PTR) {
-		nAnswers++;
-		pDst += add_answer_dnsd_ptr(serviceRecord, pDst, nTT);
-	}
+	for (uint32_t i = 0; i < SERVICE_ANSWERS; i++) {
+		const auto reply = static_cast<ServiceReply>(static_cast<uint32_t>(ServiceReply::TYPE_PTR) << i);
+		auto &answer = s_ServiceAnswers[nIndex][i];
 
-	if ((s_ServiceReplies & ServiceReply::NAME_PTR) == ServiceReply::NAME_PTR) {
-		nAnswers++;
-		pDst += add_answer_ptr(serviceRecord, pDst, nTT);
+		if (((s_ServiceReplies[nIndex] & reply) == reply) && answer_fits(answer, pDst)) {
+			pDst = answer_put(answer, pDst, nTTL);
+			nAnswers++;
+		}
 	}
 
-	if ((s_ServiceReplies & ServiceReply::SRV) == ServiceReply::SRV) {
-		nAnswers++;
-		pDst += add_answer_srv(serviceRecord, pDst, nTT);
+	if (nAnswers == 0) {
+		DEBUG_EXIT
+		return;
 	}
 
-	if ((s_ServiceReplies & ServiceReply::TXT) == ServiceReply::TXT) {
-		nAnswers++;
-		pDst += add_answer_txt(serviceRecord, pDst, nTT);
-	}
+	/*
+	 * RFC 6763, 12.2. SRV Records: the A record is an additional record.
+	 * A goodbye for a service must not remove the host address.
+	 */
+	uint32_t nAdditionals = 0;
 
-	pDst += add_answer_a(pDst, nTT);
+	if ((nTTL != 0) && answer_fits(s_HostAnswers[0], pDst)) {
+		pDst = answer_put(s_HostAnswers[0], pDst, nTTL);
+		nAdditionals++;
+	}
 
 	auto *pHeader = reinterpret_cast<net::dns::Header *>(&s_RecordsData);
 
@@ -875,8 +1121,8 @@ void MDNS::SendMessage(mdns::ServiceRecord const& serviceRecord, const uint16_t
 	pHeader->nFlag2 = 0;
 	pHeader->nQueryCount = 0;
 	pHeader->nAnswerCount = __builtin_bswap16(static_cast<uint16_t>(nAnswers));
-	pHeader->nAuthorityCount = __builtin_bswap16(1);
-	pHeader->nAdditionalCount = __builtin_bswap16(0);
+	pHeader->nAuthorityCount = 0;
+	pHeader->nAdditionalCount = __builtin_bswap16(static_cast<uint16_t>(nAdditionals));
 
 	const auto nSize = static_cast<uint16_t>(pDst - reinterpret_cast<uint8_t*>(pHeader));
 	SendTo(nSize);
@@ -888,7 +1134,14 @@ void MDNS::HandleQuestions(const uint32_t nQuestions) {
 	DEBUG_ENTRY
 	DEBUG_PRINTF("nQuestions=%u", nQuestions);
 
+	answers_update();
+
 	s_HostReplies = static_cast<mdns::HostReply>(0);
+
+	for (auto &replies : s_ServiceReplies) {
+		replies = static_cast<mdns::ServiceReply>(0);
+	}
+
 	s_isUnicast = (s_nRemotePort != net::iana::IANA_PORT_MDNS);
 	s_bLegacyQuery = s_isUnicast && (nQuestions == 1);
 
@@ -905,8 +1158,12 @@ void MDNS::HandleQuestions(const uint32_t nQuestions) {
 			return;
 		}
 
-		resourceDomain.nLength = static_cast<uint16_t>(pResult - &s_pReceiveBuffer[nOffset]);
-		nOffset += resourceDomain.nLength;
+		nOffset = static_cast<uint32_t>(pResult - s_pReceiveBuffer);
+
+		if (nOffset + 4 > s_nBytesReceived) {
+			DEBUG_EXIT
+			return;
+		}
 
 		const auto nType = static_cast<net::dns::RRType>(__builtin_bswap16(*reinterpret_cast<uint16_t*>(&s_pReceiveBuffer[nOffset])));
 		nOffset += 2;
@@ -915,6 +1172,7 @@ void MDNS::HandleQuestions(const uint32_t nQuestions) {
 		nOffset += 2;
 
 #ifndef NDEBUG
+		resourceDomain.nLength = static_cast<uint16_t>(domain_name_length(resourceDomain.aName));
 		resourceDomain.Print();
 		printf(" ==> Type : %d, Class: %d\n", static_cast<int>(nType), static_cast<int>(nClass));
 #endif
@@ -927,69 +1185,144 @@ void MDNS::HandleQuestions(const uint32_t nQuestions) {
 		 * Check host
 		 */
 
-		Domain domainHost;
-
 		if ((nType == net::dns::RRType::RRTYPE_A) || (nType == net::dns::RRType::RRTYPE_ALL)) {
-			DEBUG_PUTS("");
-			create_host_domain(domainHost);
-
-			if (domainHost == resourceDomain) {
+			if (answer_owner_equal(s_HostAnswers[0], resourceDomain.aName)) {
 				s_HostReplies = s_HostReplies | HostReply::A;
 			}
 		}
 
 #if defined (CONFIG_MDNS_DOMAIN_REVERSE)
 		if (nType == net::dns::RRType::RRTYPE_PTR || nType == net::dns::RRType::RRTYPE_ALL) {
-			DEBUG_PUTS("");
-			create_reverse_domain(domainHost);
-
-			if (domainHost == resourceDomain) {
+			if (answer_owner_equal(s_HostAnswers[1], resourceDomain.aName)) {
 				s_HostReplies = s_HostReplies | HostReply::PTR;
 			}
-
 		}
 #endif
 
-		for (auto &record : s_ServiceRecords) {
-			if (record.services < Services::LAST_NOT_USED) {
+		for (uint32_t nIndex = 0; nIndex < SERVICE_RECORDS_MAX; nIndex++) {
+			if (s_ServiceRecords[nIndex].services < Services::LAST_NOT_USED) {
 				/*
 				 * Check service
 				 */
 
-				s_ServiceReplies = static_cast<mdns::ServiceReply>(0);
-				Domain serviceDomain;
+				const auto *pAnswers = s_ServiceAnswers[nIndex];
+				auto replies = static_cast<mdns::ServiceReply>(0);
 
 				if (nType == net::dns::RRType::RRTYPE_PTR || nType == net::dns::RRType::RRTYPE_ALL) {
-					if (DOMAIN_DNSSD == resourceDomain) {
-						s_ServiceReplies = s_ServiceReplies | ServiceReply::TYPE_PTR;
+					if (domain_name_equal(DOMAIN_DNSSD.aName, resourceDomain.aName)) {
+						replies = replies | ServiceReply::TYPE_PTR;
 					}
 
-					create_service_domain(serviceDomain, record, false);
-
-					if (serviceDomain == resourceDomain) {
-						s_ServiceReplies = s_ServiceReplies | ServiceReply::NAME_PTR;
+					if (answer_owner_equal(pAnswers[1], resourceDomain.aName)) {
+						replies = replies | ServiceReply::NAME_PTR;
 					}
 				}
 
-				create_service_domain(serviceDomain, record, true);
-
-				if (serviceDomain == resourceDomain) {
+				if (answer_owner_equal(pAnswers[2], resourceDomain.aName)) {
 					if ((nType == net::dns::RRType::RRTYPE_SRV) || (nType == net::dns::RRType::RRTYPE_ALL)) {
-						s_ServiceReplies = s_ServiceReplies | ServiceReply::SRV;
+						replies = replies | ServiceReply::SRV;
 					}
 
 					if ((nType == net::dns::RRType::RRTYPE_TXT) || (nType == net::dns::RRType::RRTYPE_ALL)) {
-						s_ServiceReplies = s_ServiceReplies | ServiceReply::TXT;
+						replies = replies | ServiceReply::TXT;
 					}
 				}
 
-				if (s_ServiceReplies != static_cast<mdns::ServiceReply>(0)) {
-					SendMessage(record, nTransactionID, MDNS_RESPONSE_TTL);
+				s_ServiceReplies[nIndex] = s_ServiceReplies[nIndex] | replies;
+			}
+		}
+	}
+
+	/*
+	 * Known answers follow the questions
+	 */
+
+	const auto nKnownAnswers = static_cast<uint32_t>(__builtin_bswap16(reinterpret_cast<net::dns::Header *>(s_pReceiveBuffer)->nAnswerCount));
+
+	for (uint32_t i = 0; i < nKnownAnswers; i++) {
+		Domain knownDomain;
+
+		auto *pResult = get_domain_name(s_pReceiveBuffer, &s_pReceiveBuffer[nOffset], &s_pReceiveBuffer[s_nBytesReceived], knownDomain.aName);
+		if (pResult == nullptr) {
+			break;
+		}
+
+		nOffset = static_cast<uint32_t>(pResult - s_pReceiveBuffer);
+
+		if (nOffset + 10 > s_nBytesReceived) {
+			break;
+		}
+
+		const auto nType = static_cast<net::dns::RRType>(__builtin_bswap16(*reinterpret_cast<uint16_t *>(&s_pReceiveBuffer[nOffset])));
+		const auto nTTL = __builtin_bswap32(*reinterpret_cast<uint32_t *>(&s_pReceiveBuffer[nOffset + 4]));
+		const auto nRDLength = static_cast<uint32_t>(__builtin_bswap16(*reinterpret_cast<uint16_t *>(&s_pReceiveBuffer[nOffset + 8])));
+		nOffset += 10;
+
+		if (nOffset + nRDLength > s_nBytesReceived) {
+			break;
+		}
+
+		const auto *pRData = &s_pReceiveBuffer[nOffset];
+		nOffset += nRDLength;
+
+		/*
+		 * Only suppress when the known answer has at least half of the correct TTL
+		 */
+		if (nTTL < (MDNS_RESPONSE_TTL / 2)) {
+			continue;
+		}
+
+		for (uint32_t j = 0; j < HOST_ANSWERS; j++) {
+			const auto reply = static_cast<HostReply>(1U << j);
+
+			if (((s_HostReplies & reply) == reply) && answer_is_known(s_HostAnswers[j], s_pReceiveBuffer, knownDomain.aName, nType, pRData, nRDLength)) {
+				s_HostReplies = static_cast<HostReply>(static_cast<uint32_t>(s_HostReplies) & ~static_cast<uint32_t>(reply));
+			}
+		}
+
+		for (uint32_t nIndex = 0; nIndex < SERVICE_RECORDS_MAX; nIndex++) {
+			for (uint32_t j = 0; j < SERVICE_ANSWERS; j++) {
+				const auto reply = static_cast<ServiceReply>(static_cast<uint32_t>(ServiceReply::TYPE_PTR) << j);
+
+				if (((s_ServiceReplies[nIndex] & reply) == reply) && answer_is_known(s_ServiceAnswers[nIndex][j], s_pReceiveBuffer, knownDomain.aName, nType, pRData, nRDLength)) {
+					s_ServiceReplies[nIndex] = static_cast<ServiceReply>(static_cast<uint32_t>(s_ServiceReplies[nIndex]) & ~static_cast<uint32_t>(reply));
+				}
+			}
+		}
+	}
+
+	/*
+	 * RFC 6762, 6. Responding: rate limit the multicast answers
+	 */
+
+	if (!s_isUnicast) {
+		const auto nMillis = Hardware::Get()->Millis();
+
+		for (uint32_t j = 0; j < HOST_ANSWERS; j++) {
+			const auto reply = static_cast<HostReply>(1U << j);
+
+			if (((s_HostReplies & reply) == reply) && answer_is_rate_limited(s_HostAnswers[j], nMillis)) {
+				s_HostReplies = static_cast<HostReply>(static_cast<uint32_t>(s_HostReplies) & ~static_cast<uint32_t>(reply));
+			}
+		}
+
+		for (uint32_t nIndex = 0; nIndex < SERVICE_RECORDS_MAX; nIndex++) {
+			for (uint32_t j = 0; j < SERVICE_ANSWERS; j++) {
+				const auto reply = static_cast<ServiceReply>(static_cast<uint32_t>(ServiceReply::TYPE_PTR) << j);
+
+				if (((s_ServiceReplies[nIndex] & reply) == reply) && answer_is_rate_limited(s_ServiceAnswers[nIndex][j], nMillis)) {
+					s_ServiceReplies[nIndex] = static_cast<ServiceReply>(static_cast<uint32_t>(s_ServiceReplies[nIndex]) & ~static_cast<uint32_t>(reply));
 				}
 			}
 		}
 	}
 
+	for (uint32_t nIndex = 0; nIndex < SERVICE_RECORDS_MAX; nIndex++) {
+		if (s_ServiceReplies[nIndex] != static_cast<mdns::ServiceReply>(0)) {
+			SendMessage(nIndex, nTransactionID, MDNS_RESPONSE_TTL);
+		}
+	}
+
 	if (s_HostReplies != static_cast<mdns::HostReply>(0)) {
 		DEBUG_PUTS("");
 		SendAnswerLocalIpAddress(nTransactionID, MDNS_RESPONSE_TTL);
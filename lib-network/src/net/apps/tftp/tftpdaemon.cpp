@@ -25,10 +25,15 @@
 
 /*
  * https://tools.ietf.org/html/rfc1350
+ * https://tools.ietf.org/html/rfc2347 Option Extension
+ * https://tools.ietf.org/html/rfc2348 Blocksize Option
+ * https://tools.ietf.org/html/rfc7440 Windowsize Option
  */
 
 #include <cstdint>
+#include <cstdio>
 #include <cstring>
+#include <algorithm>
 #include <cassert>
 
 #include "net/apps/tftpdaemon.h"
@@ -42,7 +47,8 @@ enum TOpCode {
 	OP_CODE_WRQ = 2,			///< Write request (WRQ)
 	OP_CODE_DATA = 3,			///< Data (DATA)
 	OP_CODE_ACK = 4,			///< Acknowledgment (ACK)
-	OP_CODE_ERROR = 5			///< Error (ERROR)
+	OP_CODE_ERROR = 5,			///< Error (ERROR)
+	OP_CODE_OACK = 6			///< Option Acknowledgment (OACK)
 };
 
 enum TErrorCode {
@@ -53,7 +59,8 @@ enum TErrorCode {
 	ERROR_CODE_ILL_OPER = 4,	///< Illegal TFTP operation.
 	ERROR_CODE_INV_ID = 5,		///< Unknown transfer ID.
 	ERROR_CODE_EXISTS = 6,		///< File already exists.
-	ERROR_CODE_INV_USER = 7		///< No such user.
+	ERROR_CODE_INV_USER = 7,	///< No such user.
+	ERROR_CODE_OPTION = 8		///< Option negotiation failed.
 };
 
 namespace tftp {
@@ -61,6 +68,7 @@ static constexpr uint16_t UDP_PORT = 69;
 
 namespace min {
 	static constexpr auto FILENAME_MODE_LEN = (1 + 1 + 1 + 1);
+	static constexpr auto BLKSIZE = 8;
 }
 
 namespace max {
@@ -68,6 +76,8 @@ namespace max {
 	static constexpr auto MODE_LEN = 16;
 	static constexpr auto FILENAME_MODE_LEN = (FILENAME_LEN + 1 + MODE_LEN + 1);
 	static constexpr auto DATA_LEN = 512;
+	static constexpr auto BLKSIZE = 1468;	///< MTU 1500 - IPv4 header 20 - UDP header 8 - TFTP header 4
+	static constexpr auto WINDOWSIZE = 8;
 	static constexpr auto ERRMSG_LEN = 128;
 }
 
@@ -94,8 +104,32 @@ struct ErrorPacket {
 struct DataPacket {
 	uint16_t OpCode;
 	uint16_t BlockNumber;
-	uint8_t Data[max::DATA_LEN];
+	uint8_t Data[max::BLKSIZE];
 } PACKED;
+
+static const char *skip_string(const char *p, const char *pEnd) {
+	while (p < pEnd) {
+		if (*p++ == '\0') {
+			return p;
+		}
+	}
+
+	return nullptr;
+}
+
+static uint32_t to_uint(const char *p) {
+	uint32_t n = 0;
+
+	while ((*p >= '0') && (*p <= '9')) {
+		n = (n * 10) + static_cast<uint32_t>(*p++ - '0');
+
+		if (n > UINT16_MAX) {
+			break;
+		}
+	}
+
+	return n;
+}
 }  // namespace tftp
 
 TFTPDaemon *TFTPDaemon::s_pThis;
@@ -137,8 +171,15 @@ void TFTPDaemon::Run() {
 
 		m_nFromPort = tftp::UDP_PORT;
 		m_nBlockNumber = 0;
+		m_nBlockCount = 0;
+		m_nBlockSize = tftp::max::DATA_LEN;
+		m_nWindowSize = 1;
+		m_nWindowCount = 0;
 		m_nState = TFTPState::WAITING_RQ;
 		m_bIsLastBlock = false;
+		m_bHasOptions = false;
+		m_bIsGapAcked = false;
+		m_bIsStalled = false;
 	} else {
 		m_nLength = Network::Get()->RecvFrom(m_nIdx, const_cast<const void **>(reinterpret_cast<void **>(&m_pBuffer)), &m_nFromIp, &m_nFromPort);
 
@@ -156,10 +197,25 @@ void TFTPDaemon::Run() {
 				HandleRecvAck();
 			}
 			break;
-		case TFTPState::WRQ_RECV_PACKET:
-			if (m_nLength <= sizeof(struct tftp::DataPacket)) {
-				HandleRecvData();
+		case TFTPState::WRQ_RECV_PACKET: {
+			const auto isReady = FileWriteReady();
+
+			if ((m_nLength >= 4U) && (m_nLength <= (4U + m_nBlockSize))) {
+				if (isReady) {
+					m_bIsStalled = false;
+					HandleRecvData();
+				} else {
+					// Drop the block, the ACK is sent when the sink is ready again
+					m_bIsStalled = true;
+					m_bIsGapAcked = false;
+				}
+			} else if (m_bIsStalled && isReady) {
+				// The sender restarts the window after the last block written
+				m_bIsStalled = false;
+				m_nWindowCount = 0;
+				DoWriteAck();
 			}
+		}
 			break;
 		default:
 			assert(0);
@@ -180,20 +236,34 @@ void TFTPDaemon::HandleRequest() {
 		return;
 	}
 
+	const auto *pEnd = reinterpret_cast<const char *>(m_pBuffer) + m_nLength;
 	const char *const pFileName = pPacket->FileNameMode;
-	const auto nFileNameLength = strlen(pFileName);
+	const auto *pMode = tftp::skip_string(pFileName, pEnd);
+
+	if (pMode == nullptr) {
+		SendError(ERROR_CODE_OTHER, "Invalid file name");
+		return;
+	}
+
+	const auto nFileNameLength = static_cast<uint32_t>(pMode - pFileName - 1);
 
 	if (!(1 <= nFileNameLength && nFileNameLength <= tftp::max::FILENAME_LEN)) {
 		SendError(ERROR_CODE_OTHER, "Invalid file name");
 		return;
 	}
 
-	const char *const pMode = &pPacket->FileNameMode[nFileNameLength + 1];
+	const auto *pOptions = tftp::skip_string(pMode, pEnd);
+
+	if (pOptions == nullptr) {
+		SendError(ERROR_CODE_ILL_OPER, "Invalid operation");
+		return;
+	}
+
 	tftp::Mode mode;
 
-	if (strncmp(pMode, "octet", 5) == 0) {
+	if (strcasecmp(pMode, "octet") == 0) {
 		mode = tftp::Mode::BINARY;
-	} else if (strncmp(pMode, "netascii", 8) == 0) {
+	} else if (strcasecmp(pMode, "netascii") == 0) {
 		mode = tftp::Mode::ASCII;
 	} else {
 		SendError(ERROR_CODE_ILL_OPER, "Invalid operation");
@@ -202,6 +272,19 @@ void TFTPDaemon::HandleRequest() {
 
 	DEBUG_PRINTF("Incoming %s request from " IPSTR " %s %s", nOpCode == OP_CODE_RRQ ? "read" : "write", IP2STR(m_nFromIp), pFileName, pMode);
 
+	if (!ParseOptions(pOptions, pEnd, nOpCode)) {
+		SendError(ERROR_CODE_OPTION, "Invalid option");
+		return;
+	}
+
+	DEBUG_PRINTF("blksize=%u, windowsize=%u", m_nBlockSize, m_nWindowSize);
+
+	m_nBlockNumber = 0;
+	m_nBlockCount = 0;
+	m_nWindowCount = 0;
+	m_bIsGapAcked = false;
+	m_bIsStalled = false;
+
 	switch (nOpCode) {
 		case OP_CODE_RRQ:
 			if(!FileOpen(pFileName, mode)) {
@@ -210,8 +293,14 @@ void TFTPDaemon::HandleRequest() {
 			} else {
 				Network::Get()->End(tftp::UDP_PORT);
 				m_nIdx = Network::Get()->Begin(m_nFromPort);
-				m_nState = TFTPState::RRQ_SEND_PACKET;
-				DoRead();
+				if (m_bHasOptions) {
+					// The client acknowledges the OACK with block 0
+					SendOptionAck();
+					m_nState = TFTPState::RRQ_RECV_ACK;
+				} else {
+					m_nState = TFTPState::RRQ_SEND_PACKET;
+					DoRead();
+				}
 			}
 			break;
 		case OP_CODE_WRQ:
@@ -221,8 +310,14 @@ void TFTPDaemon::HandleRequest() {
 			} else {
 				Network::Get()->End(tftp::UDP_PORT);
 				m_nIdx = Network::Get()->Begin(m_nFromPort);
-				m_nState = TFTPState::WRQ_SEND_ACK;
-				DoWriteAck();
+				if (m_bHasOptions) {
+					// The OACK replaces the ACK of block 0
+					SendOptionAck();
+					m_nState = TFTPState::WRQ_RECV_PACKET;
+				} else {
+					m_nState = TFTPState::WRQ_SEND_ACK;
+					DoWriteAck();
+				}
 			}
 			break;
 		default:
@@ -232,6 +327,74 @@ void TFTPDaemon::HandleRequest() {
 	}
 }
 
+/**
+ * Only "blksize" and, for a write request, "windowsize" are supported.
+ * Unknown options are ignored, which declines them.
+ */
+bool TFTPDaemon::ParseOptions(const char *pOptions, const char *pEnd, const uint16_t nOpCode) {
+	m_nBlockSize = tftp::max::DATA_LEN;
+	m_nWindowSize = 1;
+
+	while (pOptions < pEnd) {
+		const auto *pValue = tftp::skip_string(pOptions, pEnd);
+
+		if (pValue == nullptr) {
+			break;
+		}
+
+		const auto *pNext = tftp::skip_string(pValue, pEnd);
+
+		if (pNext == nullptr) {
+			break;
+		}
+
+		const auto nValue = tftp::to_uint(pValue);
+
+		DEBUG_PRINTF("%s=%u", pOptions, nValue);
+
+		if (strcasecmp(pOptions, "blksize") == 0) {
+			if (nValue < tftp::min::BLKSIZE) {
+				return false;
+			}
+			m_nBlockSize = static_cast<uint16_t>(std::min(nValue, static_cast<uint32_t>(tftp::max::BLKSIZE)));
+		} else if ((strcasecmp(pOptions, "windowsize") == 0) && (nOpCode == OP_CODE_WRQ)) {
+			if (nValue == 0) {
+				return false;
+			}
+			m_nWindowSize = static_cast<uint16_t>(std::min(nValue, static_cast<uint32_t>(tftp::max::WINDOWSIZE)));
+		}
+
+		pOptions = pNext;
+	}
+
+	// A default value does not need to be acknowledged, the client falls back to it
+	m_bHasOptions = (m_nBlockSize != tftp::max::DATA_LEN) || (m_nWindowSize != 1);
+
+	return true;
+}
+
+void TFTPDaemon::SendOptionAck() {
+	auto *pOptionAck = reinterpret_cast<char *>(m_pBuffer);
+	assert(pOptionAck != nullptr);
+
+	const uint16_t nOpCode = __builtin_bswap16(OP_CODE_OACK);
+	memcpy(pOptionAck, &nOpCode, sizeof(uint16_t));
+
+	auto nLength = sizeof(uint16_t);
+
+	if (m_nBlockSize != tftp::max::DATA_LEN) {
+		nLength += 1U + static_cast<size_t>(snprintf(&pOptionAck[nLength], 16, "blksize%c%u", '\0', static_cast<unsigned int>(m_nBlockSize)));
+	}
+
+	if (m_nWindowSize != 1) {
+		nLength += 1U + static_cast<size_t>(snprintf(&pOptionAck[nLength], 16, "windowsize%c%u", '\0', static_cast<unsigned int>(m_nWindowSize)));
+	}
+
+	DEBUG_PRINTF("Sending OACK to " IPSTR ":%d", IP2STR(m_nFromIp), m_nFromPort);
+
+	Network::Get()->SendTo(m_nIdx, m_pBuffer, static_cast<uint32_t>(nLength), m_nFromIp, m_nFromPort);
+}
+
 void TFTPDaemon::SendError (const uint16_t nErrorCode, const char *pErrorMessage) {
 	tftp::ErrorPacket ErrorPacket;
 
@@ -247,13 +410,13 @@ void TFTPDaemon::DoRead() {
 	assert(pDataPacket != nullptr);
 
 	if (m_nState == TFTPState::RRQ_SEND_PACKET) {
-		m_nDataLength = FileRead(pDataPacket->Data, tftp::max::DATA_LEN, ++m_nBlockNumber);
+		m_nDataLength = FileRead(pDataPacket->Data, m_nBlockSize, ++m_nBlockNumber);
 
 		pDataPacket->OpCode = __builtin_bswap16(OP_CODE_DATA);
 		pDataPacket->BlockNumber = __builtin_bswap16(m_nBlockNumber);
 
 		m_nPacketLength = static_cast<uint16_t>(sizeof pDataPacket->OpCode + sizeof pDataPacket->BlockNumber + m_nDataLength);
-		m_bIsLastBlock = m_nDataLength < tftp::max::DATA_LEN;
+		m_bIsLastBlock = m_nDataLength < m_nBlockSize;
 
 		if (m_bIsLastBlock) {
 			FileClose();
@@ -296,27 +459,58 @@ void TFTPDaemon::DoWriteAck() {
 	Network::Get()->SendTo(m_nIdx, m_pBuffer, sizeof(struct tftp::AckPacket), m_nFromIp, m_nFromPort);
 }
 
+/**
+ * The blocks are passed to FileWrite once and in sequence.
+ * With a window size > 1 only the last block of a window is acknowledged.
+ */
 void TFTPDaemon::HandleRecvData() {
 	const auto *const pDataPacket = reinterpret_cast<struct tftp::DataPacket *>(m_pBuffer);
 	assert(pDataPacket != nullptr);
 
-	if (pDataPacket->OpCode == __builtin_bswap16(OP_CODE_DATA)) {
-		m_nDataLength = m_nLength - 4;
-		m_nBlockNumber = __builtin_bswap16(pDataPacket->BlockNumber);
+	if (pDataPacket->OpCode != __builtin_bswap16(OP_CODE_DATA)) {
+		return;
+	}
 
-		DEBUG_PRINTF("Incoming from " IPSTR ", m_nLength=%u, m_nBlockNumber=%d, m_nDataLength=%u", IP2STR(m_nFromIp), m_nLength, m_nBlockNumber, m_nDataLength);
+	const auto nBlockNumber = __builtin_bswap16(pDataPacket->BlockNumber);
+	const auto nDelta = static_cast<uint16_t>(nBlockNumber - m_nBlockNumber);
 
-		if (m_nDataLength == FileWrite(pDataPacket->Data, m_nDataLength, m_nBlockNumber)) {
+	if (nDelta != 1) {
+		// RFC 7440 4. Acknowledge the last block in sequence, the sender restarts the window from there.
+		// A block already written means that our ACK was lost; a gap is acknowledged once.
+		const auto isOld = (nDelta == 0) || (nDelta > 0x8000U);
 
-			if (m_nDataLength < tftp::max::DATA_LEN) {
-				m_bIsLastBlock = true;
-				FileClose();
-			}
+		DEBUG_PRINTF("BlockNumber=%u, m_nBlockNumber=%u", nBlockNumber, m_nBlockNumber);
 
+		if (isOld || !m_bIsGapAcked) {
+			m_bIsGapAcked = !isOld;
+			m_nWindowCount = 0;
 			DoWriteAck();
-		} else {
-			SendError(ERROR_CODE_DISK_FULL, "Write failed");
-			m_nState = TFTPState::INIT;
 		}
+		return;
+	}
+
+	m_bIsGapAcked = false;
+	m_nDataLength = m_nLength - 4;
+
+	DEBUG_PRINTF("Incoming from " IPSTR ", m_nLength=%u, nBlockNumber=%d, m_nDataLength=%u", IP2STR(m_nFromIp), m_nLength, nBlockNumber, m_nDataLength);
+
+	if (m_nDataLength != FileWrite(pDataPacket->Data, m_nDataLength, ++m_nBlockCount)) {
+		SendError(ERROR_CODE_DISK_FULL, "Write failed");
+		m_nState = TFTPState::INIT;
+		return;
+	}
+
+	m_nBlockNumber = nBlockNumber;
+
+	if (m_nDataLength < m_nBlockSize) {
+		m_bIsLastBlock = true;
+		FileClose();
+		DoWriteAck();
+		return;
+	}
+
+	if (++m_nWindowCount == m_nWindowSize) {
+		m_nWindowCount = 0;
+		DoWriteAck();
 	}
 }
@@ -60,9 +60,21 @@
 #include "debug.h"
 
 #if !defined ARP_MAX_RECORDS
-static constexpr auto MAX_RECORDS = 16;
+static constexpr uint32_t MAX_RECORDS = 64;
 #else
-static constexpr auto MAX_RECORDS = ARP_MAX_RECORDS;
+static constexpr uint32_t MAX_RECORDS = ARP_MAX_RECORDS;
+#endif
+
+#if !defined ARP_QUEUE_ENTRIES
+static constexpr uint32_t QUEUE_ENTRIES = 4;
+#else
+static constexpr uint32_t QUEUE_ENTRIES = ARP_QUEUE_ENTRIES;
+#endif
+
+#if !defined ARP_QUEUE_PER_RECORD
+static constexpr uint32_t QUEUE_PER_RECORD = 2;
+#else
+static constexpr uint32_t QUEUE_PER_RECORD = ARP_QUEUE_PER_RECORD;
 #endif
 
 namespace net {
@@ -76,13 +88,32 @@ static constexpr uint32_t MAX_PROBING 		= 2;			///< 2 * 1 second
 static constexpr uint32_t MAX_REACHABLE 	= (10 * 60);	///< (10 * 60) * 1 second = 10 minutes
 static constexpr uint32_t MAX_STALE 		= ( 5 * 60);	///< ( 5 * 60) * 1 second =  5 minutes
 
-enum class State {
+/*
+ * The cache is set associative: the IP address selects a set of WAYS records,
+ * only that set is searched and a replacement is chosen within that set.
+ */
+static constexpr uint32_t WAYS = 4;
+static constexpr uint32_t SETS = MAX_RECORDS / WAYS;
+static_assert((SETS != 0) && ((SETS & (SETS - 1)) == 0), "ARP_MAX_RECORDS must be a power of 2, at least 4");
+static constexpr uint32_t SET_SHIFT = 32U - static_cast<uint32_t>(__builtin_ctz(SETS));
+
+static constexpr uint8_t QUEUE_NONE = 0xFF;
+static_assert((QUEUE_ENTRIES != 0) && (QUEUE_ENTRIES < QUEUE_NONE), "ARP_QUEUE_ENTRIES must be 1..254");
+static_assert(QUEUE_PER_RECORD != 0, "ARP_QUEUE_PER_RECORD must be at least 1");
+
+enum class State : uint8_t {
 	STATE_EMPTY, STATE_PROBE, STATE_REACHABLE, STATE_STALE,
 };
 
+/*
+ * Packets waiting for a resolution are kept in a fixed pool.
+ * A free entry, or a queued entry of a record, is linked with nNext.
+ * The pool is in RAM, not in the .network section which shares RAM2 with the DMX and pixel buffers.
+ */
 struct Packet {
-	uint8_t *p;
-	uint32_t nSize;
+	uint8_t data[sizeof(struct t_udp)];
+	uint16_t nSize;
+	uint8_t nNext;
 #if defined CONFIG_ENET_ENABLE_PTP
 	bool isTimestamp;
 #endif
@@ -90,14 +121,18 @@ struct Packet {
 
 struct Record {
 	uint32_t nIp;
-	Packet packet;
 	uint8_t mac_address[ETH_ADDR_LEN];
 	uint16_t nAge;
 	State state;
+	uint8_t nQueueHead;		///< QUEUE_NONE when no packets are queued
+	uint8_t nQueueLength;
 };
 }  // namespace arp
 
 static net::arp::Record s_ArpRecords[MAX_RECORDS] SECTION_NETWORK ALIGNED;
+static net::arp::Packet s_ArpPackets[QUEUE_ENTRIES] ALIGNED;
+static uint8_t s_nArpPacketFree;
+static net::arp::Statistics s_ArpStatistics;
 
 static struct t_arp s_arp_request ALIGNED ;
 static struct t_arp s_arp_reply ALIGNED;
@@ -106,58 +141,93 @@ static struct t_arp s_arp_reply ALIGNED;
 static constexpr char STATE[4][12] = { "EMPTY", "PROBE", "REACHABLE", "STALE", };
 
 void static arp_cache_record_dump(net::arp::Record *pRecord) {
-	printf("%p %-4d %c " MACSTR " %-10s " IPSTR  "\n", pRecord, pRecord->nAge, pRecord->packet.p == nullptr ? '-' : 'Q' , MAC2STR(pRecord->mac_address), STATE[static_cast<unsigned>(pRecord->state)], IP2STR(pRecord->nIp));
+	printf("%p %-4d %d " MACSTR " %-10s " IPSTR  "\n", pRecord, pRecord->nAge, pRecord->nQueueLength, MAC2STR(pRecord->mac_address), STATE[static_cast<unsigned>(pRecord->state)], IP2STR(pRecord->nIp));
 }
 
 void static arp_cache_dump() {
 	uint32_t nIndex = 0;
 	for (auto &record : s_ArpRecords) {
-		printf("%p %02d %-4d" MACSTR " %-10s " IPSTR  "\n", &record, nIndex++, record.nAge, MAC2STR(record.mac_address), STATE[static_cast<unsigned>(record.state)], IP2STR(record.nIp));
-		if (nIndex ==6) {
-			return;
+		if (record.state != net::arp::State::STATE_EMPTY) {
+			printf("%p %02d %-4d" MACSTR " %-10s " IPSTR  "\n", &record, nIndex, record.nAge, MAC2STR(record.mac_address), STATE[static_cast<unsigned>(record.state)], IP2STR(record.nIp));
 		}
+		nIndex++;
 	}
+	printf("hits=%u misses=%u evictions=%u queued=%u dropped=%u\n", s_ArpStatistics.nHits, s_ArpStatistics.nMisses, s_ArpStatistics.nEvictions, s_ArpStatistics.nQueued, s_ArpStatistics.nDropped);
 }
 #else
 void static arp_cache_record_dump([[maybe_unused]] net::arp::Record *pRecord) {}
 void static arp_cache_dump() {}
 #endif
 
+/*
+ * Fibonacci hashing over the whole address in host byte order,
+ * the set is taken from the most significant bits of the product.
+ */
+static net::arp::Record *arp_set(const uint32_t nIp) {
+	if constexpr (net::arp::SETS == 1) {
+		return s_ArpRecords;
+	} else {
+		const auto nSet = (__builtin_bswap32(nIp) * 2654435761U) >> net::arp::SET_SHIFT;
+		return &s_ArpRecords[nSet * net::arp::WAYS];
+	}
+}
+
+static void arp_queue_free(net::arp::Record& record) {
+	while (record.nQueueHead != net::arp::QUEUE_NONE) {
+		const auto nIndex = record.nQueueHead;
+		record.nQueueHead = s_ArpPackets[nIndex].nNext;
+		s_ArpPackets[nIndex].nNext = s_nArpPacketFree;
+		s_nArpPacketFree = nIndex;
+	}
+
+	record.nQueueLength = 0;
+}
+
+static void arp_cache_clean_record(net::arp::Record& record) {
+	s_ArpStatistics.nDropped += record.nQueueLength;
+	arp_queue_free(record);
+
+	record.nIp = 0;
+	memset(record.mac_address, 0, ETH_ADDR_LEN);
+	record.nAge = 0;
+	record.state = net::arp::State::STATE_EMPTY;
+}
+
 static net::arp::Record *arp_find_record(const uint32_t nDestinationIp, [[maybe_unused]] const arp::Flags flag) {
 	DEBUG_ENTRY
 
+	auto *pSet = arp_set(nDestinationIp);
+	net::arp::Record *pEmpty = nullptr;
 	net::arp::Record *pStale = nullptr;
 	net::arp::Record *pReachable = nullptr;
 	uint32_t nAgeStale = 0;
 	uint32_t nAgeReachable = 0;
 
-	for (auto &record : s_ArpRecords) {
-		if (record.nIp == nDestinationIp) {
-			DEBUG_EXIT
-			return &record;
-		}
+	for (uint32_t i = 0; i < net::arp::WAYS; i++) {
+		auto &record = pSet[i];
 
-		if (flag == arp::Flags::FLAG_UPDATE) {
+		if (record.state == net::arp::State::STATE_EMPTY) {
+			if (pEmpty == nullptr) {
+				pEmpty = &record;
+			}
 			continue;
 		}
 
-		if (record.state == net::arp::State::STATE_EMPTY) {
-			record.nIp = nDestinationIp;
+		if (record.nIp == nDestinationIp) {
 			DEBUG_EXIT
 			return &record;
 		}
 
 		if (record.state == net::arp::State::STATE_REACHABLE) {
-			if (record.nAge > nAgeReachable) {
+			if (record.nAge >= nAgeReachable) {
 				nAgeReachable = record.nAge;
 				pReachable = &record;
 			}
 			continue;
 		}
 
-
 		if (record.state == net::arp::State::STATE_STALE) {
-			if (record.nAge > nAgeStale) {
+			if (record.nAge >= nAgeStale) {
 				nAgeStale = record.nAge;
 				pStale = &record;
 			}
@@ -165,18 +235,30 @@ static net::arp::Record *arp_find_record(const uint32_t nDestinationIp, [[maybe_
 		}
 	}
 
-	if (pStale != nullptr) {
+	if (flag == arp::Flags::FLAG_UPDATE) {
 		DEBUG_EXIT
-		return pStale;
+		return nullptr;
 	}
 
-	if (pReachable != nullptr) {
-		DEBUG_EXIT
-		return pReachable;
+	auto *pRecord = pEmpty;
+
+	if (pRecord == nullptr) {
+		pRecord = (pStale != nullptr) ? pStale : pReachable;
+
+		if (pRecord == nullptr) {
+			DEBUG_PUTS("All records in the set are probing");
+			DEBUG_EXIT
+			return nullptr;
+		}
+
+		s_ArpStatistics.nEvictions++;
+		arp_cache_clean_record(*pRecord);
 	}
 
+	pRecord->nIp = nDestinationIp;
+
 	DEBUG_EXIT
-	return nullptr;
+	return pRecord;
 }
 
 static void arp_cache_update(const uint8_t *pMacAddress, const uint32_t nIp, const arp::Flags flag) {
@@ -186,7 +268,6 @@ static void arp_cache_update(const uint8_t *pMacAddress, const uint32_t nIp, con
 	auto *record = arp_find_record(nIp, flag);
 
 	if (record == nullptr) {
-		assert(flag == arp::Flags::FLAG_UPDATE);
 		DEBUG_EXIT
 		return;
 	}
@@ -197,26 +278,27 @@ static void arp_cache_update(const uint8_t *pMacAddress, const uint32_t nIp, con
 
 	arp_cache_record_dump(record);
 
-	if (record->packet.p != nullptr) {
-		auto *udp = reinterpret_cast<struct t_udp *>(record->packet.p);
+	for (auto nIndex = record->nQueueHead; nIndex != net::arp::QUEUE_NONE; nIndex = s_ArpPackets[nIndex].nNext) {
+		auto &packet = s_ArpPackets[nIndex];
+		auto *udp = reinterpret_cast<struct t_udp *>(packet.data);
 		std::memcpy(udp->ether.dst, record->mac_address, ETH_ADDR_LEN);
 		udp->ip4.chksum = 0;
 #if !defined (CHECKSUM_BY_HARDWARE)
 		udp->ip4.chksum = net_chksum(reinterpret_cast<void *>(&udp->ip4), sizeof(udp->ip4));
 #endif
 #if defined CONFIG_ENET_ENABLE_PTP
-		if (!record->packet.isTimestamp) {
+		if (!packet.isTimestamp) {
 #endif
-			emac_eth_send(record->packet.p, record->packet.nSize);
+			emac_eth_send(packet.data, packet.nSize);
 #if defined CONFIG_ENET_ENABLE_PTP
 		} else {
-			emac_eth_send_timestamp(record->packet.p, record->packet.nSize);
+			emac_eth_send_timestamp(packet.data, packet.nSize);
 		}
 #endif
-		delete [] record->packet.p;
-		record->packet.p = nullptr;
 	}
 
+	arp_queue_free(*record);
+
 	DEBUG_EXIT
 }
 
@@ -232,9 +314,15 @@ template<net::arp::EthSend S>
 static void arp_query(const uint32_t nDestinationIp, struct t_udp *pPacket, const uint32_t nSize, [[maybe_unused]] const arp::Flags flag) {
 	DEBUG_ENTRY
 	DEBUG_PRINTF(IPSTR " %c", IP2STR(nDestinationIp), flag == arp::Flags::FLAG_UPDATE ? 'U' : 'I');
+	assert(nSize <= sizeof(net::arp::Packet::data));
 
 	auto *recordFound = arp_find_record(nDestinationIp, flag);
-	assert(recordFound != nullptr);
+
+	if (recordFound == nullptr) {
+		s_ArpStatistics.nDropped++;
+		DEBUG_EXIT
+		return;
+	}
 
 	arp_cache_record_dump(recordFound);
 
@@ -245,28 +333,49 @@ static void arp_query(const uint32_t nDestinationIp, struct t_udp *pPacket, cons
 	}
 
 	if (recordFound->state == net::arp::State::STATE_PROBE) {
-		if (recordFound->packet.p != nullptr) {
-			delete[] recordFound->packet.p;
+		uint8_t nIndex;
+
+		if (recordFound->nQueueLength == QUEUE_PER_RECORD) {
+			// The oldest packet makes room for the newest
+			nIndex = recordFound->nQueueHead;
+			recordFound->nQueueHead = s_ArpPackets[nIndex].nNext;
+			recordFound->nQueueLength--;
+			s_ArpStatistics.nDropped++;
+		} else if (s_nArpPacketFree != net::arp::QUEUE_NONE) {
+			nIndex = s_nArpPacketFree;
+			s_nArpPacketFree = s_ArpPackets[nIndex].nNext;
+		} else {
+			s_ArpStatistics.nDropped++;
+			DEBUG_EXIT
+			return;
 		}
 
-		recordFound->packet.p = new uint8_t[nSize];
-		assert(recordFound->packet.p != nullptr);
+		auto &packet = s_ArpPackets[nIndex];
 
-		net::memcpy(recordFound->packet.p, pPacket, nSize);
-		recordFound->packet.nSize = nSize;
+		net::memcpy(packet.data, pPacket, nSize);
+		packet.nSize = static_cast<uint16_t>(nSize);
+		packet.nNext = net::arp::QUEUE_NONE;
 #if defined CONFIG_ENET_ENABLE_PTP
-		recordFound->packet.isTimestamp = (S != net::arp::EthSend::IS_NORMAL);
+		packet.isTimestamp = (S != net::arp::EthSend::IS_NORMAL);
 #endif
-	}
 
-	DEBUG_EXIT
-}
+		if (recordFound->nQueueHead == net::arp::QUEUE_NONE) {
+			recordFound->nQueueHead = nIndex;
+		} else {
+			auto nTail = recordFound->nQueueHead;
 
-static void arp_cache_clean_record(net::arp::Record& record) {
-	if (record.packet.p != nullptr) {
-		delete[] record.packet.p;
+			while (s_ArpPackets[nTail].nNext != net::arp::QUEUE_NONE) {
+				nTail = s_ArpPackets[nTail].nNext;
+			}
+
+			s_ArpPackets[nTail].nNext = nIndex;
+		}
+
+		recordFound->nQueueLength++;
+		s_ArpStatistics.nQueued++;
 	}
-	memset(&record, 0, sizeof(struct net::arp::Record));
+
+	DEBUG_EXIT
 }
 
 static void arp_send_request_unicast(const uint32_t nIp, const uint8_t *pMacAddress) {
@@ -339,8 +448,16 @@ void __attribute__((cold)) arp_init() {
 
 	for (auto& record : s_ArpRecords) {
 		std::memset(&record, 0, sizeof(struct net::arp::Record));
+		record.nQueueHead = net::arp::QUEUE_NONE;
+	}
+
+	for (uint32_t nIndex = 0; nIndex < QUEUE_ENTRIES; nIndex++) {
+		s_ArpPackets[nIndex].nNext = (nIndex + 1 < QUEUE_ENTRIES) ? static_cast<uint8_t>(nIndex + 1) : net::arp::QUEUE_NONE;
 	}
 
+	s_nArpPacketFree = 0;
+	std::memset(&s_ArpStatistics, 0, sizeof(struct net::arp::Statistics));
+
 	// ARP Request template
 	// Ethernet header
 	std::memcpy(s_arp_request.ether.src, net::globals::netif_default.hwaddr, ETH_ADDR_LEN);
@@ -449,25 +566,30 @@ static void arp_send_implementation(struct t_udp *pPacket, const uint32_t nSize,
 		}
 	}
 
-	for (auto &record : s_ArpRecords) {
-		if (record.state >= net::arp::State::STATE_REACHABLE) {
-			if (record.nIp == nDestinationIp) {
-				std::memcpy(pPacket->ether.dst, record.mac_address, ETH_ADDR_LEN);
+	auto *pSet = arp_set(nDestinationIp);
 
-				if (S == net::arp::EthSend::IS_NORMAL) {
-					emac_eth_send(reinterpret_cast<void *>(pPacket), nSize);
-				}
+	for (uint32_t i = 0; i < net::arp::WAYS; i++) {
+		auto &record = pSet[i];
+
+		if ((record.nIp == nDestinationIp) && (record.state >= net::arp::State::STATE_REACHABLE)) {
+			s_ArpStatistics.nHits++;
+			std::memcpy(pPacket->ether.dst, record.mac_address, ETH_ADDR_LEN);
+
+			if (S == net::arp::EthSend::IS_NORMAL) {
+				emac_eth_send(reinterpret_cast<void *>(pPacket), nSize);
+			}
 #if defined CONFIG_ENET_ENABLE_PTP
-				else if (S == net::arp::EthSend::IS_TIMESTAMP) {
-					emac_eth_send_timestamp(reinterpret_cast<void *>(pPacket), nSize);
-				}
-#endif
-				DEBUG_EXIT
-				return;
+			else if (S == net::arp::EthSend::IS_TIMESTAMP) {
+				emac_eth_send_timestamp(reinterpret_cast<void *>(pPacket), nSize);
 			}
+#endif
+			DEBUG_EXIT
+			return;
 		}
 	}
 
+	s_ArpStatistics.nMisses++;
+
 	arp_query<S>(nDestinationIp, pPacket, nSize, arp::Flags::FLAG_INSERT);
 
 	DEBUG_EXIT
@@ -484,6 +606,10 @@ void arp_send_timestamp(struct t_udp *pPacket, const uint32_t nSize, const uint3
 }
 #endif
 
+const arp::Statistics& arp_statistics() {
+	return s_ArpStatistics;
+}
+
 /*
  *  The Sender IP is set to all zeros,
  *  which means it cannot map to the Sender MAC address.
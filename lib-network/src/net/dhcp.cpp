@@ -163,13 +163,24 @@ static void send_request() {
 
 	s_dhcp_message.options[k++] = dhcp::Options::OPTION_REQUESTED_IP;
 	s_dhcp_message.options[k++] = 0x04;
-	memcpy_ip(&s_dhcp_message.options[k], dhcp->offered.offered_ip_addr.addr);
-	k = k + 4;
 
-	s_dhcp_message.options[k++] = dhcp::Options::OPTION_SERVER_IDENTIFIER;
-	s_dhcp_message.options[k++] = 0x04;
-	memcpy_ip(&s_dhcp_message.options[k], dhcp->server_ip_addr.addr);
-	k = k + 4;
+	if (dhcp->state == dhcp::State::STATE_REBOOTING) {
+		/*
+		 * INIT-REBOOT: the address is the one we were using, the offer is cleared by every received message.
+		 * RFC 2131, 4.3.2: 'server identifier' MUST NOT be filled in.
+		 */
+		const auto nIp = net::globals::netif_default.ip.addr;
+		memcpy_ip(&s_dhcp_message.options[k], (nIp != 0) ? nIp : dhcp->offered.offered_ip_addr.addr);
+		k = k + 4;
+	} else {
+		memcpy_ip(&s_dhcp_message.options[k], dhcp->offered.offered_ip_addr.addr);
+		k = k + 4;
+
+		s_dhcp_message.options[k++] = dhcp::Options::OPTION_SERVER_IDENTIFIER;
+		s_dhcp_message.options[k++] = 0x04;
+		memcpy_ip(&s_dhcp_message.options[k], dhcp->server_ip_addr.addr);
+		k = k + 4;
+	}
 
 	s_dhcp_message.options[k++] = dhcp::Options::OPTION_HOSTNAME;
 	s_dhcp_message.options[k++] = 0; // length of hostname
@@ -391,7 +402,10 @@ static void dhcp_conflict_callback(net::acd::Callback callback) {
 
 	switch (callback) {
 	case net::acd::Callback::ACD_IP_OK:
-		dhcp_bind();
+		/* When checking in the background, the address is already bound */
+		if (dhcp->state == dhcp::State::STATE_CHECKING) {
+			dhcp_bind();
+		}
 		break;
 	case net::acd::Callback::ACD_RESTART_CLIENT:
 		/* wait 10s before restarting
@@ -406,6 +420,8 @@ static void dhcp_conflict_callback(net::acd::Callback callback) {
 		dhcp->request_timeout = static_cast<uint16_t>((msecs + dhcp::DHCP_FINE_TIMER_MSECS - 1) / dhcp::DHCP_FINE_TIMER_MSECS);
 		break;
 	case net::acd::Callback::ACD_DECLINE:
+		/* set this before removing the address, so the callback knows the lease is gone */
+		dhcp_set_state(dhcp, dhcp::State::STATE_BACKING_OFF);
 		/* remove IP address from interface
 		 * (prevents routing from selecting this interface) */
 		ip4_addr_t any;
@@ -430,6 +446,22 @@ static void dhcp_check() {
 
 	DEBUG_EXIT
 }
+
+/**
+ * The address is already in use on the interface (remembered lease or
+ * INIT-REBOOT). Output keeps running while ACD probes and announces;
+ * a conflict is handled by dhcp_conflict_callback as usual.
+ */
+static void dhcp_check_in_background() {
+	DEBUG_ENTRY
+	auto *dhcp = reinterpret_cast<struct dhcp::Dhcp *>(globals::netif_default.dhcp);
+
+	if ((dhcp->acd.state == acd::State::ACD_STATE_OFF) || (dhcp->acd.ipaddr.addr != globals::netif_default.ip.addr)) {
+		acd_start(&dhcp->acd, globals::netif_default.ip);
+	}
+
+	DEBUG_EXIT
+}
 #endif
 
 static void dhcp_discover() {
@@ -511,6 +543,15 @@ static void dhcp_timeout() {
 		if (dhcp->tries < REBOOT_TRIES) {
 			dhcp_reboot();
 		} else {
+			/* The remembered lease is not confirmed, it is no longer used */
+#if defined (CONFIG_NET_DHCP_USE_ACD)
+			acd_stop(&dhcp->acd);
+#endif
+			if (globals::netif_default.ip.addr != 0) {
+				ip4_addr_t any;
+				any.addr = 0;
+				netif_set_addr(any, any, any);
+			}
 			dhcp_discover();
 		}
 	}
@@ -573,10 +614,38 @@ void dhcp_coarse_tmr() {
     }
 }
 
+/**
+ * Start using the remembered lease while the INIT-REBOOT request is outstanding.
+ * This is done from the timer, as the address change callback expects the
+ * application to be fully constructed.
+ */
+static void dhcp_use_remembered_lease() {
+	DEBUG_ENTRY
+	auto *dhcp = reinterpret_cast<struct dhcp::Dhcp *>(globals::netif_default.dhcp);
+
+	dhcp->flags &= static_cast<uint8_t>(~DHCP_FLAG_REMEMBERED_LEASE);
+
+	if ((dhcp->state != dhcp::State::STATE_REBOOTING) || (dhcp->offered.offered_ip_addr.addr == 0)) {
+		DEBUG_EXIT
+		return;
+	}
+
+	netif_set_addr(dhcp->offered.offered_ip_addr, dhcp->offered.offered_sn_mask, dhcp->offered.offered_gw_addr);
+
+#if defined (CONFIG_NET_DHCP_USE_ACD)
+	dhcp_check_in_background();
+#endif
+
+	DEBUG_EXIT
+}
+
 static void dhcp_fine_tmr() {
 	auto *dhcp = reinterpret_cast<struct dhcp::Dhcp *>(globals::netif_default.dhcp);
 
 	if (dhcp != nullptr) {
+		if (__builtin_expect((dhcp->flags & DHCP_FLAG_REMEMBERED_LEASE), 0)) {
+			dhcp_use_remembered_lease();
+		}
 		/* timer is active (non zero), and is about to trigger now */
 		if (dhcp->request_timeout > 1) {
 			dhcp->request_timeout--;
@@ -636,6 +705,10 @@ static void dhcp_handle_nak() {
 	DEBUG_ENTRY
 	auto *dhcp = reinterpret_cast<struct dhcp::Dhcp *>(globals::netif_default.dhcp);
 
+#if defined (CONFIG_NET_DHCP_USE_ACD)
+	// A background check of the remembered lease must not announce an address which is no longer ours
+	acd_stop(&dhcp->acd);
+#endif
 	// Change to a defined state - set this before assigning the address
 	// to ensure the callback can use dhcp_supplied_address()
 	dhcp_set_state(dhcp, dhcp::State::STATE_BACKING_OFF);
@@ -649,8 +722,15 @@ static void dhcp_handle_nak() {
 	DEBUG_EXIT
 }
 
-bool dhcp_start() {
+/**
+ * Start with the lease remembered from a previous boot, or with DISCOVER when ipaddr is 0.
+ * The lease is confirmed with INIT-REBOOT instead of a full DISCOVER/OFFER exchange,
+ * and is used on the interface without waiting for the server.
+ */
+bool dhcp_start(const ip4_addr_t ipaddr, const ip4_addr_t netmask, const ip4_addr_t gw) {
 	DEBUG_ENTRY
+	DEBUG_PRINTF(IPSTR " " IPSTR " " IPSTR, IP2STR(ipaddr.addr), IP2STR(netmask.addr), IP2STR(gw.addr));
+
 	auto *dhcp = reinterpret_cast<struct dhcp::Dhcp *>(globals::netif_default.dhcp);
 
 	if (dhcp == nullptr) {
@@ -679,17 +759,32 @@ bool dhcp_start() {
 	acd_add(&dhcp->acd, dhcp_conflict_callback);
 #endif
 
+	dhcp->offered.offered_ip_addr.addr = ipaddr.addr;
+	dhcp->offered.offered_sn_mask.addr = netmask.addr;
+	dhcp->offered.offered_gw_addr.addr = gw.addr;
+
 	if (!netif_is_link_up()) {
 		dhcp_set_state(dhcp, dhcp::State::STATE_INIT);
 		return false;
 	}
 
-	dhcp_discover();
+	if (ipaddr.addr != 0) {
+		dhcp->flags |= DHCP_FLAG_REMEMBERED_LEASE;
+		dhcp_reboot();
+	} else {
+		dhcp_discover();
+	}
 
 	DEBUG_EXIT
 	return true;
 }
 
+bool dhcp_start() {
+	ip4_addr_t any;
+	any.addr = 0;
+	return dhcp_start(any, any, any);
+}
+
 void dhcp_release_and_stop() {
 	DEBUG_ENTRY
 	auto *dhcp = reinterpret_cast<struct dhcp::Dhcp *>(globals::netif_default.dhcp);
@@ -726,6 +821,9 @@ void dhcp_release_and_stop() {
 	}
 
 #if defined (CONFIG_NET_DHCP_USE_ACD)
+	if (dhcp->acd.state != acd::State::ACD_STATE_OFF) {
+		acd_stop(&dhcp->acd);
+	}
 	acd_remove(&dhcp->acd);
 #endif
 
@@ -752,6 +850,16 @@ void dhcp_network_changed_link_up() {
 		break;
 	case dhcp::State::STATE_OFF:
 		break;
+	case dhcp::State::STATE_INIT:
+		dhcp->tries = 0;
+		/* Link was down at start, a remembered lease is still in the offer */
+		if (dhcp->offered.offered_ip_addr.addr != 0) {
+			dhcp->flags |= DHCP_FLAG_REMEMBERED_LEASE;
+			dhcp_reboot();
+		} else {
+			dhcp_discover();
+		}
+		break;
 	default:
 		dhcp->tries = 0;
 		dhcp_discover();
@@ -847,7 +955,13 @@ void dhcp_process(const dhcp::Message *const pResponse, const uint32_t nSize) {
 				(dhcp->state == dhcp::State::STATE_REBOOTING)) {
 			dhcp_handle_ack(pResponse);
 #if defined (CONFIG_NET_DHCP_USE_ACD)
-			dhcp_check();
+			if (dhcp->offered.offered_ip_addr.addr == globals::netif_default.ip.addr) {
+				/* Already in use (remembered lease, link up again): do not stop the output */
+				dhcp_bind();
+				dhcp_check_in_background();
+			} else {
+				dhcp_check();
+			}
 #else
 			dhcp_bind();
 #endif
@@ -131,7 +131,8 @@ void __attribute__((cold)) net_init(const net::Link link, ip4_addr_t ipaddr, ip4
 		net::netif_set_flags(net::netif::NETIF_FLAG_LINK_UP);
 
 		if (bUseDhcp) {
-			dhcp_start();
+			/* ipaddr is the remembered lease, if any */
+			dhcp_start(ipaddr, netmask, gw);
 		} else {
 //			if (ipaddr.addr == 0) {
 //				net_set_secondary_ip();
@@ -27,6 +27,12 @@
  * Disclaimer: This code has implemented the server side only.
  * Server side states:
  * LISTEN -> ESTABLISHED -> CLOSE_WAIT -> LAST_ACK -> CLOSED:LISTEN
+ * Active close (tcp_close or idle timeout):
+ * ESTABLISHED -> FIN_WAIT_1 -> FIN_WAIT_2 -> CLOSED:LISTEN
+ * There is no TIME_WAIT, the TCB is returned to LISTEN.
+ * Sent data is kept until it is acknowledged: retransmission timer (RFC 6298)
+ * and fast retransmit (RFC 5681). There is no congestion window, only the peer's
+ * receive window limits the number of segments in flight.
  */
 
 #if defined (DEBUG_NET_TCP)
@@ -60,12 +66,32 @@
 #include "debug.h"
 
 namespace net {
+/*
+ * The receive queue is shared by the connections of a port. The application reads a
+ * segment in the same superloop pass it arrives, and a request fits in one segment.
+ * So 2 entries (one free while the other is read) are enough, each more costs an MSS of RAM.
+ * A segment which does not fit is not acknowledged, the peer retransmits it.
+ */
 #define TCP_RX_MSS						(TCP_DATA_SIZE)
 #define TCP_RX_MAX_ENTRIES				(1U << 1) // Must always be a power of 2
 #define TCP_RX_MAX_ENTRIES_MASK			(TCP_RX_MAX_ENTRIES - 1)
 #define TCP_MAX_RX_WND 					(TCP_RX_MAX_ENTRIES * TCP_RX_MSS);
 #define TCP_TX_MSS						(TCP_DATA_SIZE)
 
+static constexpr uint32_t TCP_IDLE_TIMEOUT_MILLIS = TCP_IDLE_TIMEOUT_SECONDS * 1000U;
+static constexpr uint32_t TCP_RECLAIM_MILLIS = 1000U;	///< Minimum idle time before a TCB is taken for a new connection
+static constexpr uint32_t TCP_TIMER_MILLIS = 10U;		///< Interval of the retransmission timer check
+static constexpr uint32_t TCP_DEFAULT_MSS = 536U;		///< RFC 9293 3.7.1, when there is no MSS option
+/*
+ * RFC 6298 Computing TCP's Retransmission Timer
+ * The minimum RTO is lowered from 1s, as we are on a local network.
+ */
+static constexpr uint32_t TCP_RTO_INITIAL_MILLIS = 1000U;
+static constexpr uint32_t TCP_RTO_MIN_MILLIS = 200U;
+static constexpr uint32_t TCP_RTO_MAX_MILLIS = 4000U;
+static constexpr uint8_t TCP_MAX_RETRANSMITS = 5;
+static constexpr uint8_t TCP_DUPACK_THRESHOLD = 3;		///< RFC 5681 3.2 Fast Retransmit
+
 /**
  * Transmission control block (TCB)
  */
@@ -101,6 +127,18 @@ struct tcb {
 		uint16_t size;
 	} TX;
 
+	/* Retransmission */
+	struct {
+		uint32_t nMillis;	/* retransmission timer started */
+		uint32_t nRTO;		/* retransmission timeout */
+		uint32_t nSRTT;		/* smoothed round-trip time, scaled by 8 */
+		uint32_t nRTTVAR;	/* round-trip time variation, scaled by 4 */
+		uint8_t nDupAcks;
+		uint8_t nFinRetransmits;
+		bool isFinPending;	/* tcp_close with data still queued */
+		bool isFinSent;		/* the FIN is sent, it is acknowledged when SND.UNA == SND.NXT */
+	} RTX;
+
 	/* Receive Sequence Variables */
 	struct {
 		uint32_t NXT; 	/* receive next */
@@ -110,6 +148,8 @@ struct tcb {
 
 	uint32_t IRS;		/* initial receive sequence number */
 
+	uint32_t nMillis;	/* last activity */
+
 	uint8_t state;
 };
 
@@ -137,7 +177,26 @@ struct Port {
 	uint16_t nLocalPort;
 };
 
+/**
+ * A segment is kept until it is acknowledged.
+ * The entries are shared by all connections, pTCB is nullptr for a free entry.
+ * The last free entry is kept for a connection without queued data,
+ * so a slow peer cannot take all entries.
+ */
+struct TransmitEntry {
+	uint8_t data[TCP_TX_MSS];
+	struct tcb *pTCB;
+	uint32_t SEQ;
+	uint32_t nMillis;		/* last (re)transmission */
+	uint16_t nSize;
+	uint8_t CTL;
+	uint8_t nRetransmits;
+	bool isSent;
+};
+
 static struct Port s_Port[TCP_MAX_PORTS_ALLOWED] SECTION_NETWORK ALIGNED;
+static struct TransmitEntry s_TransmitQueue[TCP_TX_MAX_ENTRIES] SECTION_NETWORK ALIGNED;
+static uint32_t s_nMillisTimer;
 static uint16_t s_id SECTION_NETWORK ALIGNED;
 static struct t_tcp s_tcp SECTION_NETWORK ALIGNED;
 
@@ -306,7 +365,17 @@ static void _bswap32(struct t_tcp *p_tcp) {
 	memcpy(&p_tcp->tcp.seqnum, src.u8, 4);
 }
 
+static void _free_transmit_entries(const struct tcb *pTcb) {
+	for (auto& entry : s_TransmitQueue) {
+		if (entry.pTCB == pTcb) {
+			entry.pTCB = nullptr;
+		}
+	}
+}
+
 static void _init_tcb(struct tcb *pTcb, const uint16_t nLocalPort) {
+	_free_transmit_entries(pTcb);
+
 	memset(pTcb, 0, sizeof(struct tcb));
 
 	pTcb->nLocalPort = nLocalPort;
@@ -319,6 +388,8 @@ static void _init_tcb(struct tcb *pTcb, const uint16_t nLocalPort) {
 	pTcb->SND.NXT = pTcb->ISS;
 	pTcb->SND.WL2 = pTcb->ISS;
 
+	pTcb->RTX.nRTO = TCP_RTO_INITIAL_MILLIS;
+
 	NEW_STATE(pTcb, STATE_LISTEN);
 }
 
@@ -548,25 +619,307 @@ static void scan_options(struct t_tcp *pTcp, struct tcb *pTcb, const int32_t nDa
 	}
 }
 
+/**
+ * The FIN takes one sequence number, it is retransmitted until it is acknowledged.
+ */
+static void send_fin(struct tcb *pTcb) {
+	SendInfo info;
+	info.SEQ = pTcb->RTX.isFinSent ? (pTcb->SND.NXT - 1) : pTcb->SND.NXT;
+	info.ACK = pTcb->RCV.NXT;
+	info.CTL = Control::FIN | Control::ACK;
+
+	send_package(pTcb, info);
+
+	if (!pTcb->RTX.isFinSent) {
+		pTcb->RTX.isFinSent = true;
+		pTcb->SND.NXT++;
+	}
+}
+
+/*
+ * Send queue and retransmission
+ * https://www.rfc-editor.org/rfc/rfc6298.html
+ * https://www.rfc-editor.org/rfc/rfc5681.html#section-3.2
+ */
+
+static uint32_t _send_mss(const struct tcb *pTCB) {
+	if (pTCB->SendMSS == 0) {
+		return TCP_DEFAULT_MSS;
+	}
+
+	return std::min(static_cast<uint32_t>(pTCB->SendMSS), static_cast<uint32_t>(TCP_TX_MSS));
+}
+
+static struct TransmitEntry *_oldest_entry(const struct tcb *pTCB, const bool isSent) {
+	struct TransmitEntry *pOldest = nullptr;
+
+	for (auto& entry : s_TransmitQueue) {
+		if ((entry.pTCB == pTCB) && (entry.isSent == isSent)) {
+			if ((pOldest == nullptr) || SEQ_LT(entry.SEQ, pOldest->SEQ)) {
+				pOldest = &entry;
+			}
+		}
+	}
+
+	return pOldest;
+}
+
+static struct TransmitEntry *_newest_entry(const struct tcb *pTCB) {
+	struct TransmitEntry *pNewest = nullptr;
+
+	for (auto& entry : s_TransmitQueue) {
+		if (entry.pTCB == pTCB) {
+			if ((pNewest == nullptr) || SEQ_GT(entry.SEQ, pNewest->SEQ)) {
+				pNewest = &entry;
+			}
+		}
+	}
+
+	return pNewest;
+}
+
+static void _send_entry(struct tcb *pTCB, struct TransmitEntry *pEntry, const uint32_t nMillis) {
+	pTCB->TX.data = pEntry->data;
+	pTCB->TX.size = pEntry->nSize;
+
+	SendInfo info;
+	info.SEQ = pEntry->SEQ;
+	info.ACK = pTCB->RCV.NXT;
+	info.CTL = pEntry->CTL;
+
+	send_package(pTCB, info);
+
+	pTCB->TX.data = nullptr;
+	pTCB->TX.size = 0;
+
+	pEntry->nMillis = nMillis;
+}
+
+/**
+ * Send the queued segments which fit in the send window.
+ * A pending FIN is sent when all queued segments are sent.
+ */
+static void _output(struct tcb *pTCB) {
+	const auto nMillis = Hardware::Get()->Millis();
+	struct TransmitEntry *pEntry;
+
+	while ((pEntry = _oldest_entry(pTCB, false)) != nullptr) {
+		const auto isIdle = (pTCB->SND.NXT == pTCB->SND.UNA);
+
+		if (isIdle) {
+			// RFC 6298 5.1, also the zero window probe timer when the segment does not fit
+			pTCB->RTX.nMillis = nMillis;
+		}
+
+		if (SEQ_GT(pEntry->SEQ + pEntry->nSize, pTCB->SND.UNA + pTCB->SND.WND)) {
+			DEBUG_PRINTF("SND.WND=%u -> wait", pTCB->SND.WND);
+			return;
+		}
+
+		_send_entry(pTCB, pEntry, nMillis);
+
+		pEntry->isSent = true;
+		pTCB->SND.NXT = pEntry->SEQ + pEntry->nSize;
+		pTCB->nMillis = nMillis;
+	}
+
+	if (pTCB->RTX.isFinPending) {
+		if (pTCB->SND.NXT == pTCB->SND.UNA) {
+			pTCB->RTX.nMillis = nMillis;
+		}
+
+		pTCB->RTX.isFinPending = false;
+		send_fin(pTCB);
+		NEW_STATE(pTCB, (pTCB->state == STATE_CLOSE_WAIT) ? STATE_LAST_ACK : STATE_FIN_WAIT_1);
+		pTCB->nMillis = nMillis;
+	}
+}
+
+/**
+ * The FIN is queued after the data, like data.
+ */
+static void _close(struct tcb *pTCB) {
+	pTCB->RTX.isFinPending = true;
+	_output(pTCB);
+}
+
+static void _rtt_measurement(struct tcb *pTCB, const uint32_t nRTT) {
+	if (pTCB->RTX.nSRTT == 0) {
+		// RFC 6298 2.2 first measurement: SRTT = R, RTTVAR = R/2
+		pTCB->RTX.nSRTT = nRTT << 3;
+		pTCB->RTX.nRTTVAR = nRTT << 1;
+	} else {
+		// RFC 6298 2.3 RTTVAR = 3/4 * RTTVAR + 1/4 * |SRTT - R|, SRTT = 7/8 * SRTT + 1/8 * R
+		const auto nSRTT = pTCB->RTX.nSRTT >> 3;
+		const auto nDelta = (nRTT > nSRTT) ? (nRTT - nSRTT) : (nSRTT - nRTT);
+		pTCB->RTX.nRTTVAR = pTCB->RTX.nRTTVAR - (pTCB->RTX.nRTTVAR >> 2) + nDelta;
+		pTCB->RTX.nSRTT = pTCB->RTX.nSRTT - nSRTT + nRTT;
+	}
+
+	// RTO = SRTT + max (G, K*RTTVAR), with G = 1ms
+	const auto nRTO = (pTCB->RTX.nSRTT >> 3) + std::max(static_cast<uint32_t>(1), pTCB->RTX.nRTTVAR);
+	pTCB->RTX.nRTO = std::min(std::max(nRTO, TCP_RTO_MIN_MILLIS), TCP_RTO_MAX_MILLIS);
+
+	DEBUG_PRINTF("R=%u, SRTT=%u, RTTVAR=%u, RTO=%u", nRTT, pTCB->RTX.nSRTT >> 3, pTCB->RTX.nRTTVAR >> 2, pTCB->RTX.nRTO);
+}
+
+/**
+ * SND.UNA has advanced: release the acknowledged segments
+ */
+static void _acknowledge(struct tcb *pTCB, const uint32_t SEG_ACK) {
+	const auto nMillis = Hardware::Get()->Millis();
+	auto hasMeasurement = false;
+	uint32_t nRTT = 0;
+
+	for (auto& entry : s_TransmitQueue) {
+		if ((entry.pTCB == pTCB) && entry.isSent && SEQ_LEQ(entry.SEQ + entry.nSize, SEG_ACK)) {
+			// Karn's algorithm: no measurement from a retransmitted segment
+			if (entry.nRetransmits == 0) {
+				nRTT = nMillis - entry.nMillis;
+				hasMeasurement = true;
+			}
+
+			entry.pTCB = nullptr;
+		}
+	}
+
+	if (hasMeasurement) {
+		_rtt_measurement(pTCB, nRTT);
+	}
+
+	pTCB->RTX.nDupAcks = 0;
+	pTCB->RTX.nMillis = nMillis;	// RFC 6298 5.3
+}
+
+/**
+ * @return false when the connection is reset
+ */
+static bool _retransmit(struct tcb *pTCB, const uint32_t nMillis) {
+	auto *pEntry = _oldest_entry(pTCB, true);
+	const auto isFin = (pEntry == nullptr) && pTCB->RTX.isFinSent && (pTCB->SND.UNA != pTCB->SND.NXT);
+
+	if ((pEntry == nullptr) && !isFin) {
+		return true;
+	}
+
+	if ((isFin ? pTCB->RTX.nFinRetransmits : pEntry->nRetransmits) == TCP_MAX_RETRANSMITS) {
+		DEBUG_PUTS("Too many retransmissions -> reset");
+
+		SendInfo info;
+		info.SEQ = pTCB->SND.NXT;
+		info.ACK = pTCB->RCV.NXT;
+		info.CTL = Control::RST | Control::ACK;
+
+		send_package(pTCB, info);
+
+		_init_tcb(pTCB, pTCB->nLocalPort);
+		return false;
+	}
+
+	if (isFin) {
+		pTCB->RTX.nFinRetransmits++;
+		send_fin(pTCB);
+		pTCB->RTX.nMillis = nMillis;
+
+		DEBUG_PRINTF("Retransmit FIN [%u]", pTCB->RTX.nFinRetransmits);
+		return true;
+	}
+
+	pEntry->nRetransmits++;
+	_send_entry(pTCB, pEntry, nMillis);
+	pTCB->RTX.nMillis = nMillis;
+
+	DEBUG_PRINTF("Retransmit SEQ=%u [%u]", pEntry->SEQ, pEntry->nRetransmits);
+	return true;
+}
+
+static void _retransmission_timer(struct tcb *pTCB, const uint32_t nMillis) {
+	if ((nMillis - pTCB->RTX.nMillis) < pTCB->RTX.nRTO) {
+		return;
+	}
+
+	if ((_oldest_entry(pTCB, true) != nullptr) || (pTCB->RTX.isFinSent && (pTCB->SND.UNA != pTCB->SND.NXT))) {
+		if (!_retransmit(pTCB, nMillis)) {
+			return;
+		}
+	} else {
+		// Zero window probe: send the first queued segment regardless of the window
+		auto *pEntry = _oldest_entry(pTCB, false);
+
+		if (pEntry == nullptr) {
+			return;
+		}
+
+		_send_entry(pTCB, pEntry, nMillis);
+
+		pEntry->isSent = true;
+		pTCB->SND.NXT = pEntry->SEQ + pEntry->nSize;
+		pTCB->RTX.nMillis = nMillis;
+	}
+
+	// RFC 6298 5.5 back off the timer
+	pTCB->RTX.nRTO = std::min(pTCB->RTX.nRTO * 2, TCP_RTO_MAX_MILLIS);
+}
+
 __attribute__((hot)) void tcp_run() {
+	const auto nMillis = Hardware::Get()->Millis();
+
 	for (auto& port : s_Port) {
 		for (auto& tcb : port.TCB) {
-			if (tcb.state == STATE_CLOSE_WAIT) {
-				SendInfo info;
-				info.SEQ = tcb.SND.NXT;
-				info.ACK = tcb.RCV.NXT;
-				info.CTL = Control::FIN | Control::ACK;
-
-				send_package(&tcb, info);
-
-				NEW_STATE(&tcb, STATE_LAST_ACK);
+			switch (tcb.state) {
+			case STATE_ESTABLISHED:
+			case STATE_CLOSE_WAIT:
+			case STATE_FIN_WAIT_1:
+			case STATE_CLOSING:
+			case STATE_LAST_ACK:
+				_retransmission_timer(&tcb, nMillis);
+				break;
+			default:
+				break;
+			}
 
-				tcb.SND.NXT++;
+			switch (tcb.state) {
+			case STATE_CLOSE_WAIT:
+				if (!tcb.RTX.isFinPending) {
+					_close(&tcb);
+				}
+				break;
+			case STATE_ESTABLISHED:
+				if (((nMillis - tcb.nMillis) > TCP_IDLE_TIMEOUT_MILLIS) && (_newest_entry(&tcb) == nullptr)) {
+					DEBUG_PUTS("Idle -> FIN_WAIT_1");
+					_close(&tcb);
+				}
+				break;
+			case STATE_SYN_RECEIVED:
+			case STATE_FIN_WAIT_1:
+			case STATE_FIN_WAIT_2:
+			case STATE_CLOSING:
+			case STATE_LAST_ACK:
+			case STATE_TIME_WAIT:
+				if ((nMillis - tcb.nMillis) > TCP_IDLE_TIMEOUT_MILLIS) {
+					DEBUG_PUTS("Timeout -> LISTEN");
+					_init_tcb(&tcb, tcb.nLocalPort);
+				}
+				break;
+			default:
+				break;
 			}
 		}
 	}
 }
 
+void tcp_timer() {
+	const auto nMillis = Hardware::Get()->Millis();
+
+	if (__builtin_expect(((nMillis - s_nMillisTimer) < TCP_TIMER_MILLIS), 1)) {
+		return;
+	}
+
+	s_nMillisTimer = nMillis;
+
+	tcp_run();
+}
+
 static bool find_matching_tcb(const t_tcp *pTcp, const uint32_t nIndexPort, uint32_t& nIndexTCB) {
     for (nIndexTCB = 0; nIndexTCB < TCP_MAX_TCBS_ALLOWED; nIndexTCB++) {
         auto *pTCB = &s_Port[nIndexPort].TCB[nIndexTCB];
@@ -596,6 +949,62 @@ static bool find_available_tcb(const uint32_t nIndexPort, uint32_t& nIndexTCB) {
     return false;
 }
 
+/**
+ * All TCBs are in use: take the one which is idle for the longest time,
+ * so that idle keep-alive connections cannot starve new clients.
+ */
+static bool reclaim_tcb(const uint32_t nIndexPort, uint32_t& nIndexTCB) {
+	const auto nMillis = Hardware::Get()->Millis();
+	const auto *pQueue = &s_Port[nIndexPort].receiveQueue;
+	uint32_t nIdleMax = TCP_RECLAIM_MILLIS;
+	uint32_t nIndexReclaim = TCP_MAX_TCBS_ALLOWED;
+
+	for (nIndexTCB = 0; nIndexTCB < TCP_MAX_TCBS_ALLOWED; nIndexTCB++) {
+		const auto *pTCB = &s_Port[nIndexPort].TCB[nIndexTCB];
+		const auto nIdle = nMillis - pTCB->nMillis;
+
+		if (nIdle < nIdleMax) {
+			continue;
+		}
+
+		auto isQueued = false;
+
+		for (auto nEntry = pQueue->nTail; nEntry != pQueue->nHead; nEntry = (nEntry + 1) & TCP_RX_MAX_ENTRIES_MASK) {
+			if (pQueue->Entries[nEntry].nHandleConnection == nIndexTCB) {
+				isQueued = true;
+				break;
+			}
+		}
+
+		if (!isQueued) {
+			nIdleMax = nIdle;
+			nIndexReclaim = nIndexTCB;
+		}
+	}
+
+	nIndexTCB = nIndexReclaim;
+
+	if (nIndexTCB == TCP_MAX_TCBS_ALLOWED) {
+		return false;
+	}
+
+	auto *pTCB = &s_Port[nIndexPort].TCB[nIndexTCB];
+
+	if (pTCB->state == STATE_ESTABLISHED) {
+		SendInfo info;
+		info.SEQ = pTCB->SND.NXT;
+		info.ACK = pTCB->RCV.NXT;
+		info.CTL = Control::RST | Control::ACK;
+
+		send_package(pTCB, info);
+	}
+
+	DEBUG_PRINTF("Reclaim %u", nIndexTCB);
+
+	_init_tcb(pTCB, pTCB->nLocalPort);
+	return true;
+}
+
 static void find_tcb(const t_tcp *pTcp, uint32_t& nIndexPort, uint32_t& nIndexTCB) {
     // Search each port for a match with the destination port
     for (nIndexPort = 0; nIndexPort < TCP_MAX_PORTS_ALLOWED; nIndexPort++) {
@@ -615,7 +1024,14 @@ static void find_tcb(const t_tcp *pTcp, uint32_t& nIndexPort, uint32_t& nIndexTC
             return;
         }
 
-        // If no available TCB, trigger retransmission
+        // If no available TCB, reclaim an idle one for a new connection
+        if ((pTcp->tcp.control & Control::SYN) && reclaim_tcb(nIndexPort, nIndexTCB)) {
+            DEBUG_EXIT
+            return;
+        }
+
+        // Otherwise trigger retransmission
+        nIndexTCB = TCP_MAX_TCBS_ALLOWED;
         DEBUG_PUTS("MAX_TCB_ALLOWED -> Force retransmission");
         DEBUG_EXIT
         return;
@@ -664,6 +1080,11 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 		return;
 	}
 
+	if (nIndexTCB == TCP_MAX_TCBS_ALLOWED) {
+		DEBUG_EXIT
+		return;
+	}
+
 	const auto nDataLength = static_cast<uint16_t>(tcplen - nDataOffset);
 
 	_bswap32(pTcp);
@@ -678,6 +1099,7 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 	const auto SEG_WND = pTcp->tcp.window;
 
 	auto *pTCB = &s_Port[nIndexPort].TCB[nIndexTCB];
+	pTCB->nMillis = Hardware::Get()->Millis();
 
 	DEBUG_PRINTF("%u:%u:[%s] %c%c%c%c%c%c SEQ=%u, ACK=%u, tcplen=%u, data_offset=%u, data_length=%u",
 			nIndexPort,
@@ -901,6 +1323,8 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 				auto nBytesAck = SEG_ACK - pTCB->SND.UNA;
 				pTCB->SND.UNA = SEG_ACK;
 
+				_acknowledge(pTCB, SEG_ACK);
+
 				if (SEG_ACK == pTCB->SND.NXT) {
 					DEBUG_PUTS("/* all segments are acknowledged */");
 				}
@@ -920,8 +1344,30 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 					pTCB->SND.WL1 = SEG_SEQ;
 					pTCB->SND.WL2 = SEG_ACK;
 				}
+
+				if ((pTCB->state == STATE_ESTABLISHED) || (pTCB->state == STATE_CLOSE_WAIT)) {
+					_output(pTCB);
+				}
+
+				if (SEG_ACK == pTCB->SND.NXT) {	// our FIN is acknowledged
+					if (pTCB->state == STATE_FIN_WAIT_1) {
+						NEW_STATE(pTCB, STATE_FIN_WAIT_2);
+					} else if (pTCB->state == STATE_CLOSING) {
+						_init_tcb(pTCB, pTCB->nLocalPort);
+						return;
+					}
+				}
 			} else if (SEQ_LEQ(SEG_ACK, pTCB->SND.UNA)) { /* RFC 1122 section 4.2.2.20 (g) */
 				DEBUG_PUTS("/* ignore duplicate ACK */");
+				// RFC 5681 2. Definitions: DUPLICATE ACKNOWLEDGMENT
+				if ((SEG_ACK == pTCB->SND.UNA) && (SEG_LEN == 0) && (SEG_WND == pTCB->SND.WND) && (pTCB->SND.NXT != pTCB->SND.UNA)
+						&& !(pTcp->tcp.control & (Control::SYN | Control::FIN))) {
+					if (++pTCB->RTX.nDupAcks == TCP_DUPACK_THRESHOLD) {
+						DEBUG_PUTS("Fast retransmit");
+						_retransmit(pTCB, Hardware::Get()->Millis());
+					}
+				}
+
 				if (SEQ_BETWEEN_LH(pTCB->SND.UNA, SEG_ACK, pTCB->SND.NXT)) {
 					// ... but update send window
 					if ( SEQ_LT(pTCB->SND.WL1, SEG_SEQ) || (pTCB->SND.WL1 == SEG_SEQ && SEQ_LEQ(pTCB->SND.WL2, SEG_ACK))) {
@@ -929,6 +1375,10 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 						pTCB->SND.WL1 = SEG_SEQ;
 						pTCB->SND.WL2 = SEG_ACK;
 					}
+
+					if ((pTCB->state == STATE_ESTABLISHED) || (pTCB->state == STATE_CLOSE_WAIT)) {
+						_output(pTCB);
+					}
 				}
 			} else if (SEQ_GT(SEG_ACK, pTCB->SND.NXT)) {
 				DEBUG_PRINTF("SEG_ACK=%u, SND.NXT=%u", SEG_ACK,pTCB->SND.NXT);
@@ -969,8 +1419,15 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 		case STATE_FIN_WAIT_1:
 		case STATE_FIN_WAIT_2:
 			if (nDataLength > 0) {
+				auto *pQueue = &s_Port[nIndexPort].receiveQueue;
+
+				if (((pQueue->nHead + 1) & TCP_RX_MAX_ENTRIES_MASK) == pQueue->nTail) {
+					DEBUG_PUTS("Receive queue is full");
+					DEBUG_EXIT
+					return;
+				}
+
 				if (SEG_SEQ == pTCB->RCV.NXT) {
-					auto *pQueue = &s_Port[nIndexPort].receiveQueue;
 					auto *pQueueEntry = &pQueue->Entries[pQueue->nHead];
 
 					pQueueEntry->nHandleConnection = static_cast<uint16_t>(nIndexTCB);
@@ -1047,16 +1504,14 @@ __attribute__((hot)) void tcp_handle(struct t_tcp *pTcp) {
 			 timers; otherwise enter the CLOSING state.
 			 */
 			if (SEG_ACK == pTCB->SND.NXT) { /* if our FIN is now acknowledged */
-				NEW_STATE(pTCB, STATE_TIME_WAIT);
-				CLIENT_NOT_IMPLEMENTED;
+				_init_tcb(pTCB, pTCB->nLocalPort);	// No TIME-WAIT
 			} else {
 				NEW_STATE(pTCB, STATE_CLOSING);
 			}
 			break;
 		case STATE_FIN_WAIT_2:
-			// Enter the TIME-WAIT state.  Start the time-wait timer, turn off the other timers.
-			NEW_STATE(pTCB, STATE_TIME_WAIT);
-			CLIENT_NOT_IMPLEMENTED;
+			// No TIME-WAIT, the TCB is returned to LISTEN
+			_init_tcb(pTCB, pTCB->nLocalPort);
 			break;
 		case STATE_CLOSE_WAIT:
 			// Remain in the CLOSE-WAIT state.
@@ -1136,39 +1591,66 @@ uint16_t tcp_read(const int32_t nHandleListen, const uint8_t **pData, uint32_t &
 	return pQueueEntry->nSize;
 }
 
-static void _write(struct tcb *pTCB, const uint8_t *pBuffer, const uint32_t nLength, const bool isLastSegment) {
-	assert(nLength != 0);
-	assert(nLength <= static_cast<uint32_t>(TCP_DATA_SIZE));
-
-	DEBUG_PRINTF("nLength=%u, pTCB->SND.WND=%u", nLength, pTCB->SND.WND);
-
-    if (nLength > pTCB->SND.WND) {
-    	console_error("Retry or queue the data for later transmission\n");
-        // TODO retry or queue the data for later transmission.
-        return;
-    }
+/**
+ * Append the data to the last queued segment when it is not sent yet,
+ * so that a response header and a small body share one segment.
+ * @return the number of bytes queued, 0 when there is no free entry
+ */
+static uint32_t _queue(struct tcb *pTCB, const uint8_t *pBuffer, const uint32_t nLength) {
+	const auto nMSS = _send_mss(pTCB);
+	auto *pEntry = _newest_entry(pTCB);
+	uint32_t SEQ = pTCB->SND.NXT;
+
+	if ((pEntry != nullptr) && !pEntry->isSent) {
+		SEQ = pEntry->SEQ + pEntry->nSize;
+
+		if (pEntry->nSize < nMSS) {
+			const auto nCopy = std::min(nLength, nMSS - pEntry->nSize);
+			memcpy(&pEntry->data[pEntry->nSize], pBuffer, nCopy);
+			pEntry->nSize = static_cast<uint16_t>(pEntry->nSize + nCopy);
+			pEntry->CTL = (nCopy == nLength) ? (Control::ACK | Control::PSH) : Control::ACK;
+			return nCopy;
+		}
+	}
 
-	pTCB->TX.data = const_cast<uint8_t *>(pBuffer);
-	pTCB->TX.size = nLength;
+	uint32_t nFree = 0;
 
-	struct SendInfo info;
-	info.SEQ = pTCB->SND.NXT;
-	info.ACK = pTCB->RCV.NXT;
-	info.CTL = Control::ACK;
-	if (isLastSegment) {
-		info.CTL |= Control::PSH;
+	for (const auto& entry : s_TransmitQueue) {
+		if (entry.pTCB == nullptr) {
+			nFree++;
+		}
 	}
 
-	send_package(pTCB, info);
+	if ((nFree == 0) || ((pEntry != nullptr) && (nFree == 1))) {
+		return 0;
+	}
 
-	pTCB->TX.data = nullptr;
-	pTCB->TX.size = 0;
+	for (auto& entry : s_TransmitQueue) {
+		if (entry.pTCB == nullptr) {
+			const auto nCopy = std::min(nLength, nMSS);
+			memcpy(entry.data, pBuffer, nCopy);
+			entry.pTCB = pTCB;
+			entry.SEQ = SEQ;
+			entry.nSize = static_cast<uint16_t>(nCopy);
+			entry.CTL = (nCopy == nLength) ? (Control::ACK | Control::PSH) : Control::ACK;
+			entry.nRetransmits = 0;
+			entry.isSent = false;
+			return nCopy;
+		}
+	}
 
-    pTCB->SND.NXT += nLength;
-    pTCB->SND.WND -= nLength;
+	return 0;
 }
 
-void tcp_write(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLength, uint32_t nHandleConnection) {
+/**
+ * The data is copied into the send queue, so the caller can reuse its buffer.
+ * Segments are sent as long as they fit in the peer's receive window,
+ * the remainder is sent when acknowledgments arrive.
+ * When the queue is full, only a part is accepted: the caller must write the
+ * remainder later, i.e. from its Run().
+ * @return the number of bytes accepted, -1 when the connection is not open for sending
+ */
+int32_t tcp_write(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLength, uint32_t nHandleConnection) {
 	assert(nHandleListen >= 0);
 	assert(nHandleListen < TCP_MAX_PORTS_ALLOWED);
 	assert(pBuffer != nullptr);
@@ -1177,15 +1659,40 @@ void tcp_write(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLe
 	auto *pTCB = &s_Port[nHandleListen].TCB[nHandleConnection];
 	assert(pTCB != nullptr);
 
+	if (((pTCB->state != STATE_ESTABLISHED) && (pTCB->state != STATE_CLOSE_WAIT)) || pTCB->RTX.isFinPending) {
+		DEBUG_PUTS("Connection is closing");
+		return -1;
+	}
+
 	const auto *p = pBuffer;
 
 	while (nLength > 0) {
-		const auto nWriteLength = (nLength > TCP_DATA_SIZE) ? TCP_DATA_SIZE : nLength;
-		const bool isLastSegment = (nLength < TCP_DATA_SIZE);
-		_write(pTCB, p, nWriteLength, isLastSegment);
+		const auto nWriteLength = _queue(pTCB, p, nLength);
+
+		if (nWriteLength == 0) {
+			DEBUG_PRINTF("Send queue is full, %u bytes left", nLength);
+			break;
+		}
+
 		p += nWriteLength;
 		nLength -= nWriteLength;
 	}
+
+	_output(pTCB);
+
+	return static_cast<int32_t>(p - pBuffer);
+}
+
+void tcp_close(const int32_t nHandleListen, const uint32_t nHandleConnection) {
+	assert(nHandleListen >= 0);
+	assert(nHandleListen < TCP_MAX_PORTS_ALLOWED);
+	assert(nHandleConnection < TCP_MAX_TCBS_ALLOWED);
+
+	auto *pTCB = &s_Port[nHandleListen].TCB[nHandleConnection];
+
+	if ((pTCB->state == STATE_ESTABLISHED) && !pTCB->RTX.isFinPending) {
+		_close(pTCB);
+	}
 }
 }  // namespace net
 // <---
@@ -0,0 +1,62 @@
+/**
+ * @file hardware.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef TEST_HARDWARE_H_
+#define TEST_HARDWARE_H_
+
+#include <cstdint>
+
+namespace hal {
+typedef void (*TimerCallback)();
+}  // namespace hal
+
+/**
+ * Test double, the test runs the timer callback.
+ */
+class Hardware {
+public:
+	uint32_t Millis() {
+		return 0;
+	}
+
+	int32_t SoftwareTimerAdd([[maybe_unused]] const uint32_t nIntervalMillis, const hal::TimerCallback callback) {
+		s_Callback = callback;
+		return 0;
+	}
+
+	bool SoftwareTimerDelete(int32_t& nId) {
+		nId = -1;
+		return true;
+	}
+
+	static Hardware *Get() {
+		static Hardware hardware;
+		return &hardware;
+	}
+
+	static inline hal::TimerCallback s_Callback;
+};
+
+#endif /* TEST_HARDWARE_H_ */
@@ -0,0 +1,266 @@
+/**
+ * @file test_arp.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "net_private.h"
+
+#include "net/arp.h"
+#include "net/protocol/arp.h"
+#include "net/protocol/udp.h"
+#include "netif.h"
+
+#include "hardware.h"
+
+static int s_nFailed;
+
+#define CHECK(x)	do { if (!(x)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #x); s_nFailed++; } } while (0)
+
+/*
+ * The test doubles of the EMAC and of the net core
+ */
+namespace net {
+namespace globals {
+struct netif netif_default;
+uint32_t nOnNetworkMask;
+}  // namespace globals
+
+void acd_arp_reply([[maybe_unused]] struct t_arp *pArp) {}
+}  // namespace net
+
+extern "C" void console_error(const char *p) {
+	fputs(p, stderr);
+}
+
+static std::vector<std::vector<uint8_t>> s_Sent;
+
+void emac_eth_send(void *pBuffer, uint32_t nLength) {
+	const auto *p = reinterpret_cast<const uint8_t *>(pBuffer);
+	s_Sent.emplace_back(p, p + nLength);
+}
+
+void emac_eth_send_timestamp(void *pBuffer, uint32_t nLength) {
+	emac_eth_send(pBuffer, nLength);
+}
+
+static constexpr uint8_t MAC_PEER[ETH_ADDR_LEN] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+
+static uint32_t ip(const uint8_t a, const uint8_t b, const uint8_t c, const uint8_t d) {
+	const uint8_t address[4] = { a, b, c, d };
+	uint32_t nIp;
+	memcpy(&nIp, address, sizeof(nIp));
+	return nIp;
+}
+
+static void init() {
+	auto& netif = net::globals::netif_default;
+	memset(&netif, 0, sizeof(netif));
+
+	const uint8_t mac[ETH_ADDR_LEN] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+	memcpy(netif.hwaddr, mac, ETH_ADDR_LEN);
+	netif.ip.addr = ip(10, 0, 0, 100);
+	netif.netmask.addr = ip(255, 0, 0, 0);
+	netif.gw.addr = ip(10, 0, 0, 1);
+	net::globals::nOnNetworkMask = netif.ip.addr & netif.netmask.addr;
+
+	net::arp_init();
+	s_Sent.clear();
+}
+
+static void send(const uint32_t nIp, const uint16_t nId) {
+	struct t_udp udp;
+	memset(&udp, 0, sizeof(udp));
+	udp.ether.type = __builtin_bswap16(ETHER_TYPE_IPv4);
+	udp.ip4.id = nId;
+	net::arp_send(&udp, sizeof(udp), nIp);
+}
+
+static void reply(const uint32_t nIp, const uint8_t nMac) {
+	struct t_arp arp;
+	memset(&arp, 0, sizeof(arp));
+	arp.arp.hardware_type = __builtin_bswap16(ARP_HWTYPE_ETHERNET);
+	arp.arp.protocol_type = __builtin_bswap16(ARP_PRTYPE_IPv4);
+	arp.arp.hardware_size = ARP_HARDWARE_SIZE;
+	arp.arp.protocol_size = ARP_PROTOCOL_SIZE;
+	arp.arp.opcode = __builtin_bswap16(ARP_OPCODE_REPLY);
+	memcpy(arp.arp.sender_mac, MAC_PEER, ETH_ADDR_LEN);
+	arp.arp.sender_mac[5] = nMac;
+	memcpy(arp.arp.sender_ip, &nIp, 4);
+	const auto nIpTarget = net::globals::netif_default.ip.addr;
+	memcpy(arp.arp.target_ip, &nIpTarget, 4);
+	net::arp_handle(&arp);
+}
+
+static bool is_arp_request(const std::vector<uint8_t>& frame, const uint32_t nIp) {
+	const auto *arp = reinterpret_cast<const struct t_arp *>(frame.data());
+	return (frame.size() == sizeof(struct t_arp))
+			&& (arp->arp.opcode == __builtin_bswap16(ARP_OPCODE_RQST))
+			&& (memcmp(arp->arp.target_ip, &nIp, 4) == 0);
+}
+
+static bool is_udp(const std::vector<uint8_t>& frame, const uint16_t nId, const uint8_t nMac) {
+	const auto *udp = reinterpret_cast<const struct t_udp *>(frame.data());
+	return (frame.size() == sizeof(struct t_udp))
+			&& (udp->ip4.id == nId)
+			&& (memcmp(udp->ether.dst, MAC_PEER, ETH_ADDR_LEN - 1) == 0)
+			&& (udp->ether.dst[5] == nMac);
+}
+
+/*
+ * A packet for an unresolved address is queued, at most 2 per address.
+ * The reply sends the queued packets in order.
+ */
+static void test_queue() {
+	init();
+
+	const auto nIp = ip(10, 0, 0, 2);
+
+	send(nIp, 1);
+	CHECK(s_Sent.size() == 1);
+	CHECK(is_arp_request(s_Sent[0], nIp));
+
+	send(nIp, 2);
+	send(nIp, 3);
+	CHECK(s_Sent.size() == 1);
+
+	const auto& statistics = net::arp_statistics();
+	CHECK(statistics.nMisses == 3);
+	CHECK(statistics.nQueued == 3);
+	CHECK(statistics.nDropped == 1);
+
+	s_Sent.clear();
+	reply(nIp, 2);
+	CHECK(s_Sent.size() == 2);
+	CHECK((s_Sent.size() == 2) && is_udp(s_Sent[0], 2, 2) && is_udp(s_Sent[1], 3, 2));
+
+	s_Sent.clear();
+	send(nIp, 4);
+	CHECK((s_Sent.size() == 1) && is_udp(s_Sent[0], 4, 2));
+	CHECK(statistics.nHits == 1);
+}
+
+/*
+ * The pool has 4 entries shared by all addresses.
+ * The entries of an address that does not reply are returned to the pool.
+ */
+static void test_pool() {
+	init();
+
+	const auto& statistics = net::arp_statistics();
+
+	for (uint8_t i = 0; i < 5; i++) {
+		send(ip(10, 1, i, 2), i);
+	}
+
+	CHECK(statistics.nQueued == 4);
+	CHECK(statistics.nDropped == 1);
+
+	// Probing times out
+	for (uint32_t i = 0; i < 3; i++) {
+		Hardware::s_Callback();
+	}
+
+	CHECK(statistics.nDropped == 5);
+
+	for (uint8_t i = 0; i < 4; i++) {
+		send(ip(10, 2, i, 2), i);
+	}
+
+	CHECK(statistics.nQueued == 8);
+	CHECK(statistics.nDropped == 5);
+
+	s_Sent.clear();
+
+	for (uint8_t i = 0; i < 4; i++) {
+		reply(ip(10, 2, i, 2), i);
+	}
+
+	CHECK(s_Sent.size() == 4);
+
+	for (uint8_t i = 0; (i < 4) && (i < s_Sent.size()); i++) {
+		CHECK(is_udp(s_Sent[i], i, i));
+	}
+}
+
+/*
+ * 64 records in sets of 4. Addresses that differ in one byte only are spread over the sets.
+ */
+static uint32_t resolve_and_count_hits(uint32_t (*address)(const uint8_t)) {
+	init();
+
+	for (uint8_t i = 0; i < 64; i++) {
+		reply(address(i), i);
+	}
+
+	const auto nHits = net::arp_statistics().nHits;
+
+	for (uint8_t i = 0; i < 64; i++) {
+		send(address(i), i);
+	}
+
+	return net::arp_statistics().nHits - nHits;
+}
+
+static void test_hash() {
+	const auto nLow = resolve_and_count_hits([](const uint8_t i) { return ip(10, 0, 0, static_cast<uint8_t>(i + 2)); });
+	const auto nHigh = resolve_and_count_hits([](const uint8_t i) { return ip(10, i, 0, 2); });
+	const auto nMiddle = resolve_and_count_hits([](const uint8_t i) { return ip(10, 0, i, 2); });
+
+	printf("hits: last byte %u, second byte %u, third byte %u of 64\n", nLow, nHigh, nMiddle);
+
+	// A hash of one byte only would put 64 addresses in one set of 4
+	CHECK(nLow >= 32);
+	CHECK(nHigh >= 32);
+	CHECK(nMiddle >= 32);
+
+	// The most recently resolved address is always found
+	init();
+	for (uint8_t i = 0; i < 200; i++) {
+		const auto nIp = ip(10, i, static_cast<uint8_t>(i * 7), 2);
+		reply(nIp, i);
+		s_Sent.clear();
+		send(nIp, i);
+		CHECK((s_Sent.size() == 1) && is_udp(s_Sent[0], i, i));
+	}
+	CHECK(net::arp_statistics().nEvictions >= (200 - 64));
+}
+
+int main() {
+	test_queue();
+	test_pool();
+	test_hash();
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return EXIT_FAILURE;
+	}
+
+	puts("arp: passed");
+	return EXIT_SUCCESS;
+}
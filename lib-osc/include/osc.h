@@ -88,6 +88,15 @@ inline static char *get_path(void *pPath, unsigned nSize) {
 inline static bool is_match(const char *str, const char *p) {
 	return lo_pattern_match(str, p) == 0 ? false : true;
 }
+
+/*
+ * OSC-bundle
+ * "#bundle" OSC-string, followed by an OSC Time Tag, followed by zero or more elements.
+ * Each element is an int32 size followed by an OSC-message or an OSC-bundle.
+ */
+inline static bool is_bundle(const void *pData, unsigned nSize) {
+	return (nSize >= 16) && (memcmp(pData, "#bundle", 8) == 0);
+}
 }  // namespace osc
 
 #endif /* OSC_H_ */
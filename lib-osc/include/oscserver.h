@@ -40,7 +40,28 @@ struct DefaultPort {
 
 struct Max {
 	static constexpr auto PATH_LENGTH = 128U;
+	static constexpr auto BUNDLE_DEPTH = 4U;
 };
+
+enum class Handler : uint8_t {
+	DMX, BLACKOUT, CHANNEL, PING, INFO, UNDEFINED
+};
+
+/*
+ * The configured addresses are compiled once into this table.
+ * Literal addresses are matched on length and hash before a single memcmp,
+ * only addresses with OSC wildcards fall back to the pattern matcher.
+ */
+struct Dispatch {
+	const char *pAddress;
+	uint32_t nHash;
+	uint32_t nLength;
+	Handler handler;
+	bool bIsPattern;
+	bool bIsPrefix;
+};
+
+static constexpr auto DISPATCH_ENTRIES = static_cast<uint32_t>(Handler::UNDEFINED);
 }  // namespace server
 }  // namespace osc
 
@@ -130,6 +151,14 @@ public:
 	}
 
 private:
+	void CompileDispatch();
+	osc::server::Handler Dispatch(const char *pAddress, uint32_t nLength, uint32_t nHash, bool bIsPattern);
+	void HandleBundle(char *pBundle, uint32_t nSize, uint32_t nRemoteIp, uint32_t nDepth);
+	void HandleMessage(char *pMessage, uint32_t nSize, uint32_t nRemoteIp);
+	void HandleDmx(char *pMessage, uint32_t nSize);
+	void HandleChannel(char *pMessage, uint32_t nSize, const char *pChannel);
+	void HandleBlackout(char *pMessage, uint32_t nSize);
+	void SetDmxData(const uint8_t *pData, uint16_t nStartChannel, uint32_t nLength);
 	int GetChannel(const char *p);
 	bool IsDmxDataChanged(const uint8_t *pData, uint16_t nStartChannel, uint32_t nLength);
 
@@ -138,6 +167,8 @@ private:
 	uint16_t m_nPortOutgoing { osc::server::DefaultPort::OUTGOING };
 	int32_t m_nHandle { -1 };
 	uint16_t m_nLastChannel { 0 };
+	uint16_t m_nDmxLength { 0 };
+	bool m_bDmxUpdate { false };
 
 	bool m_bPartialTransmission { false };
 	bool m_bEnableNoChangeUpdate { false };
@@ -154,6 +185,7 @@ private:
 	static char s_aPathSecond[osc::server::Max::PATH_LENGTH];
 	static char s_aPathInfo[osc::server::Max::PATH_LENGTH];
 	static char s_aPathBlackOut[osc::server::Max::PATH_LENGTH];
+	static osc::server::Dispatch s_Dispatch[osc::server::DISPATCH_ENTRIES];
 
 	static uint8_t s_pData[lightset::dmx::UNIVERSE_SIZE];
 	static uint8_t s_pOsc[lightset::dmx::UNIVERSE_SIZE];
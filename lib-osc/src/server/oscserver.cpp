@@ -52,6 +52,7 @@ char OscServer::s_aPath[osc::server::Max::PATH_LENGTH];
 char OscServer::s_aPathSecond[osc::server::Max::PATH_LENGTH];
 char OscServer::s_aPathInfo[osc::server::Max::PATH_LENGTH];
 char OscServer::s_aPathBlackOut[osc::server::Max::PATH_LENGTH];
+osc::server::Dispatch OscServer::s_Dispatch[osc::server::DISPATCH_ENTRIES];
 
 char *OscServer::s_pUdpBuffer;
 uint8_t OscServer::s_pData[lightset::dmx::UNIVERSE_SIZE];
@@ -86,6 +87,8 @@ OscServer::OscServer() {
 		m_pSoC = Hardware::Get()->GetCpuName(nHwTextLength);
 	}
 
+	CompileDispatch();
+
 	DEBUG_EXIT
 }
 
@@ -136,6 +139,8 @@ void OscServer::SetPath(const char* pPath) {
 		s_aPathSecond[nLength] = '\0';
 	}
 
+	CompileDispatch();
+
 	DEBUG_PUTS(s_aPath);
 	DEBUG_PUTS(s_aPathSecond);
 }
@@ -152,6 +157,8 @@ void OscServer::SetPathInfo(const char* pPathInfo) {
 		}
 	}
 
+	CompileDispatch();
+
 	DEBUG_PUTS(s_aPathInfo);
 }
 
@@ -167,28 +174,114 @@ void OscServer::SetPathBlackOut(const char* pPathBlackOut) {
 		}
 	}
 
+	CompileDispatch();
+
 	DEBUG_PUTS(s_aPathBlackOut);
 }
 
+/*
+ * Single pass over the address: length, FNV-1a hash and wildcard detection.
+ */
+static bool address_scan(const char *pAddress, uint32_t& nLength, uint32_t& nHash) {
+	auto bIsPattern = false;
+	nHash = 2166136261U;
+	nLength = 0;
+
+	while (pAddress[nLength] != '\0') {
+		const auto c = pAddress[nLength];
+
+		if ((c == '*') || (c == '?') || (c == '[') || (c == '{')) {
+			bIsPattern = true;
+		}
+
+		nHash ^= static_cast<uint8_t>(c);
+		nHash *= 16777619U;
+		nLength++;
+	}
+
+	return bIsPattern;
+}
+
+void OscServer::CompileDispatch() {
+	const char *pAddresses[osc::server::DISPATCH_ENTRIES] = { s_aPath, s_aPathBlackOut, s_aPathSecond, "/ping", s_aPathInfo };
+
+	for (uint32_t i = 0; i < osc::server::DISPATCH_ENTRIES; i++) {
+		auto& entry = s_Dispatch[i];
+
+		entry.pAddress = pAddresses[i];
+		entry.handler = static_cast<osc::server::Handler>(i);
+		entry.bIsPattern = address_scan(entry.pAddress, entry.nLength, entry.nHash);
+		entry.bIsPrefix = false;
+	}
+
+	/*
+	 * "path/N" -> when the path itself is literal, match on the prefix "path/"
+	 */
+	auto& channel = s_Dispatch[static_cast<uint32_t>(osc::server::Handler::CHANNEL)];
+
+	if (!s_Dispatch[static_cast<uint32_t>(osc::server::Handler::DMX)].bIsPattern) {
+		channel.nLength = static_cast<uint32_t>(strlen(s_aPath)) + 1;
+		channel.bIsPattern = false;
+		channel.bIsPrefix = true;
+	}
+}
+
+osc::server::Handler OscServer::Dispatch(const char *pAddress, uint32_t nLength, uint32_t nHash, bool bIsPattern) {
+	for (uint32_t i = 0; i < osc::server::DISPATCH_ENTRIES; i++) {
+		const auto& entry = s_Dispatch[i];
+
+		if ((entry.handler == osc::server::Handler::BLACKOUT) && (m_pOscServerHandler == nullptr)) {
+			continue;
+		}
+
+		if (bIsPattern) {
+			// The incoming address is the pattern, it can only address literal entries
+			if (!entry.bIsPrefix && osc::is_match(entry.pAddress, pAddress)) {
+				return entry.handler;
+			}
+			continue;
+		}
+
+		if (entry.bIsPrefix) {
+			if ((nLength > entry.nLength) && (memcmp(pAddress, entry.pAddress, entry.nLength - 1) == 0) && (pAddress[entry.nLength - 1] == '/')) {
+				return entry.handler;
+			}
+			continue;
+		}
+
+		if (entry.bIsPattern) {
+			if (osc::is_match(pAddress, entry.pAddress)) {
+				return entry.handler;
+			}
+			continue;
+		}
+
+		if ((entry.nHash == nHash) && (entry.nLength == nLength) && (memcmp(pAddress, entry.pAddress, nLength) == 0)) {
+			return entry.handler;
+		}
+	}
+
+	return osc::server::Handler::UNDEFINED;
+}
+
 int OscServer::GetChannel(const char* p) {
 	assert(p != nullptr);
 
-	auto *s = const_cast<char *>(p) + strlen(s_aPath) + 1;
 	int nChannel = 0;
 	int i;
 
-	for (i = 0; (i < 3) && (*s != '\0'); i++) {
-		int c = *s;
+	for (i = 0; (i < 3) && (*p != '\0'); i++) {
+		int c = *p;
 
 		if ((c < '0') || (c > '9')) {
 			return -1;
 		}
 
 		nChannel = nChannel * 10 + c - '0';
-		s++;
+		p++;
 	}
 
-	if (nChannel > static_cast<int32_t>(lightset::dmx::UNIVERSE_SIZE)) {
+	if ((*p != '\0') || (nChannel > static_cast<int32_t>(lightset::dmx::UNIVERSE_SIZE))) {
 		return -1;
 	}
 
@@ -218,166 +311,152 @@ bool OscServer::IsDmxDataChanged(const uint8_t* pData, uint16_t nStartChannel, u
 	return isChanged;
 }
 
-void OscServer::Run() {
-	uint32_t nRemoteIp;
-	uint16_t nRemotePort;
-
-	const auto nBytesReceived = Network::Get()->RecvFrom(m_nHandle, const_cast<const void **>(reinterpret_cast<void **>(&s_pUdpBuffer)), &nRemoteIp, &nRemotePort);
-
-	if (__builtin_expect((nBytesReceived == 0), 1)) {
-		return;
+/*
+ * The DMX output is deferred until the whole datagram is handled,
+ * so that a bundle with many channel messages results in a single SetData.
+ */
+void OscServer::SetDmxData(const uint8_t *pData, uint16_t nStartChannel, uint32_t nLength) {
+	if (IsDmxDataChanged(pData, nStartChannel, nLength) || m_bEnableNoChangeUpdate) {
+		m_bDmxUpdate = true;
+		const auto nEnd = static_cast<uint16_t>(nStartChannel - 1 + nLength);
+		m_nDmxLength = nEnd > m_nDmxLength ? nEnd : m_nDmxLength;
 	}
+}
 
-	auto bIsDmxDataChanged = false;
-
-	OscSimpleMessage Msg(s_pUdpBuffer, nBytesReceived);
+void OscServer::HandleDmx(char *pMessage, uint32_t nSize) {
+	OscSimpleMessage Msg(pMessage, nSize);
 
-	debug_dump(s_pUdpBuffer, nBytesReceived);
+	const auto nArgc = Msg.GetArgc();
 
-	DEBUG_PRINTF("[%d] path : %s", nBytesReceived, osc::get_path(s_pUdpBuffer, nBytesReceived));
+	if ((nArgc == 1) && (Msg.GetType(0) == osc::type::BLOB)) {
+		DEBUG_PUTS("Blob received");
 
-	if (osc::is_match(s_pUdpBuffer, s_aPath)) {
-		const auto nArgc = Msg.GetArgc();
+		OSCBlob blob = Msg.GetBlob(0);
+		const auto size = static_cast<uint16_t>(blob.GetDataSize());
 
-		if ((nArgc == 1) && (Msg.GetType(0) == osc::type::BLOB)) {
-			DEBUG_PUTS("Blob received");
+		if (size <= lightset::dmx::UNIVERSE_SIZE) {
+			SetDmxData(blob.GetDataPtr(), 1, size);
+		} else {
+			DEBUG_PUTS("Too many channels");
+		}
 
-			OSCBlob blob = Msg.GetBlob(0);
-			const auto size = static_cast<uint16_t>(blob.GetDataSize());
+		return;
+	}
 
-			if (size <= lightset::dmx::UNIVERSE_SIZE) {
-				const auto *ptr = blob.GetDataPtr();
+	if ((nArgc == 2) && (Msg.GetType(0) == osc::type::INT32)) {
+		auto nChannel = static_cast<uint16_t>(1 + Msg.GetInt(0));
 
-				bIsDmxDataChanged = IsDmxDataChanged(ptr, 1, size);
+		if ((nChannel < 1) || (nChannel > lightset::dmx::UNIVERSE_SIZE)) {
+			DEBUG_PRINTF("Invalid channel [%d]", nChannel);
+			return;
+		}
 
-				if (bIsDmxDataChanged || m_bEnableNoChangeUpdate) {
-					if ((!m_bPartialTransmission) || (size == lightset::dmx::UNIVERSE_SIZE)) {
-						m_pLightSet->SetData(0, s_pData, lightset::dmx::UNIVERSE_SIZE);
-					} else {
-						m_nLastChannel = static_cast<uint16_t>(size > m_nLastChannel ? size : m_nLastChannel);
-						m_pLightSet->SetData(0, s_pData, m_nLastChannel);
-					}
+		uint8_t nData;
 
-					if (!m_bIsRunning) {
-						m_bIsRunning = true;
-						m_pLightSet->Start(0);
-					}
-				}
-			} else {
-				DEBUG_PUTS("Too many channels");
-				return;
-			}
-		} else if ((nArgc == 2) && (Msg.GetType(0) == osc::type::INT32)) {
-			auto nChannel = static_cast<uint16_t>(1 + Msg.GetInt(0));
+		if (Msg.GetType(1) == osc::type::INT32) {
+			DEBUG_PUTS("ii received");
+			nData = static_cast<uint8_t>(Msg.GetInt(1));
+		} else if (Msg.GetType(1) == osc::type::FLOAT) {
+			DEBUG_PUTS("if received");
+			nData = static_cast<uint8_t>(Msg.GetFloat(1) * lightset::dmx::MAX_VALUE);
+		} else {
+			return;
+		}
 
-			if ((nChannel < 1) || (nChannel > lightset::dmx::UNIVERSE_SIZE)) {
-				DEBUG_PRINTF("Invalid channel [%d]", nChannel);
-				return;
-			}
+		DEBUG_PRINTF("Channel = %d, Data = %.2x", nChannel, nData);
 
-			uint8_t nData;
+		SetDmxData(&nData, nChannel, 1);
+	}
+}
 
-			if (Msg.GetType(1) == osc::type::INT32) {
-				DEBUG_PUTS("ii received");
-				nData = static_cast<uint8_t>(Msg.GetInt(1));
-			} else if (Msg.GetType(1) == osc::type::FLOAT) {
-				DEBUG_PUTS("if received");
-				nData = static_cast<uint8_t>(Msg.GetFloat(1) * lightset::dmx::MAX_VALUE);
-			} else {
-				return;
-			}
+void OscServer::HandleChannel(char *pMessage, uint32_t nSize, const char *pChannel) {
+	OscSimpleMessage Msg(pMessage, nSize);
 
-			DEBUG_PRINTF("Channel = %d, Data = %.2x", nChannel, nData);
+	if (Msg.GetArgc() != 1) { // /path/N 'i' or 'f'
+		return;
+	}
 
-			bIsDmxDataChanged = IsDmxDataChanged(&nData, nChannel, 1);
+	const auto nChannel = static_cast<uint16_t>(GetChannel(pChannel));
 
-			if (bIsDmxDataChanged || m_bEnableNoChangeUpdate) {
-				if (!m_bPartialTransmission) {
-					m_pLightSet->SetData(0, s_pData, lightset::dmx::UNIVERSE_SIZE);
-				} else {
-					m_nLastChannel = nChannel > m_nLastChannel ? nChannel : m_nLastChannel;
-					m_pLightSet->SetData(0, s_pData, m_nLastChannel);
-				}
+	if ((nChannel < 1) || (nChannel > lightset::dmx::UNIVERSE_SIZE)) {
+		return;
+	}
 
-				if (!m_bIsRunning) {
-					m_bIsRunning = true;
-					m_pLightSet->Start(0);
-				}
-			}
-		}
+	uint8_t nData;
 
+	if (Msg.GetType(0) == osc::type::INT32) {
+		DEBUG_PUTS("i received");
+		nData = static_cast<uint8_t>(Msg.GetInt(0));
+	} else if (Msg.GetType(0) == osc::type::FLOAT) {
+		DEBUG_PRINTF("f received %f", Msg.GetFloat(0));
+		nData = static_cast<uint8_t>(Msg.GetFloat(0) * lightset::dmx::MAX_VALUE);
+	} else {
 		return;
 	}
 
-	if ((m_pOscServerHandler != nullptr) && (osc::is_match(s_pUdpBuffer, s_aPathBlackOut))) {
-		OscSimpleMessage Msg(s_pUdpBuffer, nBytesReceived);
+	DEBUG_PRINTF("Channel = %d, Data = %.2x", nChannel, nData);
 
-		if (Msg.GetType(0) != osc::type::FLOAT) {
-			DEBUG_PUTS("No float");
-			return;
-		}
+	SetDmxData(&nData, nChannel, 1);
+}
 
-		if (Msg.GetFloat(0) != 0) {
-			m_pOscServerHandler->Blackout();
-			DEBUG_PUTS("Blackout");
-		} else {
-			m_pOscServerHandler->Update();
-			DEBUG_PUTS("Update");
-		}
+void OscServer::HandleBlackout(char *pMessage, uint32_t nSize) {
+	assert(m_pOscServerHandler != nullptr);
 
+	OscSimpleMessage Msg(pMessage, nSize);
+
+	if (Msg.GetType(0) != osc::type::FLOAT) {
+		DEBUG_PUTS("No float");
 		return;
 	}
 
-	if (osc::is_match(s_pUdpBuffer, s_aPathSecond)) {
-		const auto nArgc = Msg.GetArgc();
-
-		if (nArgc == 1) { // /path/N 'i' or 'f'
-			const auto nChannel = static_cast<uint16_t>(GetChannel(s_pUdpBuffer));
-
-			if (nChannel >= 1 && nChannel <= lightset::dmx::UNIVERSE_SIZE) {
-				uint8_t nData;
-
-				if (Msg.GetType(0) == osc::type::INT32) {
-					DEBUG_PUTS("i received");
-					nData = static_cast<uint8_t>(Msg.GetInt(0));
-				} else if (Msg.GetType(0) == osc::type::FLOAT) {
-					DEBUG_PRINTF("f received %f", Msg.GetFloat(0));
-					nData = static_cast<uint8_t>(Msg.GetFloat(0) * lightset::dmx::MAX_VALUE);
-				} else {
-					return;
-				}
-
-				DEBUG_PRINTF("Channel = %d, Data = %.2x", nChannel, nData);
-
-				bIsDmxDataChanged = IsDmxDataChanged(&nData, nChannel, 1);
-
-				if (bIsDmxDataChanged || m_bEnableNoChangeUpdate) {
-					if (!m_bPartialTransmission) {
-						m_pLightSet->SetData(0, s_pData, lightset::dmx::UNIVERSE_SIZE);
-					} else {
-						m_nLastChannel = nChannel > m_nLastChannel ? nChannel : m_nLastChannel;
-						m_pLightSet->SetData(0, s_pData, m_nLastChannel);
-					}
-
-					if (!m_bIsRunning) {
-						m_bIsRunning = true;
-						m_pLightSet->Start(0);
-					}
-				}
-			}
-		}
+	if (Msg.GetFloat(0) != 0) {
+		m_pOscServerHandler->Blackout();
+		DEBUG_PUTS("Blackout");
+	} else {
+		m_pOscServerHandler->Update();
+		DEBUG_PUTS("Update");
+	}
+}
+
+void OscServer::HandleMessage(char *pMessage, uint32_t nSize, uint32_t nRemoteIp) {
+	const auto *pAddress = osc::get_path(pMessage, nSize);
 
+	if (pAddress == nullptr) {
+		DEBUG_PUTS("Invalid address");
 		return;
 	}
 
-	if (osc::is_match(s_pUdpBuffer, "/ping")) {
+	DEBUG_PRINTF("[%u] path : %s", nSize, pAddress);
+
+	uint32_t nLength;
+	uint32_t nHash;
+	const auto bIsPattern = address_scan(pAddress, nLength, nHash);
+
+	switch (Dispatch(pAddress, nLength, nHash, bIsPattern)) {
+	case osc::server::Handler::DMX:
+		HandleDmx(pMessage, nSize);
+		break;
+	case osc::server::Handler::BLACKOUT:
+		HandleBlackout(pMessage, nSize);
+		break;
+	case osc::server::Handler::CHANNEL: {
+		const auto& channel = s_Dispatch[static_cast<uint32_t>(osc::server::Handler::CHANNEL)];
+		auto nChannelOffset = channel.nLength;
+
+		if (!channel.bIsPrefix) {
+			for (nChannelOffset = nLength; pAddress[nChannelOffset - 1] != '/'; nChannelOffset--)
+				;
+		}
+
+		HandleChannel(pMessage, nSize, &pAddress[nChannelOffset]);
+	}
+		break;
+	case osc::server::Handler::PING: {
 		DEBUG_PUTS("ping received");
 		OscSimpleSend MsgSend(m_nHandle, nRemoteIp, m_nPortOutgoing, "/pong", nullptr);
-
-		return;
 	}
-
-	if (osc::is_match(s_pUdpBuffer, s_aPathInfo)) {
+		break;
+	case osc::server::Handler::INFO: {
 		OscSimpleSend MsgSendInfo(m_nHandle, nRemoteIp, m_nPortOutgoing, "/info/os", "s", m_Os);
 		OscSimpleSend MsgSendModel(m_nHandle, nRemoteIp, m_nPortOutgoing, "/info/model", "s", m_pModel);
 		OscSimpleSend MsgSendSoc(m_nHandle, nRemoteIp, m_nPortOutgoing, "/info/soc", "s", m_pSoC);
@@ -385,9 +464,80 @@ void OscServer::Run() {
 		if (m_pOscServerHandler != nullptr) {
 			m_pOscServerHandler->Info(m_nHandle, nRemoteIp, m_nPortOutgoing);
 		}
+	}
+		break;
+	default:
+		break;
+	}
+}
+
+/*
+ * The Time Tag is not used, the bundle elements are handled immediately.
+ */
+void OscServer::HandleBundle(char *pBundle, uint32_t nSize, uint32_t nRemoteIp, uint32_t nDepth) {
+	uint32_t nOffset = 16;	// "#bundle" + Time Tag
 
+	while ((nOffset + 4) <= nSize) {
+		uint32_t nElementSize;
+		memcpy(&nElementSize, &pBundle[nOffset], 4);
+		nElementSize = __builtin_bswap32(nElementSize);
+		nOffset += 4;
+
+		if (((nElementSize & 0x3) != 0) || (nElementSize > (nSize - nOffset))) {
+			DEBUG_PRINTF("Invalid element size %u", nElementSize);
+			return;
+		}
+
+		auto *pElement = &pBundle[nOffset];
+
+		if (osc::is_bundle(pElement, nElementSize)) {
+			if (nDepth < osc::server::Max::BUNDLE_DEPTH) {
+				HandleBundle(pElement, nElementSize, nRemoteIp, nDepth + 1);
+			}
+		} else if (nElementSize != 0) {
+			HandleMessage(pElement, nElementSize, nRemoteIp);
+		}
+
+		nOffset += nElementSize;
+	}
+}
+
+void OscServer::Run() {
+	uint32_t nRemoteIp;
+	uint16_t nRemotePort;
+
+	const auto nBytesReceived = Network::Get()->RecvFrom(m_nHandle, const_cast<const void **>(reinterpret_cast<void **>(&s_pUdpBuffer)), &nRemoteIp, &nRemotePort);
+
+	if (__builtin_expect((nBytesReceived == 0), 1)) {
 		return;
 	}
+
+	debug_dump(s_pUdpBuffer, nBytesReceived);
+
+	m_bDmxUpdate = false;
+	m_nDmxLength = 0;
+
+	if (osc::is_bundle(s_pUdpBuffer, nBytesReceived)) {
+		HandleBundle(s_pUdpBuffer, nBytesReceived, nRemoteIp, 0);
+	} else {
+		HandleMessage(s_pUdpBuffer, nBytesReceived, nRemoteIp);
+	}
+
+	if (!m_bDmxUpdate) {
+		return;
+	}
+
+	if ((!m_bPartialTransmission) || (m_nDmxLength == lightset::dmx::UNIVERSE_SIZE)) {
+		m_pLightSet->SetData(0, s_pData, lightset::dmx::UNIVERSE_SIZE);
+	} else {
+		m_nLastChannel = m_nDmxLength > m_nLastChannel ? m_nDmxLength : m_nLastChannel;
+		m_pLightSet->SetData(0, s_pData, m_nLastChannel);
+	}
+
+	if (!m_bIsRunning) {
+		m_bIsRunning = true;
+		m_pLightSet->Start(0);
+	}
 }
 
 void OscServer::Print() {
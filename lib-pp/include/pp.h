@@ -41,6 +41,7 @@
 #include <algorithm>
 
 #include "lightset.h"
+#include "ema.h"
 
 #if !defined(LIGHTSET_PORTS)
 # error LIGHTSET_PORTS is not defined
@@ -54,6 +55,8 @@ namespace configuration {
 static constexpr uint32_t CHANNELS_PER_PIXEL = 3;
 static constexpr uint32_t UNIVERSE_MAX_LENGTH = 510;///< 512 / 3 {CHANNELS_PER_PIXEL} -> 170 * 3 {CHANNELS_PER_PIXEL} = 510
 static constexpr uint32_t COUNT_MAX = 480;			///< 1440 / 3 {CHANNELS_PER_PIXEL}
+static constexpr uint32_t STRIPS_MAX = 8;			///< Strips with their own brightness
+static constexpr uint32_t UPDATE_PERIOD_MIN = 1000;	///< us, advertised when nothing has been measured yet
 }  // namespace configuration
 static constexpr uint16_t UDP_PORT_DISCOVERY = 7331;
 static constexpr uint16_t UDP_PORT_DATA = 5078;
@@ -185,7 +188,7 @@ public:
 
 	void SetCount(const uint32_t nCount, const uint32_t nActivePorts, const bool hasGlobalBrightness) {
 		m_nCount = std::min(nCount, pp::configuration::COUNT_MAX);
-		m_nUniverses = 1 + (m_nCount / (1 + (pp::configuration::UNIVERSE_MAX_LENGTH / pp::configuration::CHANNELS_PER_PIXEL)));
+		m_nUniverses = std::max(1U, ((m_nCount * pp::configuration::CHANNELS_PER_PIXEL) + pp::configuration::UNIVERSE_MAX_LENGTH - 1) / pp::configuration::UNIVERSE_MAX_LENGTH);
 		m_nActivePorts = std::min(nActivePorts, pp::lightset::MAX_PORTS / 3U);
 		m_nPortIndexLast = m_nActivePorts * m_nUniverses;
 		m_hasGlobalBrightness = hasGlobalBrightness;
@@ -203,6 +206,10 @@ public:
 
 private:
 	void HandlePusherCommand(const uint8_t *pBuffer, uint32_t nSize);
+	void HandleSequence(const uint32_t nSequenceNumber);
+	void HandleStrip(const uint8_t *pStrip);
+	void Output();
+	void SendDiscovery();
 
 private:
 	uint32_t m_nMillis;
@@ -215,6 +222,22 @@ private:
 	uint32_t m_nPortIndexLast { 0 };
 	uint32_t m_nActivePorts { 0 };
 	bool m_hasGlobalBrightness { false };
+	/*
+	 * Flow control, reported in the discovery packet.
+	 * The sender spaces its packets by update_period and backs off
+	 * while delta_sequence reports lost packets.
+	 */
+	uint32_t m_nSequenceExpected { 0 };
+	uint32_t m_nDeltaSequence { 0 };
+	bool m_bSequenceValid { false };
+	uint16_t m_nOutputMicros { 0 };
+	EMA<3, uint32_t> m_OutputMicrosFilter;
+	/*
+	 * Brightness, 0xFFFF is 1.0
+	 */
+	uint16_t m_nGlobalBrightness { 0xFFFF };
+	uint16_t m_nStripBrightness[pp::configuration::STRIPS_MAX];
+	uint8_t m_Scaled[pp::configuration::UNIVERSE_MAX_LENGTH];
 
 	LightSet *m_pLightSet { nullptr };
 
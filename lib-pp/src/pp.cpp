@@ -72,13 +72,17 @@ PixelPusher::PixelPusher(): m_nMillis(Hardware::Get()->Millis()) {
 	m_DiscoveryPacket.header.sw_revision = pp::version::MIN;
 	m_DiscoveryPacket.header.link_speed = 10000000;
 	//
-	m_DiscoveryPacket.pixelpusher.base.update_period = 1000;
+	m_DiscoveryPacket.pixelpusher.base.update_period = pp::configuration::UPDATE_PERIOD_MIN;
 	m_DiscoveryPacket.pixelpusher.base.power_total = 1;
 	m_DiscoveryPacket.pixelpusher.base.max_strips_per_packet = 1; //TODO This can be m_nActivePorts ?
 	m_DiscoveryPacket.pixelpusher.base.my_port = pp::UDP_PORT_DATA;
 	//
 	m_DiscoveryPacket.pixelpusher.ext.segments = 1;
 
+	for (auto& nBrightness : m_nStripBrightness) {
+		nBrightness = 0xFFFF;
+	}
+
 	DEBUG_EXIT
 }
 
@@ -102,7 +106,11 @@ void PixelPusher::Start() {
 	m_DiscoveryPacket.pixelpusher.ext.strip_count_16 = static_cast<uint16_t>(m_nActivePorts);
 
 #if !defined(CONFIG_PP_16BITSTUFF)
-	m_DiscoveryPacket.pixelpusher.ext.pusher_flags = 0;
+	/*
+	 * The brightness is scaled in software, the strips do not support hardware brightness.
+	 * The strip_flags stay 0, there is no LED_CONFIGURE to change them.
+	 */
+	m_DiscoveryPacket.pixelpusher.ext.pusher_flags = static_cast<uint32_t>(pp::PusherFlags::GLOBAL_BRIGHTNESS) | static_cast<uint32_t>(pp::PusherFlags::STRIP_BRIGHTNESS);
 #else
 	static const uint32_t nPusherFlags = (m_hasGlobalBrightness ? static_cast<uint32_t>(pp::PusherFlags::GLOBAL_BRIGHTNESS) : 0) | static_cast<uint32_t>(pp::PusherFlags::DYNAMICS) | static_cast<uint32_t>(pp::PusherFlags::_16BITSTUFF);
 	m_DiscoveryPacket.pixelpusher.ext.pusher_flags = nPusherFlags;
@@ -137,10 +145,7 @@ void PixelPusher::Run() {
 			return;
 		}
 		m_nMillis = nMillis;
-		_pcast32 src;
-		src.u32 = Network::Get()->GetIp();
-		memcpy(m_DiscoveryPacket.header.ip_address, src.u8, 4);
-		Network::Get()->SendTo(m_nHandleDiscovery, reinterpret_cast<const void *>(&m_DiscoveryPacket), sizeof(struct pp::DiscoveryPacket),  static_cast<uint32_t>(~0), pp::UDP_PORT_DISCOVERY);
+		SendDiscovery();
 		return;
 	}
 
@@ -151,6 +156,13 @@ void PixelPusher::Run() {
 	m_nBytesReceived -= 4;
 	pData += 4;
 
+	HandleSequence(nSequenceNumber);
+
+	_pcast32 src;
+	src.u32 = nRemoteIP;
+	memcpy(m_DiscoveryPacket.pixelpusher.ext.last_driven_ip, src.u8, 4);
+	m_DiscoveryPacket.pixelpusher.ext.last_driven_port = nRemotePort;
+
 #if !defined(CONFIG_PP_16BITSTUFF)
 	if (m_nBytesReceived >= sizeof(COMMAND_MAGIC) && memcmp(pData, COMMAND_MAGIC, sizeof(COMMAND_MAGIC)) == 0) {
 		HandlePusherCommand(pData + sizeof(COMMAND_MAGIC), m_nBytesReceived - sizeof(COMMAND_MAGIC));
@@ -166,39 +178,147 @@ void PixelPusher::Run() {
 	const auto nReceivedStrips = m_nBytesReceived / m_nStripDataLength;
 
 	for (uint32_t i = 0; i < nReceivedStrips; i++) {
-		const auto nPortIndexStart = pData[0] * m_nUniverses;
-		uint32_t nPortIndex;
-		for (nPortIndex = nPortIndexStart; nPortIndex < (nPortIndexStart + m_nUniverses) && (m_nBytesReceived > 0); nPortIndex++) {
-			const auto nLightSetLength = std::min(std::min(m_nBytesReceived, pp::configuration::UNIVERSE_MAX_LENGTH), m_nStripDataLength - 1);
-
-//			DEBUG_PRINTF("i=%u, nPortIndex=%u, m_nBytesReceived=%u, nLightSetLength=%u", i, nPortIndex, m_nBytesReceived, nLightSetLength);
+		HandleStrip(pData);
+		pData += m_nStripDataLength;
+	}
+#else
+#endif
+}
 
-			lightset::Data::SetSourceA(nPortIndex, &pData[1], nLightSetLength);
+/**
+ * Sequence numbers missing since the previous discovery packet are
+ * accumulated. A jump back (sender restart) or a jump of more than a
+ * second worth of packets (new sender) only resynchronizes.
+ */
+void PixelPusher::HandleSequence(const uint32_t nSequenceNumber) {
+	if (m_bSequenceValid) {
+		const auto nDelta = static_cast<int32_t>(nSequenceNumber - m_nSequenceExpected);
 
-			m_nBytesReceived-=nLightSetLength;
-			pData+=nLightSetLength;
+		if ((nDelta > 0) && (nDelta < 1000)) {
+			m_nDeltaSequence += static_cast<uint32_t>(nDelta);
 		}
+	}
+
+	m_nSequenceExpected = nSequenceNumber + 1;
+	m_bSequenceValid = true;
+}
 
-		pData+=m_nStripDataLength;
+/**
+ * A strip is the strip number followed by its pixel data, which is split
+ * over the universes of the strip's port. The frame is output when the
+ * last strip has been received.
+ */
+void PixelPusher::HandleStrip(const uint8_t *pStrip) {
+	const uint32_t nStrip = pStrip[0];
 
-//		DEBUG_PRINTF("nPortIndex=%u, m_nPortIndexLast=%u", nPortIndex, m_nPortIndexLast);
+	if (nStrip >= m_nActivePorts) {
+		return;
+	}
+
+	uint32_t nBrightness = m_nGlobalBrightness;
 
-		if (nPortIndex == m_nPortIndexLast) {
-//			DEBUG_PUTS("Output");
-			for (uint32_t nLightSetPortIndex = 0; nLightSetPortIndex < m_nPortIndexLast; nLightSetPortIndex++) {
-				lightset::Data::Output(m_pLightSet, nLightSetPortIndex);
-				lightset::Data::ClearLength(nLightSetPortIndex);
+	if (nStrip < pp::configuration::STRIPS_MAX) {
+		nBrightness = (nBrightness * (m_nStripBrightness[nStrip] + 1U)) >> 16;
+	}
+
+	const auto *pPixels = &pStrip[1];
+	auto nRemaining = m_nStripDataLength - 1;
+	auto nPortIndex = nStrip * m_nUniverses;
+
+	while (nRemaining > 0) {
+		const auto nLength = std::min(nRemaining, pp::configuration::UNIVERSE_MAX_LENGTH);
+
+		if (__builtin_expect((nBrightness == 0xFFFF), 1)) {
+			lightset::Data::SetSourceA(nPortIndex, pPixels, nLength);
+		} else {
+			for (uint32_t i = 0; i < nLength; i++) {
+				m_Scaled[i] = static_cast<uint8_t>((pPixels[i] * (nBrightness + 1U)) >> 16);
 			}
+			lightset::Data::SetSourceA(nPortIndex, m_Scaled, nLength);
 		}
+
+		pPixels += nLength;
+		nRemaining -= nLength;
+		nPortIndex++;
 	}
-#else
-#endif
+
+	if (nStrip == (m_nActivePorts - 1)) {
+		Output();
+	}
+}
+
+void PixelPusher::Output() {
+	const auto nMicros = Hardware::Get()->Micros();
+
+	for (uint32_t nLightSetPortIndex = 0; nLightSetPortIndex < m_nPortIndexLast; nLightSetPortIndex++) {
+		lightset::Data::Output(m_pLightSet, nLightSetPortIndex);
+		lightset::Data::ClearLength(nLightSetPortIndex);
+	}
+
+	const auto nElapsed = std::min(Hardware::Get()->Micros() - nMicros, static_cast<uint32_t>(UINT16_MAX));
+	m_nOutputMicros = m_OutputMicrosFilter.Filter(static_cast<uint16_t>(nElapsed));
+}
+
+/**
+ * The update period is per packet, the sender sleeps this long after each
+ * packet. A frame is one packet per strip, so the frame time is divided
+ * over the strips. The frame time is the measured output time, but not
+ * less than the refresh time the output reports.
+ */
+void PixelPusher::SendDiscovery() {
+	uint32_t nFrameMicros = m_nOutputMicros;
+
+	if (m_pLightSet != nullptr) {
+		const auto nRefreshRate = m_pLightSet->GetRefreshRate();
+
+		if (nRefreshRate != 0) {
+			nFrameMicros = std::max(nFrameMicros, 1000000U / nRefreshRate);
+		}
+	}
+
+	const auto nStrips = std::max(1U, m_nActivePorts);
+
+	m_DiscoveryPacket.pixelpusher.base.update_period = std::max((nFrameMicros + nStrips - 1) / nStrips, pp::configuration::UPDATE_PERIOD_MIN);
+	m_DiscoveryPacket.pixelpusher.base.delta_sequence = m_nDeltaSequence;
+	m_nDeltaSequence = 0;
+
+	_pcast32 src;
+	src.u32 = Network::Get()->GetIp();
+	memcpy(m_DiscoveryPacket.header.ip_address, src.u8, 4);
+	Network::Get()->SendTo(m_nHandleDiscovery, reinterpret_cast<const void *>(&m_DiscoveryPacket), sizeof(struct pp::DiscoveryPacket),  static_cast<uint32_t>(~0), pp::UDP_PORT_DISCOVERY);
 }
 
 void PixelPusher::HandlePusherCommand([[maybe_unused]] const uint8_t *pBuffer, [[maybe_unused]] uint32_t nSize) {
 	DEBUG_ENTRY
 	DEBUG_PRINTF("pBuffer=%p, nSize=%u", reinterpret_cast<const void *>(pBuffer), nSize);
 #if !defined(CONFIG_PP_16BITSTUFF)
+	if (nSize < 1) {
+		DEBUG_EXIT
+		return;
+	}
+
+	const auto commandType = static_cast<pp::command::Type>(pBuffer[0]);
+	uint16_t nBrightness;
+
+	switch (commandType) {
+	case pp::command::Type::GLOBAL_BRIGHTNESS:
+		if (nSize >= (1 + sizeof(uint16_t))) {
+			memcpy(&nBrightness, &pBuffer[1], sizeof(uint16_t));
+			m_nGlobalBrightness = nBrightness;
+			DEBUG_PRINTF("GLOBAL_BRIGHTNESS %u", m_nGlobalBrightness);
+		}
+		break;
+	case pp::command::Type::STRIP_BRIGHTNESS:
+		if ((nSize >= (2 + sizeof(uint16_t))) && (pBuffer[1] < pp::configuration::STRIPS_MAX)) {
+			memcpy(&nBrightness, &pBuffer[2], sizeof(uint16_t));
+			m_nStripBrightness[pBuffer[1]] = nBrightness;
+			DEBUG_PRINTF("STRIP_BRIGHTNESS %u %u", pBuffer[1], nBrightness);
+		}
+		break;
+	default:
+		DEBUG_PRINTF("Command %u is not supported", pBuffer[0]);
+		break;
+	}
 #else
 #endif
 	DEBUG_EXIT
@@ -48,6 +48,18 @@ struct DevicesParamsConst {
 
 	static const char GAMMA_CORRECTION[];
 	static const char GAMMA_VALUE[];
+
+	static const char DITHERING[];
+	static const char WHITE_BALANCE[];
+
+	static const char INTERPOLATION[];
+
+	static const char MAX_FPS[];
+
+#if defined (CONFIG_PIXELDMX_MAX_PORTS)
+	static const char COUNT_PORT[CONFIG_PIXELDMX_MAX_PORTS][18];
+	static const char MAP_PORT[CONFIG_PIXELDMX_MAX_PORTS][24];
+#endif
 };
 
 #endif /* DEVICESPARAMSCONST_H_ */
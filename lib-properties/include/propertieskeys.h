@@ -0,0 +1,121 @@
+/**
+ * @file propertieskeys.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PROPERTIESKEYS_H_
+#define PROPERTIESKEYS_H_
+
+#include <cstdint>
+#include <cstring>
+
+namespace properties {
+struct Key {
+	const char *pName;
+	uint8_t nId;		///< Params specific key identifier
+	uint8_t nPort;		///< Port index of a per port key
+};
+
+/**
+ * Hashed lookup of the key of a "key=value" line, the line is scanned once.
+ * The keys are a constant table, the hash index is built on first use.
+ * The callback switches on the key identifier and decodes the value with Sscan.
+ */
+template<uint32_t N>
+class KeyTable {
+public:
+	explicit constexpr KeyTable(const Key (&keys)[N]): m_pKeys(keys) {}
+
+	const Key *Find(const char *pLine) {
+		if (!m_bIndexed) {
+			Index();
+		}
+
+		auto nHash = FNV_OFFSET_BASIS;
+		const auto *p = pLine;
+
+		while (*p != '=') {
+			if (*p == '\0') {
+				return nullptr;
+			}
+			nHash = (nHash ^ static_cast<uint8_t>(*p++)) * FNV_PRIME;
+		}
+
+		const auto nLength = static_cast<size_t>(p - pLine);
+		auto nSlot = nHash & (SLOTS - 1);
+
+		while (m_Slots[nSlot] != 0) {
+			const auto& key = m_pKeys[m_Slots[nSlot] - 1U];
+
+			if ((strncmp(key.pName, pLine, nLength) == 0) && (key.pName[nLength] == '\0')) {
+				return &key;
+			}
+
+			nSlot = (nSlot + 1) & (SLOTS - 1);
+		}
+
+		return nullptr;
+	}
+
+private:
+	static constexpr uint32_t FNV_OFFSET_BASIS = 2166136261U;
+	static constexpr uint32_t FNV_PRIME = 16777619U;
+
+	static constexpr uint32_t slots() {
+		uint32_t n = 1;
+		while (n < (2 * N)) {
+			n <<= 1;
+		}
+		return n;
+	}
+
+	static constexpr uint32_t SLOTS = slots();
+	static_assert(N < UINT8_MAX, "The slots hold the table index + 1");
+
+	void Index() {
+		for (uint32_t i = 0; i < N; i++) {
+			auto nHash = FNV_OFFSET_BASIS;
+
+			for (const auto *p = m_pKeys[i].pName; *p != '\0'; p++) {
+				nHash = (nHash ^ static_cast<uint8_t>(*p)) * FNV_PRIME;
+			}
+
+			auto nSlot = nHash & (SLOTS - 1);
+
+			while (m_Slots[nSlot] != 0) {
+				nSlot = (nSlot + 1) & (SLOTS - 1);
+			}
+
+			m_Slots[nSlot] = static_cast<uint8_t>(i + 1);
+		}
+
+		m_bIndexed = true;
+	}
+
+	const Key *m_pKeys;
+	uint8_t m_Slots[SLOTS] {};
+	bool m_bIndexed { false };
+};
+}  // namespace properties
+
+#endif /* PROPERTIESKEYS_H_ */
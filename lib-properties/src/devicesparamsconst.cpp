@@ -48,3 +48,58 @@ const char DevicesParamsConst::TEST_PATTERN[] = "test_pattern";
 const char DevicesParamsConst::GAMMA_CORRECTION[] = "gamma_correction";
 const char DevicesParamsConst::GAMMA_VALUE[] = "gamma_value";
 
+const char DevicesParamsConst::DITHERING[] = "dithering";
+const char DevicesParamsConst::WHITE_BALANCE[] = "white_balance";
+
+const char DevicesParamsConst::INTERPOLATION[] = "interpolation";
+
+const char DevicesParamsConst::MAX_FPS[] = "max_fps";
+
+#if defined (CONFIG_PIXELDMX_MAX_PORTS)
+const char DevicesParamsConst::COUNT_PORT[CONFIG_PIXELDMX_MAX_PORTS][18] = {
+		"led_count_port_1",
+#if CONFIG_PIXELDMX_MAX_PORTS > 2
+		"led_count_port_2",
+		"led_count_port_3",
+		"led_count_port_4",
+		"led_count_port_5",
+		"led_count_port_6",
+		"led_count_port_7",
+		"led_count_port_8",
+#endif
+#if CONFIG_PIXELDMX_MAX_PORTS == 16
+		"led_count_port_9",
+		"led_count_port_10",
+		"led_count_port_11",
+		"led_count_port_12",
+		"led_count_port_13",
+		"led_count_port_14",
+		"led_count_port_15",
+		"led_count_port_16"
+#endif
+};
+
+const char DevicesParamsConst::MAP_PORT[CONFIG_PIXELDMX_MAX_PORTS][24] = {
+		"led_rgb_mapping_port_1",
+#if CONFIG_PIXELDMX_MAX_PORTS > 2
+		"led_rgb_mapping_port_2",
+		"led_rgb_mapping_port_3",
+		"led_rgb_mapping_port_4",
+		"led_rgb_mapping_port_5",
+		"led_rgb_mapping_port_6",
+		"led_rgb_mapping_port_7",
+		"led_rgb_mapping_port_8",
+#endif
+#if CONFIG_PIXELDMX_MAX_PORTS == 16
+		"led_rgb_mapping_port_9",
+		"led_rgb_mapping_port_10",
+		"led_rgb_mapping_port_11",
+		"led_rgb_mapping_port_12",
+		"led_rgb_mapping_port_13",
+		"led_rgb_mapping_port_14",
+		"led_rgb_mapping_port_15",
+		"led_rgb_mapping_port_16"
+#endif
+};
+#endif
+
@@ -0,0 +1,105 @@
+/**
+ * @file test_propertieskeys.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "propertieskeys.h"
+#include "lightsetparamsconst.h"
+
+static int s_nFailed;
+
+#define CHECK(x)	do { if (!(x)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #x); s_nFailed++; } } while (0)
+
+enum class Key: uint8_t {
+	FAILSAFE, UNIVERSE_PORT, MERGE_MODE_PORT, NODE_LABEL, DIRECTION, OUTPUT_STYLE, DISABLE_MERGE_TIMEOUT
+};
+
+static constexpr properties::Key KEYS[] = {
+	{ LightSetParamsConst::FAILSAFE, static_cast<uint8_t>(Key::FAILSAFE), 0 },
+	{ LightSetParamsConst::UNIVERSE_PORT[0], static_cast<uint8_t>(Key::UNIVERSE_PORT), 0 },
+	{ LightSetParamsConst::UNIVERSE_PORT[1], static_cast<uint8_t>(Key::UNIVERSE_PORT), 1 },
+	{ LightSetParamsConst::UNIVERSE_PORT[2], static_cast<uint8_t>(Key::UNIVERSE_PORT), 2 },
+	{ LightSetParamsConst::UNIVERSE_PORT[3], static_cast<uint8_t>(Key::UNIVERSE_PORT), 3 },
+	{ LightSetParamsConst::MERGE_MODE_PORT[0], static_cast<uint8_t>(Key::MERGE_MODE_PORT), 0 },
+	{ LightSetParamsConst::MERGE_MODE_PORT[1], static_cast<uint8_t>(Key::MERGE_MODE_PORT), 1 },
+	{ LightSetParamsConst::MERGE_MODE_PORT[2], static_cast<uint8_t>(Key::MERGE_MODE_PORT), 2 },
+	{ LightSetParamsConst::MERGE_MODE_PORT[3], static_cast<uint8_t>(Key::MERGE_MODE_PORT), 3 },
+	{ LightSetParamsConst::NODE_LABEL[0], static_cast<uint8_t>(Key::NODE_LABEL), 0 },
+	{ LightSetParamsConst::NODE_LABEL[1], static_cast<uint8_t>(Key::NODE_LABEL), 1 },
+	{ LightSetParamsConst::NODE_LABEL[2], static_cast<uint8_t>(Key::NODE_LABEL), 2 },
+	{ LightSetParamsConst::NODE_LABEL[3], static_cast<uint8_t>(Key::NODE_LABEL), 3 },
+	{ LightSetParamsConst::DIRECTION[0], static_cast<uint8_t>(Key::DIRECTION), 0 },
+	{ LightSetParamsConst::DIRECTION[1], static_cast<uint8_t>(Key::DIRECTION), 1 },
+	{ LightSetParamsConst::DIRECTION[2], static_cast<uint8_t>(Key::DIRECTION), 2 },
+	{ LightSetParamsConst::DIRECTION[3], static_cast<uint8_t>(Key::DIRECTION), 3 },
+	{ LightSetParamsConst::OUTPUT_STYLE[0], static_cast<uint8_t>(Key::OUTPUT_STYLE), 0 },
+	{ LightSetParamsConst::OUTPUT_STYLE[1], static_cast<uint8_t>(Key::OUTPUT_STYLE), 1 },
+	{ LightSetParamsConst::OUTPUT_STYLE[2], static_cast<uint8_t>(Key::OUTPUT_STYLE), 2 },
+	{ LightSetParamsConst::OUTPUT_STYLE[3], static_cast<uint8_t>(Key::OUTPUT_STYLE), 3 },
+	{ LightSetParamsConst::DISABLE_MERGE_TIMEOUT, static_cast<uint8_t>(Key::DISABLE_MERGE_TIMEOUT), 0 }
+};
+
+int main() {
+	properties::KeyTable keyTable(KEYS);
+
+	// Every key is found, with the value after the '='
+	for (const auto& key : KEYS) {
+		char aLine[64];
+		snprintf(aLine, sizeof(aLine), "%s=1", key.pName);
+
+		const auto *pKey = keyTable.Find(aLine);
+		CHECK(pKey == &key);
+	}
+
+	const auto *pKey = keyTable.Find("universe_port_c=3");
+	CHECK((pKey != nullptr) && (pKey->nId == static_cast<uint8_t>(Key::UNIVERSE_PORT)) && (pKey->nPort == 2));
+
+	pKey = keyTable.Find("failsafe=");
+	CHECK((pKey != nullptr) && (pKey->nId == static_cast<uint8_t>(Key::FAILSAFE)));
+
+	// A prefix or an extension of a key is not a key
+	CHECK(keyTable.Find("universe_port=1") == nullptr);
+	CHECK(keyTable.Find("universe_port_aa=1") == nullptr);
+	CHECK(keyTable.Find("niverse_port_a=1") == nullptr);
+
+	// No '=' is no key
+	CHECK(keyTable.Find("universe_port_a") == nullptr);
+	CHECK(keyTable.Find("") == nullptr);
+	CHECK(keyTable.Find("=1") == nullptr);
+
+	// Unknown keys
+	CHECK(keyTable.Find("priority_port_a=100") == nullptr);
+	CHECK(keyTable.Find("#universe_port_a=1") == nullptr);
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return EXIT_FAILURE;
+	}
+
+	puts("propertieskeys: passed");
+	return EXIT_SUCCESS;
+}
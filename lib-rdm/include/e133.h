@@ -32,6 +32,11 @@
 
 #define VECTOR_ROOT_LLRP 			0x0000000A	/* Section 5.4 */
 
+/**
+ * LLRP Timing
+ */
+#define LLRP_MAX_BACKOFF_MILLIS		1500	///< Upper bound of the random Probe Reply delay
+
 /**
  * Table A-4: Vector Defines for LLRP PDU
  */
@@ -44,6 +49,12 @@
  */
 #define VECTOR_PROBE_REQUEST_DATA 0x01
 
+/**
+ * LLRP Probe Request Filter Values
+ */
+#define LLRP_FILTERVAL_CLIENT_CONN_INACTIVE	0x0001	///< Only Targets without an active connection to a Broker reply
+#define LLRP_FILTERVAL_BROKERS_ONLY			0x0002	///< Only Broker Targets reply
+
 /**
  * Table A-6: Vector Defines for LLRP Probe Reply PDU
  */
@@ -36,6 +36,7 @@
 #include "rdmhandler.h"
 
 #include "network.h"
+#include "hardware.h"
 
 #include "debug.h"
 
@@ -56,6 +57,19 @@ public:
 		assert(s_nHandleLLRP != -1);
 		Network::Get()->JoinGroup(s_nHandleLLRP, llrp::device::IPV4_LLRP_REQUEST);
 
+		/*
+		 * Every Target must pick a different backoff, so the seed is
+		 * derived from the MAC address instead of a shared constant.
+		 */
+		uint8_t macAddress[network::MAC_SIZE];
+		Network::Get()->MacAddressCopyTo(macAddress);
+
+		s_nRandom = 2166136261U;
+		for (uint32_t i = 0; i < network::MAC_SIZE; i++) {
+			s_nRandom = (s_nRandom ^ macAddress[i]) * 16777619U;
+		}
+		s_nRandom |= 1;
+
 		DEBUG_EXIT
 	}
 
@@ -69,6 +83,12 @@ public:
 	}
 
 	void Run() {
+		if (__builtin_expect((s_bProbeReplyPending), 0)) {
+			if ((Hardware::Get()->Millis() - s_nProbeReplyMillis) >= s_nProbeReplyBackoffMillis) {
+				SendProbeReply();
+			}
+		}
+
 		uint16_t nForeignPort;
 
 		const auto nBytesReceived = Network::Get()->RecvFrom(s_nHandleLLRP, const_cast<const void **>(reinterpret_cast<void **>(&s_pLLRP)), &s_nIpAddressFrom, &nForeignPort) ;
@@ -121,7 +141,16 @@ private:
 	}
 
 	void HandleRequestMessage();
+	void SendProbeReply();
 	void HandleRdmCommand();
+
+	static uint32_t GetRandom() {
+		// xorshift32
+		s_nRandom ^= s_nRandom << 13;
+		s_nRandom ^= s_nRandom >> 17;
+		s_nRandom ^= s_nRandom << 5;
+		return s_nRandom;
+	}
 	// DEBUG subject for deletions
 	void DumpCommon();
 	void DumpLLRP();
@@ -134,6 +163,11 @@ private:
 	static uint32_t s_nIpAddressFrom;
 	static uint8_t *s_pLLRP;
 	static TRdmMessage s_RdmCommand;
+	static TTProbeReplyPDUPacket s_ProbeReply;
+	static uint32_t s_nProbeReplyMillis;
+	static uint32_t s_nProbeReplyBackoffMillis;
+	static uint32_t s_nRandom;
+	static bool s_bProbeReplyPending;
 };
 
 #endif /* LLRPDEVICE_H_ */
@@ -168,6 +168,14 @@ private:
 
 	static const PidDefinition PID_DEFINITIONS[];
 	static const PidDefinition PID_DEFINITIONS_SUB_DEVICES[];
+
+	/*
+	 * PID_DEFINITIONS sorted by PID, built at compile time.
+	 * The table order itself is kept for SUPPORTED_PARAMETERS.
+	 */
+	struct PidIndex;
+	static const PidIndex PID_INDEX;
+	static const PidDefinition *FindPid(const uint16_t nParamId);
 #if defined (CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
 	static const PidDefinition PID_DEFINITION_MANUFACTURER_GENERAL;
 	static const rdm::ParameterDescription PARAMETER_DESCRIPTIONS[];
@@ -59,6 +59,7 @@ public:
 
 	void Run() {
 		LLRPDevice::Run();
+		RDMSensors::Get()->Run();
 	}
 
 	void Print() {
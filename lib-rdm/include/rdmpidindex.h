@@ -0,0 +1,90 @@
+/**
+ * @file rdmpidindex.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef RDMPIDINDEX_H_
+#define RDMPIDINDEX_H_
+
+#include <cstdint>
+
+namespace rdm {
+/**
+ * The indexes of a PID table sorted by PID, built at compile time.
+ * The table order itself is kept, for SUPPORTED_PARAMETERS.
+ * T has a member nPid.
+ */
+template<typename T, uint32_t N>
+class PidIndex {
+	static_assert(N <= UINT8_MAX, "The index holds uint8_t");
+
+public:
+	explicit constexpr PidIndex(const T (&table)[N]): m_pTable(table), m_nIndex() {
+		for (uint32_t i = 0; i < N; i++) {
+			auto j = i;
+			for (; (j > 0) && (table[m_nIndex[j - 1]].nPid > table[i].nPid); j--) {
+				m_nIndex[j] = m_nIndex[j - 1];
+			}
+			m_nIndex[j] = static_cast<uint8_t>(i);
+		}
+	}
+
+	constexpr bool IsUnique() const {
+		for (uint32_t i = 1; i < N; i++) {
+			if (m_pTable[m_nIndex[i - 1]].nPid == m_pTable[m_nIndex[i]].nPid) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	constexpr const T *Find(const uint16_t nPid) const {
+		uint32_t nLow = 0;
+		uint32_t nHigh = N;
+
+		while (nLow < nHigh) {
+			const auto nMiddle = (nLow + nHigh) / 2;
+			const auto& definition = m_pTable[m_nIndex[nMiddle]];
+
+			if (definition.nPid == nPid) {
+				return &definition;
+			}
+
+			if (definition.nPid < nPid) {
+				nLow = nMiddle + 1;
+			} else {
+				nHigh = nMiddle;
+			}
+		}
+
+		return nullptr;
+	}
+
+private:
+	const T *m_pTable;
+	uint8_t m_nIndex[N];
+};
+}  // namespace rdm
+
+#endif /* RDMPIDINDEX_H_ */
@@ -102,6 +102,8 @@ public:
 		const auto *pRdmDataIn = Rdm::Receive(0);
 
 		if (pRdmDataIn == nullptr) {
+			// A blocking sensor read must not delay the response to a received RDM request
+			RDMSensors::Get()->Run();
 			return rdm::responder::NO_DATA;
 		}
 
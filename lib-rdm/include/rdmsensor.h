@@ -31,6 +31,9 @@
 #include <cassert>
 #include <algorithm>
 
+#include "ema.h"
+#include "hardware.h"
+
 #include "debug.h"
 
 namespace rdm {
@@ -66,6 +69,9 @@ static constexpr int16_t TEMPERATURE_ABS_ZERO = -273;
 static constexpr uint8_t RECORDED_SUPPORTED = (1U << 0);
 static constexpr uint8_t LOW_HIGH_DETECT = (1U << 1);
 
+static constexpr uint32_t SAMPLE_PERIOD_MILLIS = 1000;
+static constexpr uint8_t FILTER_K = 2;	///< EMA weight 1/4
+
 template<class T>
 constexpr int16_t safe_range_max(const T &a) {
 	static_assert(sizeof(int16_t) <= sizeof(T), "T");
@@ -158,21 +164,46 @@ public:
 		return &m_tRDMSensorDefintion;
 	}
 
-	const struct rdm::sensor::Values *GetValues() {
-		DEBUG_ENTRY
-		const auto nValue = this->GetValue();
+	void SetSamplePeriod(const uint32_t nSamplePeriodMillis) {
+		m_nSamplePeriodMillis = nSamplePeriodMillis;
+	}
+
+	bool IsSampleDue(const uint32_t nMillis) const {
+		return !m_bIsSampled || ((nMillis - m_nSampleMillis) >= m_nSamplePeriodMillis);
+	}
+
+	/**
+	 * Called by RDMSensors::Run in the background, the conversion is not done in the RDM responder turnaround.
+	 * The reading is filtered, the lowest and highest detected are updated with every sample.
+	 */
+	void Sample(const uint32_t nMillis) {
+		// The EMA is unsigned
+		const auto nRaw = static_cast<uint16_t>(static_cast<uint16_t>(this->GetValue()) ^ 0x8000U);
+
+		if (!m_bIsSampled) {
+			m_Filter.Reset(nRaw);
+			m_bIsSampled = true;
+		}
+
+		const auto nValue = static_cast<int16_t>(m_Filter.Filter(nRaw) ^ 0x8000U);
 
 		m_tRDMSensorValues.present = nValue;
 		m_tRDMSensorValues.lowest_detected = std::min(m_tRDMSensorValues.lowest_detected, nValue);
 		m_tRDMSensorValues.highest_detected = std::max(m_tRDMSensorValues.highest_detected, nValue);
+		m_nSampleMillis = nMillis;
+	}
 
+	const struct rdm::sensor::Values *GetValues() {
+		DEBUG_ENTRY
+		Update();
 		DEBUG_EXIT
 		return &m_tRDMSensorValues;
 	}
 
 	void SetValues() {
 		DEBUG_ENTRY
-		const auto nValue = this->GetValue();
+		Update();
+		const auto nValue = m_tRDMSensorValues.present;
 
 		m_tRDMSensorValues.present = nValue;
 		m_tRDMSensorValues.lowest_detected = nValue;
@@ -184,23 +215,35 @@ public:
 
 	void Record() {
 		DEBUG_ENTRY
-		const auto nValue = this->GetValue();
-
-		m_tRDMSensorValues.present = nValue;
-		m_tRDMSensorValues.recorded = nValue;
-		m_tRDMSensorValues.lowest_detected = std::min(m_tRDMSensorValues.lowest_detected, nValue);
-		m_tRDMSensorValues.highest_detected = std::max(m_tRDMSensorValues.highest_detected, nValue);
-
+		Update();
+		m_tRDMSensorValues.recorded = m_tRDMSensorValues.present;
 		DEBUG_EXIT
 	}
 
 	virtual bool Initialize()=0;
 	virtual int16_t GetValue()=0;
 
+private:
+	/**
+	 * Without background sampling (RDMSensors::Run is not called) or when it is late,
+	 * the sensor is sampled here.
+	 */
+	void Update() {
+		const auto nMillis = Hardware::Get()->Millis();
+
+		if (!m_bIsSampled || ((nMillis - m_nSampleMillis) >= (2 * m_nSamplePeriodMillis))) {
+			Sample(nMillis);
+		}
+	}
+
 private:
 	uint8_t m_nSensor;
 	rdm::sensor::Defintion m_tRDMSensorDefintion;
 	rdm::sensor::Values m_tRDMSensorValues;
+	EMA<rdm::sensor::FILTER_K, uint32_t> m_Filter;
+	uint32_t m_nSamplePeriodMillis { rdm::sensor::SAMPLE_PERIOD_MILLIS };
+	uint32_t m_nSampleMillis { 0 };
+	bool m_bIsSampled { false };
 };
 
 #endif /* RDMSENSOR_H_ */
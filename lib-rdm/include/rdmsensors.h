@@ -31,6 +31,8 @@
 
 #include "rdmsensor.h"
 
+#include "hardware.h"
+
 #include "debug.h"
 
 #if defined (__APPLE__) || (defined (__linux__) && !defined (RASPPI))
@@ -156,6 +158,27 @@ public:
 		return m_pRDMSensor[nSensor];
 	}
 
+	/**
+	 * Background sampling, at most one sensor per call.
+	 * Called after the received requests are handled.
+	 */
+	void Run() {
+		if (m_nCount == 0) {
+			return;
+		}
+
+		const auto nMillis = Hardware::Get()->Millis();
+		auto *pRDMSensor = m_pRDMSensor[m_nSampleIndex];
+
+		if (pRDMSensor->IsSampleDue(nMillis)) {
+			pRDMSensor->Sample(nMillis);
+		}
+
+		if (++m_nSampleIndex == m_nCount) {
+			m_nSampleIndex = 0;
+		}
+	}
+
 	static RDMSensors* Get() {
 		return s_pThis;
 	}
@@ -163,6 +186,7 @@ public:
 private:
 	RDMSensor **m_pRDMSensor { nullptr };
 	uint8_t m_nCount { 0 };
+	uint8_t m_nSampleIndex { 0 };
 
 	static RDMSensors *s_pThis;
 };
@@ -43,6 +43,10 @@
 # undef CONFIG_RDM_ENABLE_SUBDEVICES
 #endif
 
+#if defined (CONFIG_RDM_ENABLE_SUBDEVICES)
+# include "hal_spi.h"
+#endif
+
 namespace rdm {
 namespace subdevices {
 static constexpr auto MAX = 8;
@@ -221,7 +225,15 @@ public:
 		DEBUG_ENTRY
 	}
 
+	/**
+	 * All sub-devices are updated from one frame in a single bus batch.
+	 * Each sub-device writes only its changed slots and consecutive
+	 * transactions on the same bus settings skip the SPI setup.
+	 */
 	void SetData(const uint8_t *pData, const uint32_t nLength) {
+#if defined (CONFIG_RDM_ENABLE_SUBDEVICES)
+		HAL_SPI::BatchBegin();
+#endif
 		for (uint32_t i = 0; i < m_nCount; i++) {
 			if (m_pRDMSubDevice[i] != nullptr) {
 				if (nLength >= (static_cast<uint16_t>(m_pRDMSubDevice[i]->GetDmxStartAddress() + m_pRDMSubDevice[i]->GetDmxFootPrint()) - 1U)) {
@@ -229,6 +241,9 @@ public:
 				}
 			}
 		}
+#if defined (CONFIG_RDM_ENABLE_SUBDEVICES)
+		HAL_SPI::BatchEnd();
+#endif
 	}
 
 	static RDMSubDevices* Get() {
@@ -51,6 +51,24 @@ uint32_t LLRPDevice::s_nIpAddressFrom;
 uint8_t *LLRPDevice::s_pLLRP;
 TRdmMessage LLRPDevice::s_RdmCommand;
 
+TTProbeReplyPDUPacket LLRPDevice::s_ProbeReply;
+uint32_t LLRPDevice::s_nProbeReplyMillis;
+uint32_t LLRPDevice::s_nProbeReplyBackoffMillis;
+uint32_t LLRPDevice::s_nRandom;
+bool LLRPDevice::s_bProbeReplyPending;
+
+namespace llrp {
+namespace device {
+static uint64_t uid_to_uint(const uint8_t *pUid) {
+	uint64_t nUid = 0;
+	for (uint32_t i = 0; i < RDM_UID_SIZE; i++) {
+		nUid = (nUid << 8) | pUid[i];
+	}
+	return nUid;
+}
+}  // namespace device
+}  // namespace llrp
+
 void LLRPDevice::HandleRequestMessage() {
 	DEBUG_ENTRY
 
@@ -58,43 +76,85 @@ void LLRPDevice::HandleRequestMessage() {
 	const auto *pPdu = pRequest->ProbeRequestPDU.FlagsLength;
 	const auto nLength = (static_cast<uint32_t>((pPdu[0] & 0x0fu) << 16) | static_cast<uint32_t>(pPdu[1] << 8) | pPdu[2]);
 
-	uint8_t uid[RDM_UID_SIZE];
-	memcpy(uid, RDMDeviceResponder::Get()->GetUID(), RDM_UID_SIZE);
+	/*
+	 * This Target is never a Broker and never holds a Broker connection,
+	 * so only BROKERS_ONLY can filter it out.
+	 */
+	if ((__builtin_bswap16(pRequest->ProbeRequestPDU.Filter) & LLRP_FILTERVAL_BROKERS_ONLY) != 0) {
+		DEBUG_PUTS("Brokers only");
+		DEBUG_EXIT
+		return;
+	}
+
+	const auto nUid = llrp::device::uid_to_uint(RDMDeviceResponder::Get()->GetUID());
+
+	if ((nUid < llrp::device::uid_to_uint(pRequest->ProbeRequestPDU.LowerUUID)) || (nUid > llrp::device::uid_to_uint(pRequest->ProbeRequestPDU.UpperUUID))) {
+		DEBUG_PUTS("Not for me");
+		DEBUG_EXIT
+		return;
+	}
 
 	if (nLength > 18) {
-		const auto nKnownUIDs = (nLength - 18) / RDM_UID_SIZE;
+		auto nKnownUIDs = (nLength - 18) / RDM_UID_SIZE;
+
+		if (nKnownUIDs > e133::LLRP_KNOWN_UID_SIZE) {
+			nKnownUIDs = e133::LLRP_KNOWN_UID_SIZE;
+		}
+
+		/*
+		 * The list is compared as two words per entry, the high 32 bits
+		 * reject almost every entry without touching the device part.
+		 */
+		const auto nUidHigh = static_cast<uint32_t>(nUid >> 16);
+		const auto nUidLow = static_cast<uint16_t>(nUid);
 		const auto *p = pRequest->ProbeRequestPDU.KnownUUIDs;
 
-		for (uint32_t nIndex = 0; nIndex < nKnownUIDs; nIndex++) {
-			if (memcmp(p, uid, RDM_UID_SIZE) == 0) {
+		for (uint32_t nIndex = 0; nIndex < nKnownUIDs; nIndex++, p += RDM_UID_SIZE) {
+			const auto nHigh = (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) | (static_cast<uint32_t>(p[2]) << 8) | p[3];
+
+			if (__builtin_expect((nHigh != nUidHigh), 1)) {
+				continue;
+			}
+
+			if (static_cast<uint16_t>((p[4] << 8) | p[5]) == nUidLow) {
+				DEBUG_PUTS("Known UID");
+				/*
+				 * Already discovered, a reply still in the backoff queue is
+				 * no longer needed.
+				 */
+				s_bProbeReplyPending = false;
 				DEBUG_EXIT
 				return;
 			}
-			p += RDM_UID_SIZE;
 		}
 	}
 
-	debug_dump(pRequest->ProbeRequestPDU.LowerUUID, 2 * RDM_UID_SIZE);
-
-	if (!((memcmp(pRequest->ProbeRequestPDU.LowerUUID, uid, RDM_UID_SIZE) <= 0) && (memcmp(uid, pRequest->ProbeRequestPDU.UpperUUID, RDM_UID_SIZE) <= 0))) {
-		DEBUG_PUTS("Not for me");
-		DEBUG_EXIT
-		return;
-	}
-
-	auto *pReply = reinterpret_cast<struct TTProbeReplyPDUPacket *>(s_pLLRP);
-
-	uint8_t DestinationCid[16];
-	memcpy(DestinationCid, pReply->Common.RootLayerPDU.SenderCid, 16);
+	/*
+	 * The reply is built now, while the request is in the receive buffer,
+	 * and sent from Run() after a random backoff. A later request while the
+	 * reply is queued only refreshes the destination and transaction number,
+	 * the backoff is not restarted.
+	 */
+	const auto *pCommon = &pRequest->Common;
+	auto *pReply = &s_ProbeReply;
 
+	memcpy(&pReply->Common.RootLayerPreAmble, &pCommon->RootLayerPreAmble, sizeof(struct TRootLayerPreAmble));
 	// Root Layer PDU
+	pReply->Common.RootLayerPDU.FlagsLength[0] = 0xF0;
+	pReply->Common.RootLayerPDU.FlagsLength[1] = 0x00;
 	pReply->Common.RootLayerPDU.FlagsLength[2] = 67;
+	pReply->Common.RootLayerPDU.Vector = pCommon->RootLayerPDU.Vector;
 	Hardware::Get()->GetUuid(pReply->Common.RootLayerPDU.SenderCid);
 	// LLRP PDU
+	pReply->Common.LlrpPDU.FlagsLength[0] = 0xF0;
+	pReply->Common.LlrpPDU.FlagsLength[1] = 0x00;
 	pReply->Common.LlrpPDU.FlagsLength[2] = 44;
 	pReply->Common.LlrpPDU.Vector = __builtin_bswap32(VECTOR_LLRP_PROBE_REPLY);
-	memcpy(pReply->Common.LlrpPDU.DestinationCid, DestinationCid, 16);
+	memcpy(pReply->Common.LlrpPDU.DestinationCid, pCommon->RootLayerPDU.SenderCid, 16);
+	pReply->Common.LlrpPDU.TransactionNumber = pCommon->LlrpPDU.TransactionNumber;
 	// Probe Reply PDU
+	pReply->ProbeReplyPDU.FlagsLength[0] = 0xF0;
+	pReply->ProbeReplyPDU.FlagsLength[1] = 0x00;
 	pReply->ProbeReplyPDU.FlagsLength[2] = 17;
 	pReply->ProbeReplyPDU.Vector = VECTOR_PROBE_REPLY_DATA;
 	memcpy(pReply->ProbeReplyPDU.UID, RDMDeviceResponder::Get()->GetUID(), RDM_UID_SIZE);
@@ -105,11 +165,23 @@ void LLRPDevice::HandleRequestMessage() {
 	pReply->ProbeReplyPDU.ComponentType = LLRP_COMPONENT_TYPE_RPT_DEVICE;
 #endif
 
-	Network::Get()->SendTo(s_nHandleLLRP, pReply, sizeof(struct TTProbeReplyPDUPacket), llrp::device::IPV4_LLRP_RESPONSE, llrp::device::LLRP_PORT);
+	if (!s_bProbeReplyPending) {
+		s_bProbeReplyPending = true;
+		s_nProbeReplyMillis = Hardware::Get()->Millis();
+		s_nProbeReplyBackoffMillis = GetRandom() % (LLRP_MAX_BACKOFF_MILLIS + 1);
+		DEBUG_PRINTF("Backoff %u ms", s_nProbeReplyBackoffMillis);
+	}
+
+	DEBUG_EXIT
+}
+
+void LLRPDevice::SendProbeReply() {
+	DEBUG_ENTRY
+
+	s_bProbeReplyPending = false;
+
+	Network::Get()->SendTo(s_nHandleLLRP, &s_ProbeReply, sizeof(struct TTProbeReplyPDUPacket), llrp::device::IPV4_LLRP_RESPONSE, llrp::device::LLRP_PORT);
 
-#ifndef NDEBUG
-	DumpCommon();
-#endif
 	DEBUG_EXIT
 }
 
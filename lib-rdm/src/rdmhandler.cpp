@@ -31,6 +31,7 @@
 #include <cassert>
 
 #include "rdmhandler.h"
+#include "rdmpidindex.h"
 #include "rdmdeviceresponder.h"
 #include "rdmsensors.h"
 #include "rdmsubdevices.h"
@@ -60,7 +61,7 @@ enum class ResetMode: uint8_t {
 	COLD = 0xFF			///< A cold reset is the equivalent of removing and reapplying power to the device.
 };
 
-const RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS[] {
+constexpr RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS[] {
 	{E120_DEVICE_INFO,                	&RDMHandler::GetDeviceInfo,               	nullptr,                			0, false, true , true },
 	{E120_DEVICE_MODEL_DESCRIPTION,    	&RDMHandler::GetDeviceModelDescription,		nullptr,                 			0, true , true , true },
 	{E120_MANUFACTURER_LABEL,          	&RDMHandler::GetManufacturerLabel,         	nullptr,                        	0, true , true , true },
@@ -134,6 +135,12 @@ const RDMHandler::PidDefinition RDMHandler::PID_DEFINITIONS_SUB_DEVICES[] {
 #endif
 };
 
+struct RDMHandler::PidIndex: rdm::PidIndex<PidDefinition, sizeof(PID_DEFINITIONS) / sizeof(PID_DEFINITIONS[0])> {
+	constexpr PidIndex(): rdm::PidIndex<PidDefinition, sizeof(PID_DEFINITIONS) / sizeof(PID_DEFINITIONS[0])>(PID_DEFINITIONS) {}
+};
+
+constexpr RDMHandler::PidIndex RDMHandler::PID_INDEX;
+
 #if defined (CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
 # if defined (CONFIG_RDM_MANUFACTURER_PIDS_SET)
 const RDMHandler::PidDefinition RDMHandler::PID_DEFINITION_MANUFACTURER_GENERAL { 0, &RDMHandler::GetManufacturerPid, &RDMHandler::SetManufacturerPid, 0, false, true, false };
@@ -145,6 +152,8 @@ const RDMHandler::PidDefinition RDMHandler::PID_DEFINITION_MANUFACTURER_GENERAL
 RDMHandler::RDMHandler(bool bIsRdm): m_bIsRDM(bIsRdm) {
 	DEBUG_ENTRY
 
+	static_assert(PID_INDEX.IsUnique(), "Duplicate PID in PID_DEFINITIONS");
+
 #if defined (CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
 # ifndef NDEBUG
 	for (uint32_t i = 0; i < GetParameterDescriptionCount(); i++) {
@@ -370,6 +379,10 @@ void RDMHandler::HandleData(const uint8_t *pRdmDataIn, uint8_t *pRdmDataOut) {
 	DEBUG_EXIT
 }
 
+const RDMHandler::PidDefinition *RDMHandler::FindPid(const uint16_t nParamId) {
+	return PID_INDEX.Find(nParamId);
+}
+
 void RDMHandler::Handlers(bool bIsBroadcast, uint8_t nCommandClass, uint16_t nParamId, uint8_t nParamDataLength, uint16_t nSubDevice) {
 	DEBUG_ENTRY
 
@@ -387,21 +400,18 @@ void RDMHandler::Handlers(bool bIsBroadcast, uint8_t nCommandClass, uint16_t nPa
 		return;
 	}
 
-	PidDefinition const *pid_handler = nullptr;
+	auto *pid_handler = FindPid(nParamId);
 	auto bRDM = false;
 	auto bRDMNet = false;
 
-	for (auto &defintion: PID_DEFINITIONS) {
-		if (defintion.nPid == nParamId) {
-			pid_handler = &defintion;
-			bRDM = defintion.bRDM;
-			bRDMNet = defintion.bRDMNet;
-			break;
-		}
+	if (pid_handler != nullptr) {
+		bRDM = pid_handler->bRDM;
+		bRDMNet = pid_handler->bRDMNet;
 	}
 
 #if defined (CONFIG_RDM_ENABLE_MANUFACTURER_PIDS)
-	if (!pid_handler) {
+	// Manufacturer specific PIDs are in the range 0x8000-0xFFDF
+	if ((pid_handler == nullptr) && (nParamId >= 0x8000)) {
 		for (uint32_t i = 0; i < GetParameterDescriptionCount(); i++) {
 			if (PARAMETER_DESCRIPTIONS[i].pid == __builtin_bswap16(nParamId)) {
 				pid_handler = &PID_DEFINITION_MANUFACTURER_GENERAL;
@@ -0,0 +1,111 @@
+/**
+ * @file test_rdmpidindex.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "rdmpidindex.h"
+#include "rdm_e120.h"
+
+static int s_nFailed;
+
+#define CHECK(x)	do { if (!(x)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #x); s_nFailed++; } } while (0)
+
+struct PidDefinition {
+	uint16_t nPid;
+	bool bIncludeInSupportedParams;
+};
+
+// Not sorted, like RDMHandler::PID_DEFINITIONS
+static constexpr PidDefinition PID_DEFINITIONS[] = {
+	{ E120_DEVICE_INFO, false },
+	{ E120_DEVICE_MODEL_DESCRIPTION, true },
+	{ E120_MANUFACTURER_LABEL, true },
+	{ E120_DEVICE_LABEL, true },
+	{ E120_FACTORY_DEFAULTS, true },
+	{ E120_SOFTWARE_VERSION_LABEL, false },
+	{ E120_BOOT_SOFTWARE_VERSION_ID, true },
+	{ E120_BOOT_SOFTWARE_VERSION_LABEL, true },
+	{ E120_SUPPORTED_PARAMETERS, false },
+	{ E120_PARAMETER_DESCRIPTION, false },
+	{ E120_DEVICE_HOURS, true },
+	{ E120_LANGUAGE_CAPABILITIES, true },
+	{ E120_LANGUAGE, true },
+	{ E120_IDENTIFY_DEVICE, false },
+	{ E120_RESET_DEVICE, true },
+	{ E120_QUEUED_MESSAGE, true },
+	{ E120_SENSOR_DEFINITION, true },
+	{ E120_SENSOR_VALUE, true },
+	{ E120_DMX_PERSONALITY, true },
+	{ E120_DMX_START_ADDRESS, true }
+};
+
+static constexpr rdm::PidIndex PID_INDEX(PID_DEFINITIONS);
+
+static_assert(PID_INDEX.IsUnique());
+static_assert(PID_INDEX.Find(E120_DMX_START_ADDRESS) == &PID_DEFINITIONS[19]);
+static_assert(PID_INDEX.Find(E120_DEVICE_INFO) == &PID_DEFINITIONS[0]);
+
+static constexpr PidDefinition PID_DEFINITIONS_DUPLICATE[] = {
+	{ E120_DEVICE_INFO, false },
+	{ E120_DEVICE_LABEL, true },
+	{ E120_SUPPORTED_PARAMETERS, false },
+	{ E120_DEVICE_LABEL, true }
+};
+
+static_assert(!rdm::PidIndex(PID_DEFINITIONS_DUPLICATE).IsUnique());
+
+static constexpr PidDefinition PID_DEFINITIONS_SINGLE[] = {
+	{ E120_DEVICE_INFO, false }
+};
+
+static constexpr rdm::PidIndex PID_INDEX_SINGLE(PID_DEFINITIONS_SINGLE);
+
+int main() {
+	// Every PID is found at its own table entry
+	for (const auto& definition : PID_DEFINITIONS) {
+		CHECK(PID_INDEX.Find(definition.nPid) == &definition);
+	}
+
+	// Below, between and above the PIDs of the table
+	CHECK(PID_INDEX.Find(0) == nullptr);
+	CHECK(PID_INDEX.Find(E120_COMMS_STATUS) == nullptr);
+	CHECK(PID_INDEX.Find(E120_SLOT_INFO) == nullptr);
+	CHECK(PID_INDEX.Find(0x8000) == nullptr);
+	CHECK(PID_INDEX.Find(0xFFFF) == nullptr);
+
+	CHECK(PID_INDEX_SINGLE.Find(E120_DEVICE_INFO) == &PID_DEFINITIONS_SINGLE[0]);
+	CHECK(PID_INDEX_SINGLE.Find(E120_DEVICE_INFO - 1) == nullptr);
+	CHECK(PID_INDEX_SINGLE.Find(E120_DEVICE_INFO + 1) == nullptr);
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return EXIT_FAILURE;
+	}
+
+	puts("rdmpidindex: passed");
+	return EXIT_SUCCESS;
+}
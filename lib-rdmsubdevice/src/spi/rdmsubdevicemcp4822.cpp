@@ -47,27 +47,38 @@ RDMSubDeviceMCP4822::RDMSubDeviceMCP4822(uint16_t nDmxStartAddress, char nChipSs
 void RDMSubDeviceMCP4822::Data(const uint8_t* pData, uint32_t nLength) {
 	assert(nLength <= 512);
 
-	auto nOffset = static_cast<uint16_t>(GetDmxStartAddress() - 1);
+	const auto nOffset = static_cast<uint16_t>(GetDmxStartAddress() - 1);
 
-	if (nOffset < nLength) {
-		const auto nDataA = static_cast<uint16_t>((pData[nOffset] << 4) | (pData[nOffset] >> 4));
-
-		if (nDataA != m_nDataA) {
-			m_MCP4822.WriteDacA(nDataA);
-			m_nDataA = nDataA;
-		}
+	if (nOffset >= nLength) {
+		return;
+	}
 
-		nOffset++;
+	const auto nDataA = static_cast<uint16_t>((pData[nOffset] << 4) | (pData[nOffset] >> 4));
+	const auto bChangedA = (nDataA != m_nDataA);
 
-		if (nOffset < nLength) {
-			const auto nDataB = static_cast<uint16_t>((pData[nOffset] << 4) | (pData[nOffset] >> 4));
+	if ((nOffset + 1U) < nLength) {
+		const auto nDataB = static_cast<uint16_t>((pData[nOffset + 1] << 4) | (pData[nOffset + 1] >> 4));
 
-			if (nDataB != m_nDataB) {
+		if (nDataB != m_nDataB) {
+			/*
+			 * Both channels in one bus setup, the second write skips it.
+			 */
+			if (bChangedA) {
+				m_MCP4822.WriteDacAB(nDataA, nDataB);
+				m_nDataA = nDataA;
+			} else {
 				m_MCP4822.WriteDacB(nDataB);
-				m_nDataB = nDataB;
 			}
+
+			m_nDataB = nDataB;
+			return;
 		}
 	}
+
+	if (bChangedA) {
+		m_MCP4822.WriteDacA(nDataA);
+		m_nDataA = nDataA;
+	}
 }
 
 void RDMSubDeviceMCP4822::UpdateEvent(TRDMSubDeviceUpdateEvent tUpdateEvent) {
@@ -47,27 +47,38 @@ RDMSubDeviceMCP4902::RDMSubDeviceMCP4902(uint16_t nDmxStartAddress, char nChipSs
 void RDMSubDeviceMCP4902::Data(const uint8_t* pData, uint32_t nLength) {
 	assert(nLength <= 512);
 
-	auto nOffset = static_cast<uint16_t>(GetDmxStartAddress() - 1);
+	const auto nOffset = static_cast<uint16_t>(GetDmxStartAddress() - 1);
 
-	if (nOffset < nLength) {
-		const uint8_t nDataA = pData[nOffset];
-
-		if (nDataA != m_nDataA) {
-			m_MCP4902.WriteDacA(nDataA);
-			m_nDataA = nDataA;
-		}
+	if (nOffset >= nLength) {
+		return;
+	}
 
-		nOffset++;
+	const uint8_t nDataA = pData[nOffset];
+	const auto bChangedA = (nDataA != m_nDataA);
 
-		if (nOffset < nLength) {
-			const uint8_t nDataB = pData[nOffset];
+	if ((nOffset + 1U) < nLength) {
+		const uint8_t nDataB = pData[nOffset + 1];
 
-			if (nDataB != m_nDataB) {
+		if (nDataB != m_nDataB) {
+			/*
+			 * Both channels in one bus setup, the second write skips it.
+			 */
+			if (bChangedA) {
+				m_MCP4902.WriteDacAB(nDataA, nDataB);
+				m_nDataA = nDataA;
+			} else {
 				m_MCP4902.WriteDacB(nDataB);
-				m_nDataB = nDataB;
 			}
+
+			m_nDataB = nDataB;
+			return;
 		}
 	}
+
+	if (bChangedA) {
+		m_MCP4902.WriteDacA(nDataA);
+		m_nDataA = nDataA;
+	}
 }
 
 void RDMSubDeviceMCP4902::UpdateEvent(TRDMSubDeviceUpdateEvent tUpdateEvent) {
@@ -1,6 +1,6 @@
 $(info $$MAKE_FLAGS [${MAKE_FLAGS}])
 
-EXTRA_INCLUDES=../lib-network/include ../lib-properties/include ../lib-display/include ../lib-lightset/include
+EXTRA_INCLUDES=../lib-network/include ../lib-network/config ../lib-properties/include ../lib-display/include ../lib-lightset/include
 EXTRA_INCLUDES+=../lib-flashcode/include ../lib-flashcodeinstall/include
 
 ifneq ($(MAKE_FLAGS),)
@@ -6,98 +6,88 @@
 #include "httpd/httpd.h"
 
 #if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
-# include "dmx.js.h"
+# include "dmx.html.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
 #if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
-# include "rtc.html.h"
+# include "rtc.js.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */
-#include "static.js.h"
+#include "default.js.h"
 #include "styles.css.h"
-#include "index.js.h"
-#include "date.js.h"
-#if defined (ENABLE_PHY_SWITCH)
-# include "dsa.js.h"
-#endif /* (ENABLE_PHY_SWITCH) */
+#if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
+# include "rtc.html.h"
+#endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */
 #if defined (NODE_SHOWFILE)
 # include "showfile.html.h"
 #endif /* (NODE_SHOWFILE) */
-#include "default.js.h"
-#if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
-# include "rtc.js.h"
-#endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */
+#include "index.html.h"
+#if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
+# include "dmx.js.h"
+#endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
+#include "date.js.h"
+#include "static.js.h"
+#include "index.js.h"
 #if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
 # include "rdm.js.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
 #if !defined (CONFIG_HTTP_HTML_NO_TIME)
 # include "time.js.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_TIME) */
-#if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
-# include "rdm.html.h"
-#endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
-#include "index.html.h"
 #if defined (NODE_SHOWFILE)
 # include "showfile.js.h"
 #endif /* (NODE_SHOWFILE) */
+#if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
+# include "rdm.html.h"
+#endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
 #if !defined (CONFIG_HTTP_HTML_NO_TIME)
 # include "time.html.h"
 #endif /* !defined (CONFIG_HTTP_HTML_NO_TIME) */
-#if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
-# include "dmx.html.h"
-#endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
-#if defined (ENABLE_PHY_SWITCH)
-# include "dsa.html.h"
-#endif /* (ENABLE_PHY_SWITCH) */
 
 struct FilesContent {
 	const char *pFileName;
 	const char *pContent;
 	const uint32_t nContentLength;
 	const http::contentTypes contentType;
+	const uint32_t nETag;
+	const bool isGzip;
 };
 
 static constexpr struct FilesContent HttpContent[] = {
 #if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
-	{ "dmx.js", dmx_js, 1361, static_cast<http::contentTypes>(2) },
+	{ "dmx.html", dmx_html, 285, static_cast<http::contentTypes>(0), 0x6e5dc781, true },
 #endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
 #if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
-	{ "rtc.html", rtc_html, 1013, static_cast<http::contentTypes>(0) },
+	{ "rtc.js", rtc_js, 354, static_cast<http::contentTypes>(2), 0x7f6bf346, true },
 #endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */
-	{ "static.js", static_js, 1219, static_cast<http::contentTypes>(2) },
-	{ "styles.css", styles_css, 409, static_cast<http::contentTypes>(1) },
-	{ "index.js", index_js, 1140, static_cast<http::contentTypes>(2) },
-	{ "date.js", date_js, 716, static_cast<http::contentTypes>(2) },
-#if defined (ENABLE_PHY_SWITCH)
-	{ "dsa.js", dsa_js, 613, static_cast<http::contentTypes>(2) },
-#endif /* (ENABLE_PHY_SWITCH) */
-#if defined (NODE_SHOWFILE)
-	{ "showfile.html", showfile_html, 1305, static_cast<http::contentTypes>(0) },
-#endif /* (NODE_SHOWFILE) */
-	{ "default.js", default_js, 254, static_cast<http::contentTypes>(2) },
+	{ "default.js", default_js, 208, static_cast<http::contentTypes>(2), 0xdfd22bbb, true },
+	{ "styles.css", styles_css, 228, static_cast<http::contentTypes>(1), 0x2e4b735d, true },
 #if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
-	{ "rtc.js", rtc_js, 843, static_cast<http::contentTypes>(2) },
+	{ "rtc.html", rtc_html, 453, static_cast<http::contentTypes>(0), 0x24c351c3, true },
 #endif /* !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC) */
+#if defined (NODE_SHOWFILE)
+	{ "showfile.html", showfile_html, 554, static_cast<http::contentTypes>(0), 0x93e16e9b, true },
+#endif /* (NODE_SHOWFILE) */
+	{ "index.html", index_html, 344, static_cast<http::contentTypes>(0), 0x04d62a4e, true },
+#if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
+	{ "dmx.js", dmx_js, 568, static_cast<http::contentTypes>(2), 0xf1713cb1, true },
+#endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
+	{ "date.js", date_js, 316, static_cast<http::contentTypes>(2), 0xb16efd14, true },
+	{ "static.js", static_js, 496, static_cast<http::contentTypes>(2), 0x2ca1b4af, true },
+	{ "index.js", index_js, 593, static_cast<http::contentTypes>(2), 0xcc7ce1f0, true },
 #if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
-	{ "rdm.js", rdm_js, 991, static_cast<http::contentTypes>(2) },
+	{ "rdm.js", rdm_js, 484, static_cast<http::contentTypes>(2), 0x52907924, true },
 #endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
 #if !defined (CONFIG_HTTP_HTML_NO_TIME)
-	{ "time.js", time_js, 390, static_cast<http::contentTypes>(2) },
+	{ "time.js", time_js, 216, static_cast<http::contentTypes>(2), 0x1122013c, true },
 #endif /* !defined (CONFIG_HTTP_HTML_NO_TIME) */
-#if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
-	{ "rdm.html", rdm_html, 1142, static_cast<http::contentTypes>(0) },
-#endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
-	{ "index.html", index_html, 669, static_cast<http::contentTypes>(0) },
 #if defined (NODE_SHOWFILE)
-	{ "showfile.js", showfile_js, 1425, static_cast<http::contentTypes>(2) },
+	{ "showfile.js", showfile_js, 585, static_cast<http::contentTypes>(2), 0x9e9421c7, true },
 #endif /* (NODE_SHOWFILE) */
+#if !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER)
+	{ "rdm.html", rdm_html, 601, static_cast<http::contentTypes>(0), 0x7b13c7a7, true },
+#endif /* !defined (CONFIG_HTTP_HTML_NO_RDM) && defined (RDM_CONTROLLER) */
 #if !defined (CONFIG_HTTP_HTML_NO_TIME)
-	{ "time.html", time_html, 599, static_cast<http::contentTypes>(0) },
+	{ "time.html", time_html, 305, static_cast<http::contentTypes>(0), 0x11923fc8, true },
 #endif /* !defined (CONFIG_HTTP_HTML_NO_TIME) */
-#if !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI))
-	{ "dmx.html", dmx_html, 538, static_cast<http::contentTypes>(0) },
-#endif /* !defined (CONFIG_HTTP_HTML_NO_DMX) && (defined(OUTPUT_DMX_SEND) || defined(OUTPUT_DMX_SEND_MULTI)) */
-#if defined (ENABLE_PHY_SWITCH)
-	{ "dsa.html", dsa_html, 447, static_cast<http::contentTypes>(0) },
-#endif /* (ENABLE_PHY_SWITCH) */
 };
 
 #endif /* CONTENT_H_ */
@@ -1,47 +1,22 @@
 static constexpr char date_js[] = {
-0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x44,
-0x61, 0x74, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x28, 0x64, 0x61, 0x74, 0x65, 0x29, 0x20, 0x7B, 0x0A,
-0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x79, 0x65, 0x61, 0x72, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74,
-0x65, 0x2E, 0x67, 0x65, 0x74, 0x46, 0x75, 0x6C, 0x6C, 0x59, 0x65, 0x61, 0x72, 0x28, 0x29, 0x3B,
-0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6D, 0x6F, 0x6E, 0x20, 0x3D, 0x20, 0x28, 0x27, 0x30,
-0x27, 0x20, 0x2B, 0x20, 0x28, 0x64, 0x61, 0x74, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x4D, 0x6F, 0x6E,
-0x74, 0x68, 0x28, 0x29, 0x20, 0x2B, 0x20, 0x31, 0x29, 0x29, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65,
-0x28, 0x2D, 0x32, 0x29, 0x3B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x64, 0x61, 0x79, 0x20,
-0x3D, 0x20, 0x28, 0x27, 0x30, 0x27, 0x20, 0x2B, 0x20, 0x64, 0x61, 0x74, 0x65, 0x2E, 0x67, 0x65,
-0x74, 0x44, 0x61, 0x74, 0x65, 0x28, 0x29, 0x29, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x2D,
-0x32, 0x29, 0x3B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x68, 0x6F, 0x75, 0x72, 0x20, 0x3D,
-0x20, 0x28, 0x27, 0x30, 0x27, 0x20, 0x2B, 0x20, 0x64, 0x61, 0x74, 0x65, 0x2E, 0x67, 0x65, 0x74,
-0x48, 0x6F, 0x75, 0x72, 0x73, 0x28, 0x29, 0x29, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x2D,
-0x32, 0x29, 0x3B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6D, 0x69, 0x6E, 0x20, 0x3D, 0x20,
-0x28, 0x27, 0x30, 0x27, 0x20, 0x2B, 0x20, 0x64, 0x61, 0x74, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x4D,
-0x69, 0x6E, 0x75, 0x74, 0x65, 0x73, 0x28, 0x29, 0x29, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28,
-0x2D, 0x32, 0x29, 0x3B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x65, 0x63, 0x20, 0x3D,
-0x20, 0x28, 0x27, 0x30, 0x27, 0x20, 0x2B, 0x20, 0x64, 0x61, 0x74, 0x65, 0x2E, 0x67, 0x65, 0x74,
-0x53, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x28, 0x29, 0x29, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65,
-0x28, 0x2D, 0x32, 0x29, 0x3B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x66, 0x73,
-0x65, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x54, 0x69, 0x6D,
-0x65, 0x7A, 0x6F, 0x6E, 0x65, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x28, 0x29, 0x3B, 0x0A, 0x63,
-0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x48, 0x6F, 0x75, 0x72, 0x20,
-0x3D, 0x20, 0x28, 0x27, 0x30, 0x27, 0x20, 0x2B, 0x20, 0x4D, 0x61, 0x74, 0x68, 0x2E, 0x66, 0x6C,
-0x6F, 0x6F, 0x72, 0x28, 0x4D, 0x61, 0x74, 0x68, 0x2E, 0x61, 0x62, 0x73, 0x28, 0x6F, 0x66, 0x66,
-0x73, 0x65, 0x74, 0x29, 0x20, 0x2F, 0x20, 0x36, 0x30, 0x29, 0x29, 0x2E, 0x73, 0x6C, 0x69, 0x63,
-0x65, 0x28, 0x2D, 0x32, 0x29, 0x3B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x66,
-0x73, 0x65, 0x74, 0x4D, 0x69, 0x6E, 0x20, 0x3D, 0x20, 0x28, 0x27, 0x30, 0x27, 0x20, 0x2B, 0x20,
-0x4D, 0x61, 0x74, 0x68, 0x2E, 0x61, 0x62, 0x73, 0x28, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29,
-0x20, 0x25, 0x20, 0x36, 0x30, 0x29, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x2D, 0x32, 0x29,
-0x3B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x20, 0x3D, 0x20, 0x6F,
-0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3C, 0x3D, 0x20, 0x30, 0x20, 0x3F, 0x20, 0x27, 0x2B, 0x27,
-0x20, 0x3A, 0x20, 0x27, 0x2D, 0x27, 0x3B, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6F, 0x66, 0x66,
-0x73, 0x65, 0x74, 0x48, 0x6F, 0x75, 0x72, 0x20, 0x3D, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x26, 0x26,
-0x20, 0x28, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x4D, 0x69, 0x6E, 0x20, 0x3D, 0x3D, 0x20, 0x30,
-0x29, 0x29, 0x20, 0x7B, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x60, 0x24, 0x7B, 0x79,
-0x65, 0x61, 0x72, 0x7D, 0x2D, 0x24, 0x7B, 0x6D, 0x6F, 0x6E, 0x7D, 0x2D, 0x24, 0x7B, 0x64, 0x61,
-0x79, 0x7D, 0x54, 0x24, 0x7B, 0x68, 0x6F, 0x75, 0x72, 0x7D, 0x3A, 0x24, 0x7B, 0x6D, 0x69, 0x6E,
-0x7D, 0x3A, 0x24, 0x7B, 0x73, 0x65, 0x63, 0x7D, 0x5A, 0x60, 0x3B, 0x20, 0x20, 0x0A, 0x7D, 0x20,
-0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x60, 0x24, 0x7B, 0x79, 0x65, 0x61, 0x72, 0x7D,
-0x2D, 0x24, 0x7B, 0x6D, 0x6F, 0x6E, 0x7D, 0x2D, 0x24, 0x7B, 0x64, 0x61, 0x79, 0x7D, 0x54, 0x24,
-0x7B, 0x68, 0x6F, 0x75, 0x72, 0x7D, 0x3A, 0x24, 0x7B, 0x6D, 0x69, 0x6E, 0x7D, 0x3A, 0x24, 0x7B,
-0x73, 0x65, 0x63, 0x7D, 0x24, 0x7B, 0x73, 0x69, 0x67, 0x6E, 0x7D, 0x24, 0x7B, 0x6F, 0x66, 0x66,
-0x73, 0x65, 0x74, 0x48, 0x6F, 0x75, 0x72, 0x7D, 0x3A, 0x24, 0x7B, 0x6F, 0x66, 0x66, 0x73, 0x65,
-0x74, 0x4D, 0x69, 0x6E, 0x7D, 0x60, 0x3B, 0x20, 0x20, 0x20, 0x0A, 0x7D, 0x00
+'\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\x9D', '\x52', '\x3D', '\x6F', '\x83', '\x30',
+'\x10', '\xDD', '\xF9', '\x15', '\x37', '\xD0', '\x70', '\x56', '\x04', '\xA5', '\x1D', '\x3A', '\x84', '\xA2', '\x2E', '\x55',
+'\x95', '\x05', '\x75', '\x68', '\x96', '\x76', '\x0A', '\x05', '\x13', '\x2C', '\x81', '\x2D', '\x81', '\x19', '\x52', '\xC4',
+'\x7F', '\xEF', '\x5D', '\x9A', '\x0F', '\x1A', '\xE8', '\xD2', '\xC5', '\x67', '\xBD', '\x7B', '\xEF', '\xFC', '\xEE', '\xCE',
+'\x45', '\xA7', '\x33', '\xAB', '\x8C', '\x86', '\xC2', '\x34', '\x75', '\x6A', '\x9F', '\x53', '\x2B', '\x37', '\xAA', '\x96',
+'\x98', '\xD3', '\x45', '\x40', '\xEF', '\x64', '\x46', '\xB7', '\x16', '\xF6', '\x32', '\x6D', '\x20', '\x06', '\x06', '\x83',
+'\x9D', '\xB4', '\x2F', '\x5D', '\x55', '\xBD', '\x13', '\x84', '\x22', '\x3A', '\x12', '\x6A', '\xAA', '\x10', '\x03', '\x7A',
+'\xA1', '\x07', '\x4B', '\xC0', '\x13', '\x2F', '\x31', '\xDA', '\x96', '\x28', '\x08', '\xBA', '\x13', '\x22', '\x68', '\x2B',
+'\x95', '\x49', '\xF4', '\xEF', '\xCF', '\xA2', '\x3C', '\xDD', '\x5F', '\x44', '\x27', '\x0D', '\x3B', '\xC0', '\x39', '\x76',
+'\x69', '\xBA', '\x66', '\x4A', '\x5F', '\x13', '\xDA', '\xCE', '\xF2', '\x6B', '\xA5', '\xA7', '\xF4', '\x44', '\xE9', '\xCE',
+'\xCA', '\x79', '\x41', '\x2B', '\xB3', '\xA9', '\xE0', '\x4D', '\x52', '\x32', '\x9F', '\x17', '\x98', '\xA2', '\x68', '\xA5',
+'\x1D', '\xCD', '\x85', '\x27', '\xF7', '\x65', '\xB4', '\x7C', '\x3D', '\x24', '\xF0', '\x8A', '\xB8', '\xFE', '\xD5', '\x40',
+'\x92', '\xDA', '\x32', '\x28', '\x2A', '\x63', '\x1A', '\x3C', '\x5C', '\xD3', '\xCF', '\x16', '\x7F', '\x78', '\x02', '\x6E',
+'\xE1', '\x21', '\xFC', '\xFB', '\xC1', '\x64', '\xDC', '\xD8', '\x44', '\x7B', '\xC3', '\xDA', '\x99', '\xE6', '\xD4', '\x8E',
+'\x55', '\x47', '\xCB', '\x8F', '\x31', '\x84', '\xF0', '\x04', '\xDE', '\xD2', '\x83', '\x15', '\x78', '\xBE', '\x17', '\x39',
+'\xAA', '\x00', '\xC4', '\xB1', '\x4F', '\x62', '\x08', '\x58', '\x2C', '\x00', '\x47', '\x8F', '\x32', '\xC6', '\x9F', '\xA2',
+'\x91', '\xB6', '\x6B', '\x34', '\x6C', '\xDD', '\x9E', '\x3F', '\xC6', '\xE0', '\xBB', '\x3D', '\xED', '\x9F', '\x03', '\x6D',
+'\x74', '\xD8', '\xB8', '\x3D', '\xAF', '\x6A', '\x58', '\x11', '\xAA', '\x34', '\x07', '\x1A', '\xEC', '\xF0', '\xB1', '\x8D',
+'\x00', '\x9C', '\x01', '\xFE', '\xA3', '\xA5', '\x93', '\xDC', '\x53', '\xB8', '\xF8', '\xE3', '\xD4', '\xD9', '\xD8', '\xC0',
+'\xB5', '\xA9', '\xF8', '\x37', '\xCC', '\x53', '\xC1', '\xA9', '\xCC', '\x02', '\x00', '\x00', 0x00
 };
@@ -1,36 +1,20 @@
 static constexpr char dmx_html[] = {
-0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A,
-0x3C, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x3C, 0x6C, 0x69,
-0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68, 0x65,
-0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73,
-0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2F, 0x3E, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x44,
-0x4D, 0x58, 0x3C, 0x2F, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64,
-0x3E, 0x0A, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
-0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x4C, 0x69, 0x73, 0x74, 0x22,
-0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A,
-0x3C, 0x70, 0x3E, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69,
-0x63, 0x6B, 0x3D, 0x22, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x22, 0x3E, 0x52,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C,
-0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
-0x73, 0x74, 0x61, 0x74, 0x73, 0x22, 0x3E, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x64,
-0x3D, 0x22, 0x69, 0x64, 0x53, 0x74, 0x61, 0x74, 0x73, 0x22, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65,
-0x72, 0x3D, 0x27, 0x31, 0x27, 0x3E, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x2F,
-0x64, 0x69, 0x76, 0x3E, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
-0x22, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x22, 0x3E, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69,
-0x64, 0x3D, 0x22, 0x69, 0x64, 0x50, 0x6F, 0x72, 0x74, 0x73, 0x22, 0x20, 0x62, 0x6F, 0x72, 0x64,
-0x65, 0x72, 0x3D, 0x27, 0x31, 0x27, 0x3E, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C,
-0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x3C, 0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72, 0x3E, 0x3C, 0x75,
-0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x22,
-0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72, 0x3E, 0x0A,
-0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x73, 0x74, 0x61,
-0x74, 0x69, 0x63, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65,
-0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3E, 0x3C,
-0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
-0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x64, 0x6D, 0x78, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79,
-0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72,
-0x69, 0x70, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C,
-0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x6C, 0x69, 0x73, 0x74, 0x28, 0x29, 0x3B, 0x76, 0x65,
-0x72, 0x73, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28,
-0x29, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64,
-0x79, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x00
+'\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\x95', '\x52', '\xCD', '\x4E', '\xC3', '\x30',
+'\x0C', '\xBE', '\xF7', '\x29', '\x42', '\x2E', '\xDB', '\x2E', '\x8B', '\x38', '\xE3', '\xE6', '\xC2', '\xB8', '\x81', '\x98',
+'\x00', '\x21', '\x38', '\xA6', '\xA9', '\xA7', '\x66', '\xCB', '\x9A', '\x2A', '\x71', '\xAB', '\xED', '\xED', '\xF1', '\x9A',
+'\x6E', '\x62', '\x20', '\x21', '\x71', '\xB2', '\x65', '\x7F', '\x3F', '\xB6', '\x13', '\xB8', '\x59', '\x3D', '\xDF', '\xBF',
+'\x7D', '\xAE', '\x1F', '\x44', '\x43', '\x7B', '\xAF', '\x0B', '\x38', '\x07', '\x34', '\xB5', '\x06', '\xEF', '\xDA', '\x9D',
+'\x88', '\xE8', '\x4B', '\x99', '\xE8', '\xE8', '\x31', '\x35', '\x88', '\x24', '\x45', '\x13', '\x71', '\x73', '\xAE', '\x2C',
+'\x6D', '\x4A', '\x52', '\x28', '\x0D', '\xE4', '\xC8', '\xA3', '\x5E', '\x3D', '\x7D', '\x80', '\xCA', '\x29', '\xA8', '\x51',
+'\xA3', '\x80', '\x2A', '\xD4', '\xC7', '\x49', '\x11', '\xA3', '\x86', '\xDE', '\x0B', '\x57', '\x97', '\xD2', '\xD5', '\x8F',
+'\x2E', '\x91', '\x64', '\x58', '\xEF', '\x27', '\x2C', '\x77', '\x0B', '\xE8', '\x34', '\x54', '\x3D', '\x51', '\x68', '\x45',
+'\x68', '\xAD', '\x77', '\x76', '\x57', '\x4A', '\xB6', '\x8B', '\xEC', '\x3D', '\x5F', '\x48', '\xFD', '\x92', '\x53', '\x50',
+'\x19', '\xC3', '\xC4', '\x8E', '\x39', '\xB5', '\x1B', '\x84', '\xF5', '\x26', '\xA5', '\xD3', '\x54', '\x86', '\x12', '\xAB',
+'\x92', '\xA9', '\x3C', '\x4E', '\x46', '\xAF', '\x63', '\x4D', '\x54', '\x21', '\xB2', '\x45', '\x39', '\xBB', '\x9D', '\x31',
+'\x6D', '\xEC', '\x73', '\x64', '\xEA', '\xB5', '\x40', '\x17', '\xE2', '\x2F', '\x81', '\xF5', '\x58', '\xFB', '\x4B', '\x60',
+'\x13', '\x02', '\x5D', '\x2D', '\xF7', '\x8E', '\x31', '\xB9', '\xD0', '\x5E', '\xF6', '\x9B', '\x00', '\x05', '\x24', '\x1B',
+'\x5D', '\x47', '\x22', '\x45', '\x9B', '\x87', '\x75', '\x76', '\xB9', '\x65', '\x6D', '\x3A', '\x76', '\x58', '\x4A', '\xC2',
+'\x03', '\xA9', '\xAD', '\x19', '\x4C', '\x46', '\x9D', '\xD8', '\x39', '\xFB', '\x41', '\xAC', '\xF7', '\x87', '\x7F', '\xB1',
+'\xB4', '\xE7', '\x5B', '\xCF', '\x17', '\x77', '\x43', '\x9E', '\x8A', '\xB3', '\xCB', '\x4D', '\xBF', '\x61', '\xD5', '\xF4',
+'\x52', '\x6A', '\xFC', '\x03', '\x5F', '\xF8', '\x90', '\x25', '\xF0', '\x1A', '\x02', '\x00', '\x00', 0x00
 };
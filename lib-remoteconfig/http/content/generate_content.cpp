@@ -26,8 +26,11 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <cstdint>
 #include <dirent.h>
+#include <unistd.h>
 #include <cassert>
+#include <zlib.h>
 
 #include "httpd/httpd.h"
 
@@ -45,6 +48,8 @@ static constexpr char content_header[] =
 		"\tconst char *pContent;\n"
 		"\tconst uint32_t nContentLength;\n"
 		"\tconst http::contentTypes contentType;\n"
+		"\tconst uint32_t nETag;\n"
+		"\tconst bool isGzip;\n"
 		"};\n\n"
 		"static constexpr struct FilesContent HttpContent[] = {\n";
 
@@ -68,6 +73,7 @@ static constexpr char HAVE_RTC_END[] = "#endif /* !defined (CONFIG_HTTP_HTML_NO_
 
 static FILE *pFileContent;
 static FILE *pFileIncludes;
+static bool s_isGzip = true;
 
 static http::contentTypes getContentType(const char *pFileName) {
 	for (int i = 0; i < static_cast<int>(http::contentTypes::NOT_DEFINED); i++) {
@@ -86,7 +92,48 @@ static http::contentTypes getContentType(const char *pFileName) {
 	return http::contentTypes::NOT_DEFINED;
 }
 
-static int convert_to_h(const char *pFileName) {
+/*
+ * The ETag is calculated over the uncompressed content,
+ * so it only changes when the content itself changes.
+ */
+static uint32_t fnv1a(const unsigned char *pData, size_t nLength) {
+	uint32_t nHash = 2166136261U;
+
+	for (size_t i = 0; i < nLength; i++) {
+		nHash ^= pData[i];
+		nHash *= 16777619U;
+	}
+
+	return nHash;
+}
+
+/*
+ * gzip wrapper (windowBits 15 + 16), no file name and a zero time stamp,
+ * so the output is reproducible.
+ */
+static size_t gzip(const unsigned char *pIn, size_t nInLength, unsigned char *pOut, size_t nOutSize) {
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+
+	auto nResult = deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY);
+	assert(nResult == Z_OK);
+
+	stream.next_in = const_cast<unsigned char *>(pIn);
+	stream.avail_in = static_cast<uInt>(nInLength);
+	stream.next_out = pOut;
+	stream.avail_out = static_cast<uInt>(nOutSize);
+
+	nResult = deflate(&stream, Z_FINISH);
+	assert(nResult == Z_STREAM_END);
+
+	const auto nOutLength = stream.total_out;
+
+	deflateEnd(&stream);
+
+	return nOutLength;
+}
+
+static int convert_to_h(const char *pFileName, uint32_t& nETag) {
 	printf("File to convert: %s, ", pFileName);
 
 	auto *pFileIn = fopen(pFileName, "r");
@@ -199,9 +246,15 @@ static int convert_to_h(const char *pFileName) {
 	fwrite(pConstantName, sizeof(char), strlen(pConstantName), pFileContent);
 	fwrite("[] = {\n", sizeof(char), 7, pFileOut);
 
-	unsigned nOffset = 0;
+	fseek(pFileIn, 0, SEEK_END);
+	const auto nFileInSize = static_cast<size_t>(ftell(pFileIn));
+	fseek(pFileIn, 0, SEEK_SET);
+
+	auto *pContent = new unsigned char[nFileInSize + 1];
+	assert(pContent != nullptr);
+
 	auto doRemoveWhiteSpaces = true;
-	int nFileSize = 0;
+	size_t nContentLength = 0;
 	int c;
 
 	while ((c = fgetc (pFileIn)) != EOF) {
@@ -217,14 +270,34 @@ static int convert_to_h(const char *pFileName) {
 			}
 		}
 
-		i = snprintf(buffer, sizeof(buffer) - 1, "0x%02X,%c", c, ++nOffset % 16 == 0 ? '\n' : ' ');
+		pContent[nContentLength++] = static_cast<unsigned char>(c);
+	}
+
+	nETag = fnv1a(pContent, nContentLength);
+
+	const auto nOutSize = compressBound(static_cast<uLong>(nContentLength)) + 32;
+	auto *pOut = new unsigned char[nOutSize];
+	assert(pOut != nullptr);
+
+	size_t nFileSize;
+
+	if (s_isGzip) {
+		nFileSize = gzip(pContent, nContentLength, pOut, nOutSize);
+	} else {
+		memcpy(pOut, pContent, nContentLength);
+		nFileSize = nContentLength;
+	}
+
+	for (size_t nOffset = 0; nOffset < nFileSize; nOffset++) {
+		i = snprintf(buffer, sizeof(buffer) - 1, "'\\x%02X',%c", pOut[nOffset], (nOffset + 1) % 16 == 0 ? '\n' : ' ');
 		assert(i < static_cast<int>(sizeof(buffer)));
 
 		fwrite(buffer, sizeof(char), i, pFileOut);
-
-		nFileSize++;
 	}
 
+	delete [] pOut;
+	delete [] pContent;
+
 	fwrite("0x00\n};\n", sizeof(char), 8, pFileOut);
 
 	delete [] pFileNameOut;
@@ -233,12 +306,23 @@ static int convert_to_h(const char *pFileName) {
 	fclose(pFileIn);
 	fclose(pFileOut);
 
-	printf("File size: %d\n", nFileSize);
+	printf("Content size: %d, File size: %d, ETag: %08x\n", static_cast<int>(nContentLength), static_cast<int>(nFileSize), nETag);
 
-	return nFileSize;
+	return static_cast<int>(nFileSize);
 }
 
-int main() {
+int main(int argc, char **argv) {
+	int opt;
+
+	while ((opt = getopt(argc, argv, "u")) != -1) {
+		if (opt == 'u') {
+			s_isGzip = false;
+		} else {
+			fprintf(stderr, "Usage: %s [-u]\n  -u  do not compress the content\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
 	pFileIncludes = fopen("includes.h", "w");
 	assert(pFileIncludes != nullptr);
 
@@ -299,10 +383,11 @@ int main() {
 				fwrite(pFileName, sizeof(char), i, pFileContent);
 				delete[] pFileName;
 
-				auto nContentLength = convert_to_h(pDirEntry->d_name);
+				uint32_t nETag;
+				auto nContentLength = convert_to_h(pDirEntry->d_name, nETag);
 
-				char buffer[64];
-				i = snprintf(buffer, sizeof(buffer) - 1, ", %d, static_cast<http::contentTypes>(%d)", nContentLength, static_cast<int>(contentType));
+				char buffer[96];
+				i = snprintf(buffer, sizeof(buffer) - 1, ", %d, static_cast<http::contentTypes>(%d), 0x%08x, %s", nContentLength, static_cast<int>(contentType), nETag, s_isGzip ? "true" : "false");
 				assert(i < static_cast<int>(sizeof(buffer)));
 				fwrite(buffer, sizeof(char), i, pFileContent);
 
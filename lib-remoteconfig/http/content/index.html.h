@@ -1,44 +1,24 @@
 static constexpr char index_html[] = {
-0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A,
-0x3C, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x3C, 0x6C,
-0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68,
-0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65,
-0x73, 0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65,
-0x3E, 0x3C, 0x2F, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64,
-0x3E, 0x0A, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
-0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x4C, 0x69, 0x73, 0x74, 0x22,
-0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A,
-0x3C, 0x70, 0x3E, 0x3C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69,
-0x64, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x68,
-0x61, 0x6E, 0x67, 0x65, 0x3D, 0x22, 0x67, 0x65, 0x74, 0x5F, 0x74, 0x78, 0x74, 0x28, 0x74, 0x68,
-0x69, 0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x65, 0x6C,
-0x65, 0x63, 0x74, 0x3E, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
-0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x54, 0x78, 0x74, 0x22, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65,
-0x72, 0x3D, 0x27, 0x31, 0x27, 0x3E, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x0A, 0x3C,
-0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72, 0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69,
-0x64, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C,
-0x2F, 0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72, 0x3E, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x3C,
-0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6C, 0x6F, 0x63, 0x61, 0x74,
-0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
-0x69, 0x6E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63,
-0x6B, 0x3D, 0x22, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x28, 0x29, 0x22, 0x3E, 0x4C, 0x6F, 0x63,
-0x61, 0x74, 0x65, 0x20, 0x4F, 0x66, 0x66, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E,
-0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B,
-0x3D, 0x22, 0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x28, 0x29, 0x22, 0x3E, 0x52, 0x65, 0x62, 0x6F,
-0x6F, 0x74, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x3C, 0x2F, 0x64, 0x69,
-0x76, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22,
-0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D,
-0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
-0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72,
-0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x6A,
-0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61,
-0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69,
-0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D,
-0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70,
-0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69,
-0x70, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73,
-0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x6C, 0x69, 0x73, 0x74, 0x28, 0x29, 0x3B, 0x76, 0x65, 0x72,
-0x73, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79,
-0x28, 0x29, 0x3B, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62,
-0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x00
+'\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\x9D', '\x92', '\x3F', '\x4F', '\xC3', '\x30',
+'\x10', '\xC5', '\xF7', '\x7C', '\x0A', '\xE3', '\xA5', '\xED', '\x52', '\x8B', '\x19', '\x27', '\x03', '\x94', '\xAD', '\x52',
+'\x11', '\xAA', '\x90', '\x98', '\x90', '\x63', '\x5F', '\x1A', '\xB7', '\x26', '\x8E', '\xEC', '\x4B', '\x94', '\x7C', '\x7B',
+'\x2E', '\xFF', '\x4A', '\x61', '\x83', '\xC9', '\x2F', '\xF6', '\xEF', '\x9E', '\x5F', '\xEE', '\x2C', '\xEF', '\x76', '\x87',
+'\xA7', '\xE3', '\xFB', '\xCB', '\x33', '\x2B', '\xF1', '\xD3', '\x65', '\x89', '\x5C', '\x16', '\x50', '\x86', '\x16', '\x67',
+'\xAB', '\x0B', '\x0B', '\xE0', '\x52', '\x1E', '\xB1', '\x77', '\x10', '\x4B', '\x00', '\xE4', '\xAC', '\x0C', '\x50', '\x2C',
+'\x3B', '\x5B', '\x1D', '\x23', '\x67', '\x82', '\x58', '\xB4', '\xE8', '\x20', '\x93', '\x62', '\x5A', '\x13', '\x29', '\x66',
+'\x8F', '\xDC', '\x9B', '\x7E', '\x76', '\x84', '\x90', '\xC9', '\xC6', '\x31', '\x6B', '\x52', '\x6E', '\xCD', '\xDE', '\x46',
+'\xE4', '\xC4', '\x37', '\x2E', '\x9B', '\x58', '\x3A', '\x4D', '\x64', '\x9D', '\xC9', '\x08', '\x0E', '\x34', '\xCE', '\xD4',
+'\xCE', '\x06', '\xFA', '\xF0', '\xA1', '\xE7', '\xCC', '\x57', '\xBA', '\x54', '\xD5', '\x09', '\x52', '\x7E', '\x02', '\xFC',
+'\xC0', '\x0E', '\xD7', '\x58', '\xDA', '\xB8', '\x6D', '\x95', '\x6B', '\x60', '\x33', '\x38', '\x4D', '\x85', '\x24', '\xEA',
+'\x21', '\x8E', '\xCA', '\x1D', '\xCC', '\x26', '\xC7', '\x8E', '\x52', '\xE7', '\x3E', '\xD0', '\x15', '\xE9', '\xEA', '\x7E',
+'\x35', '\x84', '\x1C', '\x4E', '\x89', '\x2A', '\xBC', '\xC7', '\x1F', '\xA9', '\xDE', '\x20', '\x44', '\xEB', '\xAB', '\x6B',
+'\xB0', '\x19', '\x48', '\xA4', '\xB1', '\xED', '\xF0', '\x33', '\x0D', '\xA2', '\xAF', '\x46', '\xD6', '\x79', '\xAD', '\x10',
+'\x1E', '\xC7', '\x0D', '\xCE', '\xB4', '\x53', '\x31', '\x92', '\x41', '\xA5', '\x34', '\xDA', '\x16', '\xC6', '\xB4', '\xCE',
+'\xEA', '\xCB', '\xC2', '\xAD', '\x29', '\xE1', '\x7E', '\x54', '\xEC', '\x50', '\x14', '\x52', '\x4C', '\x46', '\xDF', '\x8E',
+'\x57', '\x3C', '\x40', '\x4E', '\x57', '\x0E', '\xF8', '\xEB', '\xA8', '\x6E', '\x50', '\x31', '\x65', '\x88', '\x3A', '\xD8',
+'\x1A', '\x59', '\x0C', '\x7A', '\x18', '\x82', '\x42', '\xAB', '\xB7', '\x67', '\x9A', '\x01', '\xF6', '\x35', '\xB5', '\x06',
+'\xA1', '\x43', '\x71', '\x56', '\xAD', '\x9A', '\xA8', '\xB1', '\x2D', '\xA3', '\xFA', '\x55', '\x68', '\x2B', '\x03', '\xDD',
+'\x3F', '\xEA', '\x0C', '\x14', '\xAA', '\x71', '\xF8', '\xA7', '\xCA', '\xCC', '\xD1', '\xA8', '\xD7', '\x9B', '\x87', '\x76',
+'\xEA', '\x2D', '\x29', '\xB3', '\x4C', '\x95', '\xF4', '\x0D', '\x2E', '\xE6', '\xB7', '\x22', '\xA6', '\x57', '\xF8', '\x05',
+'\x01', '\x94', '\x32', '\xA8', '\x9D', '\x02', '\x00', '\x00', 0x00
 };
@@ -1,74 +1,40 @@
 static constexpr char rdm_html[] = {
-0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A,
-0x3C, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x3C, 0x6C, 0x69,
-0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68, 0x65,
-0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73,
-0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2F, 0x3E, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x52,
-0x44, 0x4D, 0x3C, 0x2F, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64,
-0x3E, 0x0A, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
-0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x4C, 0x69, 0x73, 0x74, 0x22,
-0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A,
-0x3C, 0x70, 0x3E, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69,
-0x63, 0x6B, 0x3D, 0x22, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x22, 0x3E, 0x52,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C,
-0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x27, 0x6D, 0x61,
-0x72, 0x67, 0x69, 0x6E, 0x2D, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x32, 0x35, 0x70, 0x78, 0x3B,
-0x27, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x22, 0x3E, 0x4C, 0x6F, 0x61, 0x64, 0x69,
-0x6E, 0x67, 0x2E, 0x2E, 0x2E, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C, 0x2F,
-0x70, 0x3E, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63,
-0x66, 0x67, 0x22, 0x3E, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69,
-0x64, 0x43, 0x66, 0x67, 0x22, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3D, 0x27, 0x31, 0x27,
-0x3E, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A,
-0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x71, 0x75, 0x65, 0x22,
-0x3E, 0x57, 0x6F, 0x72, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x51, 0x75, 0x65, 0x75, 0x65, 0x3C, 0x62,
-0x72, 0x20, 0x2F, 0x3E, 0x0A, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x73, 0x74, 0x79, 0x6C,
-0x65, 0x3D, 0x27, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x66, 0x61, 0x6D, 0x69, 0x6C, 0x79, 0x3A, 0x22,
-0x43, 0x6F, 0x75, 0x72, 0x69, 0x65, 0x72, 0x20, 0x4E, 0x65, 0x77, 0x22, 0x2C, 0x20, 0x43, 0x6F,
-0x75, 0x72, 0x69, 0x65, 0x72, 0x2C, 0x20, 0x6D, 0x6F, 0x6E, 0x6F, 0x73, 0x70, 0x61, 0x63, 0x65,
-0x3B, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x38, 0x30, 0x25, 0x27,
-0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x51, 0x75, 0x65, 0x22, 0x20, 0x62, 0x6F, 0x72, 0x64,
-0x65, 0x72, 0x3D, 0x27, 0x30, 0x27, 0x3E, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x0A,
-0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x3E, 0x44, 0x69, 0x73, 0x63,
-0x6F, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x73, 0x3C, 0x62,
-0x72, 0x20, 0x2F, 0x3E, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69,
-0x64, 0x44, 0x69, 0x73, 0x22, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3D, 0x27, 0x31, 0x27,
-0x3E, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A,
-0x3C, 0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72, 0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22,
-0x69, 0x64, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E,
-0x3C, 0x2F, 0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70,
-0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2E, 0x6A, 0x73,
-0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76,
-0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70,
-0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22,
-0x72, 0x64, 0x6D, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65,
-0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3E, 0x3C,
-0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
-0x3E, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x63, 0x6F, 0x6E, 0x73,
-0x74, 0x20, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4A,
-0x53, 0x4F, 0x4E, 0x28, 0x27, 0x72, 0x64, 0x6D, 0x27, 0x29, 0x3B, 0x0A, 0x63, 0x6F, 0x6E, 0x73,
-0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x72, 0x2E, 0x72, 0x64, 0x6D, 0x3B,
-0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x62, 0x74, 0x6E, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63,
-0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
-0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x62, 0x74, 0x6E, 0x27, 0x29, 0x3B, 0x0A, 0x62, 0x74, 0x6E,
-0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x54, 0x65, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C,
-0x75, 0x65, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x30, 0x27, 0x20, 0x3F, 0x20, 0x27, 0x45, 0x6E,
-0x61, 0x62, 0x6C, 0x65, 0x27, 0x20, 0x3A, 0x20, 0x27, 0x44, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65,
-0x27, 0x3B, 0x0A, 0x62, 0x74, 0x6E, 0x2E, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x20, 0x3D,
-0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-0x28, 0x29, 0x20, 0x7B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x56, 0x61,
-0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x3D, 0x3D, 0x20,
-0x27, 0x30, 0x27, 0x20, 0x3F, 0x20, 0x27, 0x31, 0x27, 0x20, 0x3A, 0x20, 0x27, 0x30, 0x27, 0x3B,
-0x0A, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x50, 0x72, 0x6F, 0x6D, 0x69,
-0x73, 0x65, 0x28, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A,
-0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B, 0x20, 0x72, 0x64, 0x6D, 0x3A, 0x20, 0x6E, 0x65, 0x77, 0x56,
-0x61, 0x6C, 0x75, 0x65, 0x20, 0x7D, 0x29, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x28, 0x29, 0x20,
-0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x28, 0x29, 0x3B, 0x0A,
-0x7D, 0x29, 0x3B, 0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x29,
-0x3B, 0x0A, 0x7D, 0x3B, 0x0A, 0x7D, 0x0A, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E,
-0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x6C, 0x69, 0x73, 0x74, 0x28, 0x29, 0x3B,
-0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73,
-0x68, 0x28, 0x29, 0x3B, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x28, 0x29, 0x3B, 0x3C, 0x2F, 0x73,
-0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C,
-0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x00
+'\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\x95', '\x54', '\x61', '\x6B', '\xDB', '\x30',
+'\x10', '\xFD', '\xEE', '\x5F', '\x71', '\x13', '\x0C', '\x3B', '\xD0', '\xDA', '\xED', '\x60', '\x30', '\x12', '\xDB', '\x83',
+'\xB5', '\xFD', '\xB0', '\xD1', '\xB5', '\x5D', '\x57', '\x3A', '\xF6', '\x51', '\x91', '\xCF', '\x89', '\x5A', '\x59', '\xF2',
+'\x24', '\xD9', '\x6D', '\x56', '\xFA', '\xDF', '\x77', '\xB1', '\x95', '\xA4', '\x59', '\x61', '\x30', '\xB0', '\xD1', '\xF9',
+'\xF4', '\xDE', '\xBB', '\xA7', '\x93', '\xE4', '\xFC', '\xCD', '\xE9', '\xE5', '\xC9', '\xCD', '\xCF', '\xAB', '\x33', '\x58',
+'\xFA', '\x46', '\x95', '\x51', '\xBE', '\x19', '\x90', '\x57', '\x65', '\xAE', '\xA4', '\xBE', '\x07', '\x8B', '\xAA', '\x60',
+'\xCE', '\xAF', '\x14', '\xBA', '\x25', '\xA2', '\x67', '\xB0', '\xB4', '\x58', '\x6F', '\x32', '\xA9', '\x70', '\x8E', '\x41',
+'\x56', '\xE6', '\x5E', '\x7A', '\x85', '\xE5', '\xF5', '\xE9', '\xD7', '\x3C', '\x1B', '\xC3', '\x3C', '\x1B', '\x34', '\xA2',
+'\x7C', '\x6E', '\xAA', '\x55', '\x50', '\x44', '\x5B', '\xE6', '\x9D', '\x02', '\x59', '\x15', '\x4C', '\x56', '\xE7', '\xD2',
+'\x79', '\x46', '\xB0', '\x4E', '\x05', '\x2C', '\xCD', '\x46', '\x79', '\x5B', '\xE6', '\xF3', '\xCE', '\x7B', '\xA3', '\xC1',
+'\x68', '\xA1', '\xA4', '\xB8', '\x2F', '\x18', '\x95', '\xB3', '\x54', '\x3B', '\x99', '\xB0', '\xF2', '\x7A', '\x0C', '\xF3',
+'\x6C', '\xC4', '\x6C', '\xB1', '\x83', '\x99', '\x22', '\x6E', '\xB8', '\x5D', '\x48', '\x7D', '\xA8', '\xB0', '\xF6', '\x53',
+'\x78', '\xF7', '\xBE', '\x7D', '\x9C', '\xC5', '\x43', '\xB1', '\xB9', '\xD7', '\xAC', '\x3C', '\x37', '\xBC', '\x92', '\x7A',
+'\x91', '\xA6', '\xE9', '\x8E', '\x9E', '\xB5', '\x54', '\xB2', '\x92', '\x3D', '\x08', '\xC5', '\x9D', '\x2B', '\x98', '\xA8',
+'\x17', '\x64', '\xC9', '\xF3', '\xB9', '\xC2', '\xE0', '\xF2', '\x84', '\x32', '\x30', '\x37', '\x96', '\xDC', '\x15', '\xF1',
+'\x71', '\x4C', '\x94', '\x61', '\x96', '\x46', '\xA2', '\xED', '\x93', '\x7F', '\x75', '\xC8', '\xCA', '\x1F', '\xC6', '\xDE',
+'\x53', '\x15', '\xF8', '\xD6', '\x61', '\x87', '\xF9', '\xDC', '\x52', '\x6F', '\xA2', '\x20', '\x18', '\x4C', '\xD6', '\x46',
+'\xFB', '\xC3', '\x9A', '\x37', '\x52', '\xAD', '\xA6', '\xEC', '\xC4', '\x74', '\x56', '\xA2', '\x85', '\x0B', '\x7C', '\x60',
+'\x07', '\x10', '\xBE', '\x0E', '\xA0', '\x31', '\xDA', '\xB8', '\x96', '\x0B', '\x9C', '\xC1', '\x00', '\x77', '\xF2', '\x37',
+'\x4E', '\x3F', '\x1C', '\xBD', '\x8D', '\x83', '\x2B', '\x52', '\xDF', '\xB9', '\x3A', '\xDA', '\xB9', '\x8A', '\x5E', '\xD8',
+'\x2A', '\x4F', '\xA5', '\x13', '\xA6', '\x47', '\x8B', '\x15', '\x54', '\xD8', '\x4B', '\x81', '\x6E', '\xF4', '\xB3', '\xB7',
+'\x3E', '\x02', '\xFD', '\x73', '\x7D', '\xB5', '\x31', '\x7E', '\x6F', '\xDB', '\x6E', '\xD1', '\x3A', '\x69', '\xF4', '\x76',
+'\xE7', '\x02', '\x20', '\xCA', '\x9D', '\xB0', '\xB2', '\xF5', '\xE0', '\xAC', '\x58', '\x1F', '\x0E', '\xEE', '\xA5', '\x48',
+'\xEF', '\x48', '\xDB', '\xAF', '\x5A', '\x2C', '\x98', '\xC7', '\x47', '\x9F', '\xDD', '\xF1', '\x9E', '\x8F', '\xA8', '\x35',
+'\x7B', '\x8C', '\xFE', '\x22', '\xDA', '\xAA', '\xF9', '\x2F', '\x56', '\x19', '\x71', '\xB7', '\xD2', '\x02', '\xEA', '\x4E',
+'\x0B', '\x4F', '\xB6', '\xA0', '\x6B', '\x2B', '\xEE', '\x31', '\x99', '\xC0', '\x53', '\x24', '\x8C', '\x76', '\x1E', '\x2C',
+'\x14', '\xC0', '\x1F', '\xB8', '\xF4', '\xB0', '\x40', '\xFF', '\xE5', '\xFB', '\xE5', '\x45', '\x12', '\x53', '\x91', '\x78',
+'\x32', '\x0B', '\xF3', '\x3D', '\x57', '\x1D', '\x12', '\xC6', '\xA6', '\x94', '\xDE', '\x24', '\xE9', '\xC0', '\x50', '\xAA',
+'\x32', '\xA2', '\x6B', '\x50', '\xFB', '\x94', '\x98', '\x67', '\x0A', '\xD7', '\xE1', '\xA7', '\xD5', '\xE7', '\x2A', '\x89',
+'\x69', '\x7A', '\x2D', '\x40', '\x43', '\x2A', '\xB5', '\x46', '\x7B', '\x43', '\x3E', '\x09', '\x1F', '\xA4', '\x8A', '\x02',
+'\x68', '\x4F', '\xE0', '\x23', '\xC4', '\x67', '\x7A', '\xDD', '\xCB', '\x18', '\xA6', '\x10', '\x53', '\x9F', '\x87', '\x78',
+'\x64', '\x85', '\xB3', '\xBD', '\xB6', '\xB6', '\x6F', '\xFF', '\x85', '\x71', '\x8D', '\x0F', '\xB7', '\xC1', '\xDB', '\x2B',
+'\xE1', '\xE3', '\x41', '\xF3', '\x88', '\xD4', '\xC6', '\xA5', '\x11', '\x16', '\xAE', '\xAC', '\x69', '\xA4', '\xC3', '\x84',
+'\x2E', '\x88', '\x51', '\x3D', '\xC1', '\x4B', '\x92', '\x6A', '\x8D', '\xF3', '\xC9', '\x13', '\xD0', '\xD2', '\xA6', '\x3B',
+'\xC1', '\xE7', '\x49', '\xEA', '\x97', '\xA8', '\x13', '\x2A', '\x36', '\x80', '\x02', '\x23', '\xA1', '\x25', '\x3D', '\x87',
+'\x77', '\xD3', '\x46', '\xFA', '\xA2', '\x27', '\x7A', '\xDD', '\x77', '\x45', '\xB7', '\x97', '\xA6', '\xFB', '\xF1', '\x34',
+'\x50', '\xB4', '\xBD', '\xA5', '\xB3', '\x2D', '\xF7', '\x05', '\x2B', '\x0B', '\x7F', '\x81', '\x6C', '\xF8', '\xBF', '\xFC',
+'\x01', '\xB8', '\x79', '\x87', '\x89', '\x76', '\x04', '\x00', '\x00', 0x00
 };
@@ -1,55 +1,25 @@
 static constexpr char rtc_js[] = {
-0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x64,
-0x31, 0x3D, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28,
-0x27, 0x74, 0x69, 0x6D, 0x65, 0x64, 0x61, 0x74, 0x65, 0x27, 0x29, 0x0A, 0x63, 0x6F, 0x6E, 0x73,
-0x74, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x44,
-0x61, 0x74, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x28, 0x6E, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x65,
-0x28, 0x64, 0x31, 0x2E, 0x64, 0x61, 0x74, 0x65, 0x29, 0x29, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
-0x49, 0x64, 0x28, 0x27, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x27, 0x29, 0x2E, 0x74,
-0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x60, 0x4E, 0x6F,
-0x64, 0x65, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x3A, 0x20, 0x24, 0x7B, 0x6E, 0x6F, 0x64, 0x65, 0x7D,
-0x60, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x64, 0x32, 0x3D, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67,
-0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x27, 0x72, 0x74, 0x63, 0x61, 0x6C, 0x61, 0x72, 0x6D,
-0x27, 0x29, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x74, 0x63, 0x20, 0x3D, 0x20, 0x66,
-0x6F, 0x72, 0x6D, 0x61, 0x74, 0x44, 0x61, 0x74, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x28, 0x6E, 0x65,
-0x77, 0x20, 0x44, 0x61, 0x74, 0x65, 0x28, 0x64, 0x32, 0x2E, 0x72, 0x74, 0x63, 0x29, 0x29, 0x0A,
-0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D,
-0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x72, 0x74, 0x63, 0x54, 0x69, 0x6D, 0x65,
-0x27, 0x29, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D,
-0x20, 0x60, 0x52, 0x54, 0x43, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x3A, 0x20, 0x24, 0x7B, 0x72, 0x74,
-0x63, 0x7D, 0x60, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
-0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61, 0x6C, 0x61,
-0x72, 0x6D, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
-0x3D, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x44, 0x61, 0x74, 0x65, 0x54, 0x69, 0x6D, 0x65,
-0x28, 0x6E, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x65, 0x28, 0x64, 0x32, 0x2E, 0x61, 0x6C, 0x61,
-0x72, 0x6D, 0x29, 0x29, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
-0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x63, 0x68,
-0x6B, 0x62, 0x6F, 0x78, 0x27, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x3D,
-0x20, 0x28, 0x64, 0x32, 0x2E, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x3D, 0x3D, 0x3D,
-0x20, 0x22, 0x31, 0x22, 0x29, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75,
-0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x63, 0x54, 0x6F, 0x53, 0x79, 0x73, 0x28, 0x29,
-0x20, 0x7B, 0x0A, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B, 0x20,
-0x72, 0x74, 0x63, 0x3A, 0x20, 0x22, 0x22, 0x2C, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3A,
-0x20, 0x22, 0x68, 0x63, 0x74, 0x6F, 0x73, 0x79, 0x73, 0x22, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x72,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E,
-0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x54, 0x6F,
-0x48, 0x63, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x70, 0x6F, 0x73,
-0x74, 0x28, 0x7B, 0x20, 0x72, 0x74, 0x63, 0x3A, 0x20, 0x22, 0x22, 0x2C, 0x20, 0x61, 0x63, 0x74,
-0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x22, 0x73, 0x79, 0x73, 0x74, 0x6F, 0x68, 0x63, 0x22, 0x20, 0x7D,
-0x29, 0x3B, 0x0A, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x3B, 0x0A, 0x7D, 0x0A,
-0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61,
-0x6C, 0x61, 0x72, 0x6D, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x61,
-0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x61, 0x6C, 0x61, 0x72,
-0x6D, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A,
-0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x62, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
-0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49,
-0x64, 0x28, 0x27, 0x63, 0x68, 0x6B, 0x62, 0x6F, 0x78, 0x27, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63,
-0x6B, 0x65, 0x64, 0x20, 0x3F, 0x20, 0x22, 0x31, 0x22, 0x20, 0x3A, 0x20, 0x22, 0x30, 0x22, 0x3B,
-0x0A, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B, 0x20, 0x72, 0x74,
-0x63, 0x3A, 0x22, 0x22, 0x2C, 0x20, 0x61, 0x6C, 0x61, 0x72, 0x6D, 0x3A, 0x20, 0x61, 0x2C, 0x20,
-0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x3A, 0x20, 0x62, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x72, 0x65,
-0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x00
+'\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\x95', '\x92', '\xD1', '\x4A', '\xC3', '\x40',
+'\x10', '\x45', '\xDF', '\xF3', '\x15', '\x43', '\x10', '\x92', '\x40', '\x09', '\xB6', '\x8F', '\x09', '\x41', '\xB0', '\x0A',
+'\xD6', '\x87', '\x0A', '\x36', '\x1F', '\xE0', '\x76', '\x77', '\x6A', '\x4A', '\x93', '\xDD', '\x92', '\x9D', '\xD8', '\x86',
+'\xD2', '\x7F', '\x77', '\x36', '\x91', '\x82', '\x46', '\xA3', '\xBE', '\xED', '\x66', '\xEE', '\x9C', '\xBD', '\x73', '\x27',
+'\xC2', '\xB6', '\x5A', '\xC2', '\xA6', '\xD1', '\x92', '\xB6', '\x46', '\x43', '\x8D', '\x9B', '\x1A', '\x6D', '\x11', '\x46',
+'\x70', '\xF2', '\x4A', '\x24', '\x50', '\xD3', '\x4C', '\x1C', '\xC4', '\x96', '\xE0', '\x15', '\xE9', '\x71', '\xF5', '\xB4',
+'\x0C', '\x03', '\xDA', '\x56', '\xA8', '\x04', '\x61', '\x10', '\x79', '\xD2', '\x68', '\x4B', '\xA0', '\x8D', '\x42', '\xC8',
+'\x60', '\x63', '\xEA', '\x4A', '\xD0', '\x1D', '\x57', '\x72', '\x56', '\x84', '\x1A', '\x0F', '\xE0', '\x2E', '\xA1', '\x9A',
+'\xC6', '\x4E', '\x1E', '\x45', '\x9E', '\x32', '\xB2', '\xA9', '\x50', '\x53', '\xCC', '\xAC', '\xFB', '\x12', '\xDD', '\xF1',
+'\xB6', '\x5D', '\xA8', '\x30', '\x70', '\x04', '\xD7', '\x14', '\x44', '\x31', '\xE1', '\x91', '\xE6', '\x46', '\x13', '\xD7',
+'\x98', '\xF9', '\xB2', '\x74', '\x6C', '\x57', '\x4A', '\xE0', '\xEA', '\xE4', '\x64', '\xE7', '\x97', '\xDE', '\xD6', '\xEC',
+'\xAB', '\xAD', '\x9A', '\xA4', '\x28', '\x45', '\x5D', '\x5D', '\x6C', '\xF1', '\x87', '\x31', '\x57', '\xB3', '\x98', '\x05',
+'\x63', '\xA6', '\xB8', '\xFC', '\xBD', '\xA7', '\xE7', '\x7C', '\x7E', '\xB1', '\xC4', '\x22', '\x76', '\xF4', '\x23', '\xA3',
+'\x73', '\xB4', '\xD0', '\xFB', '\x86', '\x18', '\xF3', '\x26', '\xCA', '\x06', '\xC7', '\x2D', '\x75', '\xFA', '\x31', '\x53',
+'\xB2', '\xD8', '\xAD', '\xCD', '\x91', '\x61', '\xB2', '\x40', '\xB9', '\x43', '\xC5', '\x38', '\xD7', '\x87', '\x5A', '\xAC',
+'\x4B', '\x77', '\xCB', '\x32', '\xF0', '\xA7', '\x7E', '\xE4', '\x9D', '\x3D', '\xF1', '\x79', '\xAF', '\x85', '\xCC', '\xCD',
+'\xAA', '\xB5', '\xDD', '\x5E', '\xFB', '\xE4', '\xF6', '\xC6', '\x52', '\x78', '\x72', '\x31', '\x25', '\xE0', '\xFB', '\x13',
+'\x10', '\x9D', '\x90', '\xCF', '\x85', '\x24', '\x63', '\x5B', '\xEB', '\xC3', '\x39', '\x4A', '\xBD', '\xCB', '\xFF', '\x90',
+'\x0E', '\x99', '\x2C', '\xCA', '\xCD', '\x83', '\xFC', '\x0B', '\x93', '\xA5', '\x64', '\x0A', '\xF9', '\x3B', '\xB3', '\x4B',
+'\xA0', '\x23', '\xF6', '\x5B', '\x14', '\x3C', '\xE1', '\x3F', '\xE2', '\x4D', '\x3F', '\xDA', '\xD6', '\x63', '\x6D', '\x83',
+'\x10', '\x6F', '\x5C', '\x68', '\xC0', '\x36', '\xAF', '\xFD', '\x74', '\x38', '\x49', '\x37', '\x88', '\x7B', '\x29', '\x01',
+'\x31', '\x81', '\x3E', '\xEA', '\x84', '\x5F', '\x18', '\x8C', '\xF2', '\x0E', '\x9B', '\x9A', '\xE6', '\x40', '\x4B', '\x03',
+'\x00', '\x00', 0x00
 };
@@ -1,84 +1,37 @@
 static constexpr char showfile_html[] = {
-0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A,
-0x3C, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x3C, 0x6C,
-0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68,
-0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65,
-0x73, 0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65,
-0x3E, 0x3C, 0x2F, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64,
-0x3E, 0x0A, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
-0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x4C, 0x69, 0x73, 0x74, 0x22,
-0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A,
-0x3C, 0x70, 0x3E, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69,
-0x63, 0x6B, 0x3D, 0x22, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x22, 0x3E, 0x52,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C,
-0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69,
-0x64, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3D,
-0x27, 0x31, 0x27, 0x3E, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x0A, 0x3C, 0x64, 0x69,
-0x76, 0x3E, 0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69,
-0x63, 0x6B, 0x3D, 0x22, 0x70, 0x6C, 0x61, 0x79, 0x28, 0x29, 0x22, 0x3E, 0x50, 0x6C, 0x61, 0x79,
-0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F,
-0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x73, 0x74, 0x6F, 0x70, 0x28,
-0x29, 0x22, 0x3E, 0x53, 0x74, 0x6F, 0x70, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E,
-0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B,
-0x3D, 0x22, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x28, 0x29, 0x22, 0x3E, 0x52, 0x65, 0x73, 0x75,
-0x6D, 0x65, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x3C, 0x62, 0x75, 0x74,
-0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x72, 0x65, 0x63,
-0x6F, 0x72, 0x64, 0x28, 0x29, 0x22, 0x3E, 0x52, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x3C, 0x2F, 0x62,
-0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x3C, 0x64,
-0x69, 0x76, 0x3E, 0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x69, 0x64, 0x3D, 0x22,
-0x69, 0x64, 0x34, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x6C, 0x6F,
-0x6F, 0x70, 0x28, 0x29, 0x22, 0x3E, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A,
-0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x3C, 0x70, 0x3E, 0x50, 0x6C, 0x61, 0x79, 0x65, 0x72,
-0x20, 0x53, 0x68, 0x6F, 0x77, 0x20, 0x3C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64,
-0x3D, 0x22, 0x69, 0x64, 0x31, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3E,
-0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D,
-0x22, 0x73, 0x65, 0x6C, 0x28, 0x29, 0x22, 0x3E, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3C, 0x2F,
-0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x70, 0x3E, 0x53,
-0x65, 0x74, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20,
-0x66, 0x69, 0x6C, 0x65, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x69, 0x64, 0x3D,
-0x22, 0x69, 0x64, 0x33, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x72,
-0x65, 0x63, 0x28, 0x29, 0x22, 0x3E, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C,
-0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x70, 0x3E, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x53, 0x68,
-0x6F, 0x77, 0x20, 0x3C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69,
-0x64, 0x32, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3E, 0x3C, 0x62, 0x75,
-0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x64, 0x65,
-0x6C, 0x28, 0x29, 0x22, 0x3E, 0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x3C, 0x2F, 0x62, 0x75, 0x74,
-0x74, 0x6F, 0x6E, 0x3E, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72,
-0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x56, 0x65, 0x72, 0x73, 0x69,
-0x6F, 0x6E, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x66, 0x6F, 0x6F, 0x74, 0x65,
-0x72, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22,
-0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D,
-0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
-0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72,
-0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x73, 0x68, 0x6F, 0x77, 0x66, 0x69, 0x6C,
-0x65, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74,
-0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73,
-0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x66,
-0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x79, 0x28, 0x29, 0x7B, 0x73,
-0x65, 0x6E, 0x64, 0x28, 0x22, 0x70, 0x6C, 0x61, 0x79, 0x22, 0x29, 0x3B, 0x7D, 0x66, 0x75, 0x6E,
-0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x28, 0x29, 0x7B, 0x73, 0x65, 0x6E,
-0x64, 0x28, 0x22, 0x73, 0x74, 0x6F, 0x70, 0x22, 0x29, 0x3B, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74,
-0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x73, 0x65,
-0x6E, 0x64, 0x28, 0x22, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x22, 0x29, 0x3B, 0x7D, 0x66, 0x75,
-0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x28, 0x29, 0x20,
-0x7B, 0x73, 0x65, 0x6E, 0x64, 0x28, 0x22, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x22, 0x29, 0x3B,
-0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-0x20, 0x73, 0x65, 0x6E, 0x64, 0x28, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x29, 0x20, 0x7B, 0x61,
-0x77, 0x61, 0x69, 0x74, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B, 0x20, 0x73, 0x68, 0x6F, 0x77,
-0x3A, 0x20, 0x22, 0x22, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3A, 0x20, 0x73, 0x74,
-0x61, 0x74, 0x75, 0x73, 0x20, 0x7D, 0x29, 0x3B, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28,
-0x29, 0x3B, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-0x6F, 0x6E, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x28, 0x29, 0x20, 0x7B, 0x63, 0x6F, 0x6E, 0x73, 0x74,
-0x20, 0x76, 0x3D, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x69, 0x64, 0x34, 0x27,
-0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x3D, 0x20, 0x22,
-0x4C, 0x6F, 0x6F, 0x70, 0x69, 0x6E, 0x67, 0x22, 0x20, 0x3F, 0x20, 0x22, 0x31, 0x22, 0x20, 0x3A,
-0x20, 0x22, 0x30, 0x22, 0x3B, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x28,
-0x7B, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x3A, 0x22, 0x22, 0x2C, 0x6C, 0x6F, 0x6F, 0x70, 0x3A, 0x60,
-0x24, 0x7B, 0x76, 0x7D, 0x60, 0x20, 0x7D, 0x29, 0x3B, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68,
-0x28, 0x29, 0x3B, 0x7D, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73,
-0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x6C, 0x69, 0x73, 0x74, 0x28, 0x29, 0x3B, 0x76, 0x65, 0x72,
-0x73, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29,
-0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79,
-0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x00
+'\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\x95', '\x54', '\x5D', '\x8B', '\xDB', '\x30',
+'\x10', '\x7C', '\xCF', '\xAF', '\xD8', '\x8A', '\x42', '\x1C', '\x28', '\x71', '\xD3', '\xF6', '\x29', '\xB1', '\x5D', '\x68',
+'\xEF', '\xA0', '\x85', '\x94', '\x1E', '\xCD', '\x51', '\xE8', '\xDB', '\x39', '\xB2', '\x72', '\xD1', '\x9D', '\x4E', '\x32',
+'\xD6', '\xDA', '\xA9', '\x09', '\xF9', '\xEF', '\xB7', '\xB2', '\x9C', '\x0F', '\xDB', '\x25', '\xD0', '\xA7', '\x95', '\xB4',
+'\xB3', '\xB3', '\xB3', '\xF2', '\x58', '\xD1', '\x9B', '\x9B', '\x9F', '\x5F', '\xEF', '\xFF', '\xDC', '\xDD', '\xC2', '\x16',
+'\x5F', '\x54', '\x32', '\x8A', '\x8E', '\x41', '\xA4', '\x19', '\x05', '\x25', '\xF5', '\x33', '\x14', '\x42', '\xC5', '\xCC',
+'\x62', '\xAD', '\x84', '\xDD', '\x0A', '\x81', '\x0C', '\xB6', '\x85', '\xD8', '\x1C', '\x4F', '\xA6', '\xDC', '\x5A', '\x06',
+'\x21', '\x61', '\x51', '\xA2', '\x12', '\x49', '\x14', '\xFA', '\x38', '\x8A', '\xC2', '\x96', '\x63', '\x6D', '\xB2', '\xBA',
+'\x65', '\x14', '\x45', '\x12', '\x95', '\x0A', '\x64', '\x16', '\x33', '\x99', '\x2D', '\xA5', '\x45', '\x46', '\xF8', '\x52',
+'\x25', '\x1E', '\x4B', '\xD9', '\x51', '\x94', '\x27', '\xD1', '\xBA', '\x44', '\x34', '\x1A', '\x8C', '\xE6', '\x4A', '\xF2',
+'\xE7', '\x98', '\x51', '\xB7', '\x82', '\x5A', '\x07', '\x13', '\x96', '\xFC', '\xF2', '\xCB', '\x28', '\xF4', '\x18', '\x2A',
+'\xCC', '\x5D', '\xE7', '\x74', '\xAD', '\x44', '\xCB', '\xBA', '\xC2', '\x14', '\x4B', '\x52', '\xB4', '\x36', '\x05', '\x11',
+'\xC6', '\xE3', '\xD9', '\xD8', '\x49', '\x72', '\x00', '\x02', '\x66', '\xB2', '\x72', '\x82', '\x7A', '\xFC', '\xB9', '\x4A',
+'\x6B', '\x47', '\x7E', '\x47', '\xF1', '\xC4', '\x3C', '\x84', '\x59', '\x34', '\xB9', '\x83', '\xAD', '\x28', '\x5E', '\x81',
+'\x91', '\xBE', '\xF2', '\x45', '\x78', '\xB1', '\x6E', '\x75', '\x15', '\xCA', '\x49', '\xA5', '\x87', '\xBA', '\xD5', '\x05',
+'\x34', '\xF4', '\x52', '\x3B', '\x82', '\xFD', '\x80', '\x9F', '\xD8', '\x99', '\x40', '\x19', '\x2F', '\x69', '\x58', '\x98',
+'\x37', '\xD3', '\x88', '\x02', '\x56', '\x5B', '\xB3', '\x83', '\xC8', '\x0A', '\x25', '\x38', '\xB6', '\x0C', '\x33', '\x57',
+'\xE0', '\x4F', '\x86', '\x97', '\x4D', '\xE7', '\xCD', '\x90', '\x4D', '\xBA', '\x77', '\xCF', '\x39', '\x1D', '\x23', '\x68',
+'\xB1', '\x03', '\xAF', '\x9C', '\xE8', '\x37', '\x92', '\x6E', '\xBE', '\x2B', '\xF0', '\x23', '\xEB', '\x4C', '\xD8', '\xD1',
+'\x77', '\xE4', '\xB9', '\x21', '\x7A', '\x14', '\xFF', '\x12', '\xF7', '\xE1', '\x9A', '\xB8', '\xCC', '\x8B', '\xF3', '\xD5',
+'\x3D', '\xD2', '\x8D', '\x31', '\xD8', '\xF1', '\xD7', '\x6F', '\x51', '\x58', '\x69', '\xF4', '\xC9', '\x62', '\x2D', '\x60',
+'\x14', '\x59', '\x5E', '\xC8', '\x1C', '\xC1', '\x16', '\xDC', '\x7D', '\xD4', '\x14', '\x25', '\x9F', '\x3E', '\x91', '\x63',
+'\xB0', '\xCE', '\x45', '\xCC', '\x50', '\xFC', '\xC5', '\xF0', '\x29', '\xAD', '\x52', '\x8F', '\x6A', '\xD4', '\x34', '\xAB',
+'\x7E', '\x21', '\x49', '\x77', '\xC3', '\xFF', '\x57', '\x69', '\xB2', '\x29', '\x35', '\x47', '\x12', '\x05', '\xDE', '\x73',
+'\x7B', '\x2B', '\x74', '\x16', '\x34', '\x06', '\x64', '\x93', '\xC5', '\xE1', '\x94', '\xF5', '\x56', '\x6B', '\xB3', '\x6E',
+'\xD3', '\xC9', '\x1E', '\x1D', '\x06', '\x2D', '\xC0', '\xEF', '\x7B', '\x10', '\xEF', '\xAC', '\x33', '\xC4', '\xED', '\x1D',
+'\x64', '\x94', '\xDA', '\x5A', '\x73', '\x38', '\xB7', '\x72', '\x79', '\xDB', '\xFC', '\x34', '\x84', '\x4E', '\x77', '\xA9',
+'\x44', '\xC8', '\x8D', '\xC5', '\x60', '\x0F', '\x6E', '\xC4', '\x39', '\x30', '\xF6', '\x0E', '\x7C', '\x7E', '\xDE', '\x46',
+'\x38', '\x4C', '\x16', '\xA7', '\x7F', '\x72', '\xC8', '\xE8', '\x4D', '\x09', '\x7B', '\x6E', '\xB4', '\x45', '\xA8', '\xE2',
+'\xCC', '\x70', '\x92', '\xA7', '\x71', '\xFA', '\x28', '\xF0', '\x56', '\x09', '\xB7', '\xFC', '\x52', '\x7F', '\xCF', '\x82',
+'\x31', '\x79', '\x79', '\x3C', '\x99', '\x4A', '\xAD', '\x45', '\xF1', '\xED', '\xFE', '\xC7', '\x12', '\xE2', '\x18', '\xD8',
+'\x92', '\x8A', '\xA5', '\x7E', '\x64', '\xF0', '\x19', '\xD8', '\x8C', '\x01', '\xB5', '\x7F', '\xCF', '\x16', '\x43', '\x55',
+'\x24', '\xCA', '\xB5', '\x99', '\x3F', '\xBC', '\xDD', '\x57', '\x87', '\x87', '\x9E', '\xA0', '\xE1', '\xB5', '\x2B', '\x7A',
+'\x6A', '\x28', '\x53', '\x79', '\x47', '\x04', '\x17', '\xE8', '\x0B', '\x6C', '\xD8', '\x3E', '\x54', '\x61', '\xF3', '\x04',
+'\xBE', '\x02', '\x3B', '\x24', '\x91', '\x60', '\x19', '\x05', '\x00', '\x00', 0x00
 };
@@ -1,92 +1,39 @@
 static constexpr char showfile_js[] = {
-0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x74, 0x72, 0x79, 0x20, 0x7B,
-0x0A, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x28, 0x29, 0x0A, 0x6C, 0x65, 0x74,
-0x20, 0x64, 0x3D, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E,
-0x28, 0x27, 0x73, 0x68, 0x6F, 0x77, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75,
-0x73, 0x27, 0x29, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x73, 0x3D, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65,
-0x49, 0x6E, 0x74, 0x28, 0x64, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x29, 0x20, 0x3E, 0x3D, 0x20, 0x30,
-0x20, 0x26, 0x26, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x64, 0x2E, 0x73,
-0x68, 0x6F, 0x77, 0x29, 0x20, 0x3C, 0x3D, 0x20, 0x39, 0x39, 0x29, 0x20, 0x3F, 0x20, 0x64, 0x2E,
-0x73, 0x68, 0x6F, 0x77, 0x20, 0x3A, 0x20, 0x27, 0x4E, 0x6F, 0x6E, 0x65, 0x27, 0x0A, 0x6C, 0x65,
-0x74, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x3D, 0x64, 0x2E, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x3D, 0x3D,
-0x3D, 0x20, 0x22, 0x31, 0x22, 0x20, 0x3F, 0x20, 0x22, 0x59, 0x65, 0x73, 0x22, 0x20, 0x3A, 0x20,
-0x22, 0x4E, 0x6F, 0x22, 0x0A, 0x68, 0x3D, 0x60, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x64, 0x3E,
-0x4D, 0x6F, 0x64, 0x65, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x64,
-0x2E, 0x6D, 0x6F, 0x64, 0x65, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x20, 0x3C, 0x2F, 0x74, 0x72,
-0x3E, 0x60, 0x0A, 0x68, 0x2B, 0x3D, 0x60, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x53,
-0x68, 0x6F, 0x77, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x73, 0x7D,
-0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x20, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x60, 0x0A, 0x68, 0x2B, 0x3D,
-0x60, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3C,
-0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x64, 0x2E, 0x73, 0x74, 0x61, 0x74,
-0x75, 0x73, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x60, 0x0A, 0x68,
-0x2B, 0x3D, 0x60, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x4C, 0x6F, 0x6F, 0x70, 0x69,
-0x6E, 0x67, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x6C, 0x6F, 0x6F,
-0x70, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x60, 0x0A, 0x64, 0x6F,
-0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22,
-0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x27, 0x3C, 0x74, 0x61,
-0x62, 0x6C, 0x65, 0x3E, 0x27, 0x2B, 0x68, 0x2B, 0x27, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65,
-0x3E, 0x27, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x62, 0x3D, 0x64, 0x2E, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
-0x3D, 0x3D, 0x3D, 0x20, 0x22, 0x31, 0x22, 0x20, 0x3F, 0x20, 0x22, 0x4E, 0x6F, 0x20, 0x6C, 0x6F,
-0x6F, 0x70, 0x22, 0x20, 0x3A, 0x20, 0x22, 0x4C, 0x6F, 0x6F, 0x70, 0x69, 0x6E, 0x67, 0x22, 0x0A,
-0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D,
-0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x34, 0x22, 0x29, 0x2E, 0x69,
-0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x62, 0x0A, 0x7D, 0x20, 0x63, 0x61, 0x74,
-0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x7B, 0x7D, 0x0A, 0x7D, 0x0A, 0x61,
-0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65,
-0x6C, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x76, 0x3D, 0x64, 0x6F,
-0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x31, 0x22, 0x29, 0x2E, 0x76, 0x61, 0x6C,
-0x75, 0x65, 0x0A, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B, 0x20,
-0x73, 0x68, 0x6F, 0x77, 0x3A, 0x60, 0x24, 0x7B, 0x76, 0x7D, 0x60, 0x20, 0x7D, 0x29, 0x0A, 0x72,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63,
-0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x63, 0x28, 0x29, 0x20,
-0x7B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x76, 0x3D, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
-0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49,
-0x64, 0x28, 0x22, 0x69, 0x64, 0x33, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54,
-0x4D, 0x4C, 0x0A, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B, 0x20,
-0x73, 0x68, 0x6F, 0x77, 0x3A, 0x22, 0x22, 0x2C, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x65, 0x72,
-0x3A, 0x60, 0x24, 0x7B, 0x76, 0x7D, 0x60, 0x20, 0x7D, 0x29, 0x0A, 0x72, 0x65, 0x66, 0x72, 0x65,
-0x73, 0x68, 0x28, 0x29, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E,
-0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x65, 0x6C, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x63, 0x6F,
-0x6E, 0x73, 0x74, 0x20, 0x76, 0x3D, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67,
-0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69,
-0x64, 0x32, 0x22, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x0A, 0x61, 0x77, 0x61, 0x69, 0x74,
-0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x28, 0x7B, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x3A, 0x60, 0x24,
-0x7B, 0x76, 0x7D, 0x60, 0x20, 0x7D, 0x29, 0x0A, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28,
-0x29, 0x0A, 0x7D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x66, 0x28,
-0x64, 0x29, 0x20, 0x7B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x20, 0x3D, 0x20, 0x64,
-0x2E, 0x73, 0x68, 0x6F, 0x77, 0x73, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x73, 0x68, 0x6F, 0x77, 0x20,
-0x3D, 0x3E, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x29, 0x0A, 0x6C, 0x65,
-0x74, 0x20, 0x65, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x6C, 0x65,
-0x74, 0x20, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x29, 0x20, 0x7B, 0x0A, 0x69, 0x66, 0x20, 0x28,
-0x6E, 0x20, 0x21, 0x3D, 0x3D, 0x20, 0x65, 0x29, 0x20, 0x7B, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
-0x6E, 0x20, 0x65, 0x3B, 0x7D, 0x0A, 0x65, 0x2B, 0x2B, 0x3B, 0x0A, 0x7D, 0x0A, 0x72, 0x65, 0x74,
-0x75, 0x72, 0x6E, 0x20, 0x65, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75,
-0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79,
-0x28, 0x29, 0x20, 0x7B, 0x0A, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x64,
-0x3D, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x27,
-0x73, 0x68, 0x6F, 0x77, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F,
-0x72, 0x79, 0x27, 0x29, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x68, 0x3D, 0x22, 0x22, 0x0A, 0x6C, 0x65,
-0x74, 0x20, 0x66, 0x3D, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x6B, 0x65, 0x79, 0x73, 0x28,
-0x64, 0x5B, 0x22, 0x73, 0x68, 0x6F, 0x77, 0x73, 0x22, 0x5D, 0x29, 0x0A, 0x66, 0x2E, 0x66, 0x6F,
-0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6B,
-0x65, 0x79, 0x29, 0x20, 0x7B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x64, 0x5B,
-0x22, 0x73, 0x68, 0x6F, 0x77, 0x73, 0x22, 0x5D, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x0A, 0x68, 0x20,
-0x2B, 0x3D, 0x20, 0x22, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75,
-0x65, 0x3D, 0x22, 0x2B, 0x76, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x2B, 0x22, 0x3E, 0x22, 0x2B, 0x76,
-0x2E, 0x73, 0x68, 0x6F, 0x77, 0x2B, 0x22, 0x20, 0x7C, 0x20, 0x22, 0x2B, 0x76, 0x2E, 0x73, 0x69,
-0x7A, 0x65, 0x2B, 0x22, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x22, 0x0A, 0x7D,
-0x29, 0x3B, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x31, 0x22,
-0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x68, 0x0A,
-0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D,
-0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x32, 0x22, 0x29, 0x2E, 0x69,
-0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x68, 0x0A, 0x64, 0x6F, 0x63,
-0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
-0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x33, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65,
-0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x66, 0x66, 0x28, 0x64, 0x29, 0x0A, 0x7D, 0x20,
-0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x7B, 0x7D, 0x0A,
-0x7D, 0x00
+'\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\x8D', '\x54', '\xDF', '\x4F', '\xDB', '\x30',
+'\x10', '\x7E', '\xF7', '\x5F', '\x71', '\xB3', '\x10', '\x71', '\x94', '\x29', '\x85', '\xB1', '\x17', '\x68', '\x9C', '\x49',
+'\x93', '\x90', '\xC6', '\x04', '\xE5', '\x81', '\xBD', '\x4C', '\x08', '\xA9', '\x69', '\x7C', '\x21', '\xD9', '\x52', '\xBB',
+'\xB2', '\xDD', '\xA2', '\xD2', '\xE5', '\x7F', '\x9F', '\xE3', '\x94', '\xFE', '\x80', '\xAA', '\xED', '\x4B', '\xE2', '\xB3',
+'\xBF', '\xBB', '\xEF', '\xBE', '\xF3', '\x9D', '\x33', '\x33', '\x97', '\x39', '\x14', '\x53', '\x99', '\xDB', '\x4A', '\x49',
+'\xD0', '\x58', '\x68', '\x34', '\x25', '\x0B', '\x61', '\x41', '\xAC', '\x9E', '\xBB', '\xAF', '\xA8', '\x34', '\xE6', '\x56',
+'\xE9', '\x39', '\x0B', '\x49', '\x8D', '\x16', '\x04', '\xCF', '\x5E', '\xB2', '\xCA', '\xC2', '\x33', '\xDA', '\x9F', '\x0F',
+'\xF7', '\x03', '\x16', '\x98', '\x52', '\xBD', '\x14', '\x55', '\x8D', '\x3D', '\x63', '\x33', '\x3B', '\x35', '\x41', '\x07',
+'\x33', '\x9C', '\x4D', '\x32', '\x6D', '\xF0', '\x46', '\x5A', '\x26', '\xE2', '\x16', '\x13', '\x42', '\xCA', '\xE1', '\x0C',
+'\x4E', '\x4F', '\xE1', '\xC3', '\x41', '\xC2', '\xE1', '\xF2', '\x32', '\x84', '\x6F', '\xD0', '\x6D', '\xC0', '\x15', '\x04',
+'\x03', '\x25', '\x31', '\xF0', '\x91', '\x6A', '\xA5', '\x26', '\x5C', '\xC4', '\xED', '\x0F', '\x38', '\xE7', '\x40', '\xCF',
+'\xA9', '\x43', '\xD2', '\xDF', '\x68', '\xA8', '\x03', '\xD2', '\x81', '\xA2', '\xA4', '\xE4', '\xC3', '\xC4', '\xEA', '\x34',
+'\xB1', '\x22', '\xBD', '\x53', '\x02', '\x93', '\x9E', '\x5B', '\xB4', '\xC6', '\xC9', '\x42', '\xC4', '\x63', '\xB7', '\xD1',
+'\xF8', '\x1D', '\x70', '\x5F', '\x9D', '\x0E', '\x49', '\x19', '\xAD', '\xE1', '\x0F', '\x8E', '\x6E', '\x03', '\x6E', '\xF6',
+'\x20', '\xBD', '\xBA', '\xAD', '\xD0', '\x9D', '\xE0', '\xCE', '\x65', '\x87', '\xC7', '\xAD', '\xCB', '\xB8', '\x92', '\xCF',
+'\x1B', '\x2E', '\xAD', '\x86', '\x2D', '\xB8', '\x50', '\xF9', '\x74', '\x8C', '\xD2', '\xC6', '\xAE', '\x9A', '\xD7', '\x35',
+'\xB6', '\xCB', '\xEF', '\xF3', '\x1B', '\xC1', '\x68', '\x25', '\x3A', '\x3E', '\x1A', '\xC6', '\x95', '\x94', '\xA8', '\x7F',
+'\xFC', '\xBA', '\xBB', '\xE5', '\x41', '\x62', '\xB3', '\x51', '\x8D', '\x69', '\x10', '\x95', '\x51', '\xE0', '\x22', '\x74',
+'\x86', '\x2F', '\xD2', '\x68', '\x47', '\x85', '\x06', '\xCA', '\xD7', '\xCE', '\x57', '\x69', '\x99', '\x0B', '\xDD', '\xC7',
+'\xF8', '\x75', '\x8B', '\x6C', '\x44', '\x1A', '\xC8', '\x33', '\x9B', '\x97', '\xC0', '\x50', '\x6B', '\xA5', '\xC3', '\x45',
+'\x43', '\x1A', '\x92', '\x6D', '\xB7', '\x8B', '\xC1', '\xDA', '\xB7', '\x4A', '\xAE', '\xA4', '\xB1', '\x30', '\xE3', '\x7B',
+'\xA2', '\x9F', '\xBB', '\xE8', '\xB3', '\xAC', '\x9E', '\x22', '\xE9', '\xFA', '\x67', '\xA2', '\x8C', '\x65', '\x0B', '\x68',
+'\xEF', '\xFB', '\x6A', '\x78', '\xB2', '\x98', '\x35', '\x43', '\x68', '\x42', '\xB2', '\xEA', '\xBF', '\x8F', '\x5C', '\xAE',
+'\x0D', '\x8F', '\xE5', '\xBA', '\xD8', '\x54', '\xB2', '\x83', '\x8F', '\xD2', '\xCF', '\x2E', '\x9A', '\xD2', '\x02', '\xF5',
+'\x71', '\xDC', '\xE2', '\x78', '\x9D', '\x5F', '\xDE', '\xE9', '\x74', '\xAE', '\x78', '\x40', '\xE8', '\x8A', '\xA6', '\x28',
+'\x98', '\x58', '\xD3', '\x18', '\xE0', '\xCB', '\x81', '\x30', '\xF1', '\x38', '\x9B', '\x30', '\x3F', '\x1A', '\x3C', '\xF5',
+'\x91', '\xBA', '\xC1', '\xF1', '\x57', '\x8F', '\x0E', '\x76', '\xD6', '\x27', '\x85', '\xD2', '\xC0', '\x5A', '\x5B', '\x82',
+'\x2A', '\xC0', '\xB4', '\x61', '\xAA', '\x02', '\x98', '\x84', '\x4F', '\xAE', '\x23', '\xD0', '\x99', '\xAE', '\x80', '\x76',
+'\xAA', '\x25', '\x60', '\xBF', '\x21', '\x18', '\x45', '\x7D', '\x47', '\xFC', '\xB6', '\xB3', '\x43', '\xF0', '\x7A', '\xEA',
+'\x57', '\x2F', '\xC1', '\xFE', '\xE9', '\x5F', '\x79', '\x2C', '\x1F', '\x80', '\x92', '\x53', '\xEA', '\x17', '\x05', '\xBF',
+'\x1F', '\xFD', '\x71', '\x47', '\xF1', '\x5F', '\x9C', '\x1B', '\x26', '\x1E', '\xA9', '\x57', '\x44', '\x9F', '\x42', '\x52',
+'\xC4', '\x2E', '\xE9', '\xEB', '\x2C', '\x2F', '\xD9', '\x1B', '\x2F', '\x73', '\x98', '\x96', '\x70', '\x96', '\x69', '\x98',
+'\xB5', '\xF2', '\x57', '\xE8', '\x47', '\x77', '\xF2', '\x44', '\x4A', '\x88', '\x5C', '\x7B', '\x27', '\x6A', '\xE2', '\x93',
+'\xF4', '\x65', '\xE6', '\x34', '\x9A', '\xF9', '\x6A', '\x44', '\x34', '\x5D', '\x2F', '\xE1', '\x1F', '\x78', '\xA3', '\x7A',
+'\xC5', '\x88', '\x26', '\xBD', '\xCE', '\x21', '\xA5', '\xA4', '\x09', '\xFB', '\xE4', '\x40', '\x93', '\xAE', '\x1A', '\xC7',
+'\xF1', '\x97', '\xE4', '\xC0', '\x4D', '\x1F', '\x0D', '\xBE', '\x78', '\x07', '\xF6', '\x57', '\xBD', '\x6B', '\xC4', '\xFE',
+'\x03', '\xCF', '\x5C', '\xFD', '\x1D', '\x91', '\x05', '\x00', '\x00', 0x00
 };
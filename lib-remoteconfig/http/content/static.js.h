@@ -1,79 +1,34 @@
 static constexpr char static_js[] = {
-0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x67,
-0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x6A, 0x73, 0x6F, 0x6E, 0x29, 0x20, 0x7B, 0x0A, 0x74,
-0x72, 0x79, 0x20, 0x7B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x20, 0x3D, 0x20, 0x61,
-0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x6A, 0x73, 0x6F,
-0x6E, 0x2F, 0x27, 0x2B, 0x6A, 0x73, 0x6F, 0x6E, 0x29, 0x0A, 0x69, 0x66, 0x20, 0x28, 0x21, 0x72,
-0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x0A, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77,
-0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x27, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x27, 0x29, 0x0A,
-0x7D, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x72, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28,
-0x29, 0x0A, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72,
-0x29, 0x20, 0x7B, 0x7D, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E,
-0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x63,
-0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6C, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67,
-0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x27, 0x6C, 0x69, 0x73, 0x74, 0x27, 0x29, 0x0A, 0x64,
-0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65,
-0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x4C, 0x69, 0x73, 0x74, 0x22, 0x29,
-0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x22, 0x3C, 0x6C,
-0x69, 0x3E, 0x22, 0x2B, 0x6C, 0x2E, 0x6C, 0x69, 0x73, 0x74, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x2B,
-0x22, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x3C, 0x6C, 0x69, 0x3E, 0x22, 0x2B, 0x6C, 0x2E, 0x6C, 0x69,
-0x73, 0x74, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x2B, 0x22, 0x3C, 0x2F,
-0x6C, 0x69, 0x3E, 0x3C, 0x6C, 0x69, 0x3E, 0x22, 0x2B, 0x6C, 0x2E, 0x6C, 0x69, 0x73, 0x74, 0x2E,
-0x6E, 0x6F, 0x64, 0x65, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x2B, 0x22,
-0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x22, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66,
-0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x28,
-0x29, 0x20, 0x7B, 0x0A, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x61, 0x77,
-0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x27, 0x76, 0x65, 0x72,
-0x73, 0x69, 0x6F, 0x6E, 0x27, 0x29, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
-0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22,
-0x69, 0x64, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65,
-0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x22, 0x3C, 0x6C, 0x69, 0x3E, 0x56, 0x22, 0x2B,
-0x76, 0x2E, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x2B, 0x22, 0x3C, 0x2F, 0x6C, 0x69, 0x3E,
-0x3C, 0x6C, 0x69, 0x3E, 0x22, 0x2B, 0x76, 0x2E, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2E, 0x64, 0x61,
-0x74, 0x65, 0x2B, 0x22, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x3C, 0x6C, 0x69, 0x3E, 0x22, 0x2B, 0x76,
-0x2E, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x2B, 0x22, 0x3C, 0x2F, 0x6C,
-0x69, 0x3E, 0x3C, 0x6C, 0x69, 0x3E, 0x22, 0x2B, 0x76, 0x2E, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2B,
-0x22, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x22, 0x0A, 0x7D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-0x6F, 0x6E, 0x20, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x73, 0x29, 0x20, 0x7B, 0x0A, 0x72, 0x65, 0x74,
-0x75, 0x72, 0x6E, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x6A, 0x73, 0x6F, 0x6E,
-0x2F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x27, 0x2C, 0x20, 0x7B, 0x0A, 0x6D, 0x65, 0x74, 0x68,
-0x6F, 0x64, 0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0A, 0x68, 0x65, 0x61, 0x64,
-0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x0A, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D,
-0x54, 0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74,
-0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x0A, 0x7D, 0x2C, 0x0A, 0x62, 0x6F, 0x64,
-0x79, 0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66,
-0x79, 0x28, 0x73, 0x29, 0x0A, 0x7D, 0x29, 0x0A, 0x7D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-0x6F, 0x6E, 0x20, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x28, 0x73, 0x29, 0x20, 0x7B, 0x0A, 0x72, 0x65,
-0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x6A, 0x73, 0x6F,
-0x6E, 0x2F, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x27, 0x2C, 0x20, 0x7B, 0x0A, 0x6D, 0x65, 0x74,
-0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x44, 0x45, 0x4C, 0x45, 0x54, 0x45, 0x27, 0x2C, 0x0A, 0x68,
-0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x0A, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65,
-0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69,
-0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x0A, 0x7D, 0x2C, 0x0A,
-0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E,
-0x67, 0x69, 0x66, 0x79, 0x28, 0x73, 0x29, 0x0A, 0x7D, 0x29, 0x0A, 0x7D, 0x0A, 0x66, 0x75, 0x6E,
-0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x28, 0x29, 0x20, 0x7B,
-0x0A, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B, 0x20, 0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x3A, 0x20,
-0x31, 0x20, 0x7D, 0x29, 0x0A, 0x7D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
-0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x62,
-0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
-0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6C, 0x6F, 0x63, 0x61,
-0x74, 0x65, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x27, 0x29, 0x3B, 0x0A, 0x69, 0x66, 0x20, 0x28,
-0x62, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x63, 0x6F, 0x6E, 0x74,
-0x61, 0x69, 0x6E, 0x73, 0x28, 0x27, 0x69, 0x6E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29,
-0x29, 0x20, 0x7B, 0x0A, 0x62, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E,
-0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x27, 0x69, 0x6E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65,
-0x27, 0x29, 0x0A, 0x62, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61,
-0x64, 0x64, 0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x0A, 0x62, 0x2E, 0x69,
-0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x27, 0x4C, 0x6F, 0x63, 0x61,
-0x74, 0x65, 0x20, 0x4F, 0x6E, 0x27, 0x0A, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B, 0x20, 0x69, 0x64,
-0x65, 0x6E, 0x74, 0x69, 0x66, 0x79, 0x3A, 0x20, 0x31, 0x20, 0x7D, 0x29, 0x0A, 0x7D, 0x20, 0x65,
-0x6C, 0x73, 0x65, 0x20, 0x7B, 0x0A, 0x62, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73,
-0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65,
-0x27, 0x29, 0x0A, 0x62, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61,
-0x64, 0x64, 0x28, 0x27, 0x69, 0x6E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x0A, 0x62,
-0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x27, 0x4C, 0x6F,
-0x63, 0x61, 0x74, 0x65, 0x20, 0x4F, 0x66, 0x66, 0x27, 0x0A, 0x70, 0x6F, 0x73, 0x74, 0x28, 0x7B,
-0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x79, 0x3A, 0x20, 0x30, 0x20, 0x7D, 0x29, 0x0A,
-0x7D, 0x0A, 0x7D, 0x00
+'\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\xB5', '\x53', '\xC1', '\x8E', '\xD3', '\x30',
+'\x10', '\xBD', '\xE7', '\x2B', '\x86', '\x5C', '\x9C', '\xA8', '\xC5', '\x85', '\x6B', '\x77', '\xE1', '\xB0', '\x50', '\x09',
+'\x50', '\xA1', '\x48', '\x5B', '\xED', '\xDD', '\x89', '\x27', '\x5B', '\x83', '\x6B', '\x47', '\xB6', '\x93', '\x2A', '\x5A',
+'\xF5', '\xDF', '\x19', '\xA7', '\xD9', '\x2A', '\x51', '\x5B', '\x24', '\x0E', '\x5C', '\x92', '\x68', '\xE6', '\xCD', '\xBC',
+'\xF7', '\x66', '\x26', '\xC2', '\x77', '\xA6', '\x84', '\xAA', '\x31', '\x65', '\x50', '\xD6', '\xC0', '\x33', '\x86', '\x6F',
+'\x8F', '\x9B', '\x1F', '\xD9', '\x2F', '\x6F', '\x4D', '\x0E', '\x2F', '\x49', '\x70', '\x1D', '\x3D', '\x4B', '\x6B', '\x7C',
+'\x00', '\x07', '\x1F', '\x40', '\x1C', '\x84', '\x0A', '\x50', '\x61', '\x28', '\x77', '\x19', '\x5B', '\x44', '\xD4', '\x82',
+'\xCD', '\x7A', '\x70', '\xA2', '\x2A', '\xC8', '\xDE', '\x38', '\x6E', '\x7F', '\xF7', '\x75', '\x3B', '\x67', '\x0F', '\x60',
+'\xF0', '\x00', '\x2B', '\xE7', '\xAC', '\xCB', '\x58', '\xFF', '\x62', '\x79', '\x72', '\x4C', '\x1C', '\x86', '\xC6', '\x19',
+'\x70', '\x3C', '\x96', '\x65', '\x14', '\x81', '\x52', '\x50', '\x3B', '\xC8', '\x30', '\x42', '\xA8', '\xF8', '\x48', '\x20',
+'\x31', '\x95', '\xA5', '\x95', '\x0F', '\x59', '\x7E', '\x56', '\xA2', '\xCF', '\x4A', '\x5E', '\xF5', '\xB2', '\x88', '\xA0',
+'\xF6', '\xD2', '\x96', '\xCD', '\x1E', '\x4D', '\xE0', '\x94', '\x58', '\x69', '\x8C', '\x9F', '\x0F', '\xDD', '\x57', '\x99',
+'\xA5', '\x4A', '\xAE', '\x09', '\x91', '\xE6', '\x5C', '\x19', '\x83', '\xEE', '\xCB', '\xF6', '\xFB', '\x9A', '\x7A', '\xA4',
+'\xF7', '\x5A', '\x7D', '\x4C', '\x67', '\x9A', '\xC7', '\x6A', '\x6E', '\xC4', '\x1E', '\x67', '\xE9', '\xFD', '\x82', '\x62',
+'\xD3', '\xB8', '\x95', '\xC8', '\x43', '\x57', '\xDF', '\x4E', '\xD6', '\xD6', '\x85', '\x31', '\x22', '\xBD', '\x74', '\xD0',
+'\xA2', '\xF3', '\x2A', '\xFA', '\x3D', '\x9B', '\x68', '\x2F', '\x4D', '\x0C', '\xA0', '\xBF', '\xFB', '\x78', '\x3A', '\x81',
+'\xAE', '\x59', '\x79', '\x4A', '\x67', '\x2D', '\x1F', '\x9A', '\x4C', '\xC4', '\xB6', '\xBC', '\x68', '\x94', '\x96', '\x5C',
+'\x8A', '\x80', '\x57', '\x13', '\x41', '\xED', '\x2F', '\x12', '\x56', '\x38', '\x39', '\x32', '\x74', '\xB6', '\x52', '\x5B',
+'\x5A', '\x86', '\x8F', '\x46', '\x86', '\x55', '\x4E', '\xCE', '\x41', '\xF4', '\x20', '\x36', '\xA7', '\xF4', '\x1E', '\xC3',
+'\xCE', '\xCA', '\x25', '\xB0', '\x9F', '\x9B', '\xC7', '\x2D', '\x9B', '\x27', '\x3B', '\x14', '\x92', '\xC4', '\x2D', '\x29',
+'\xC5', '\x3E', '\x59', '\x13', '\xC8', '\xD4', '\xDB', '\x2D', '\x4D', '\x8D', '\x11', '\x44', '\xD4', '\xB5', '\x56', '\x74',
+'\x08', '\x54', '\xDB', '\xF7', '\x61', '\xC9', '\x71', '\x9E', '\x14', '\x56', '\x76', '\x4B', '\x88', '\xB3', '\xE1', '\x3E',
+'\x38', '\x65', '\x9E', '\x55', '\xD5', '\x11', '\x73', '\x72', '\xCC', '\xC7', '\x7A', '\x24', '\x6A', '\xFC', '\x47', '\x41',
+'\x9F', '\x57', '\xEB', '\xD5', '\x76', '\xF5', '\xFF', '\x24', '\x39', '\x2C', '\xAC', '\x3D', '\x5D', '\x6C', '\x3F', '\xAD',
+'\x97', '\x21', '\xB2', '\x84', '\xF7', '\x30', '\x45', '\x6A', '\x4B', '\x0C', '\xD8', '\x23', '\x5B', '\xE1', '\xA0', '\xA0',
+'\x55', '\xDE', '\xDA', '\x3D', '\x3B', '\x61', '\x1F', '\x9A', '\x10', '\xE2', '\x8D', '\xDC', '\xF5', '\x7F', '\x5C', '\xC1',
+'\x4B', '\x2D', '\xBC', '\x8F', '\xC7', '\xCD', '\xE9', '\xAE', '\x82', '\x50', '\xC6', '\x67', '\x4C', '\x99', '\xE8', '\xBA',
+'\x45', '\x96', '\xC7', '\xC6', '\x63', '\x8C', '\xC3', '\xBD', '\x6D', '\x71', '\x8C', '\x98', '\xA4', '\x85', '\x24', '\x9E',
+'\x51', '\x66', '\x7C', '\x62', '\x6C', '\xDD', '\xF3', '\xC3', '\x86', '\x26', '\x31', '\xB8', '\x52', '\x92', '\xC4', '\xD1',
+'\x04', '\x5E', '\x7D', '\x01', '\x6A', '\x8F', '\x37', '\x18', '\x6F', '\xF3', '\x4D', '\xB4', '\x5C', '\x65', '\xAC', '\xAA',
+'\x2B', '\x94', '\xEF', '\x4E', '\xA3', '\x3C', '\xFE', '\x01', '\x14', '\x12', '\x4C', '\x69', '\xC3', '\x04', '\x00', '\x00',
+0x00
 };
@@ -1,28 +1,17 @@
 static constexpr char styles_css[] = {
-0x62, 0x6F, 0x64, 0x79, 0x20, 0x7B, 0x0A, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E,
-0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x72, 0x67, 0x62, 0x28, 0x32, 0x30, 0x2C,
-0x32, 0x30, 0x2C, 0x32, 0x30, 0x29, 0x3B, 0x0A, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x72,
-0x67, 0x62, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x32, 0x35, 0x35,
-0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x75, 0x6C, 0x20, 0x7B, 0x0A, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61,
-0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x6C, 0x69, 0x20, 0x7B, 0x0A,
-0x6C, 0x69, 0x73, 0x74, 0x2D, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65,
-0x3B, 0x0A, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x35, 0x70,
-0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x64, 0x69,
-0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x62, 0x6F, 0x72,
-0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x34, 0x70, 0x78, 0x3B,
-0x0A, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x67,
-0x72, 0x65, 0x79, 0x20, 0x31, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x66, 0x6F, 0x6F, 0x74, 0x65,
-0x72, 0x20, 0x7B, 0x0A, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65,
-0x78, 0x3B, 0x0A, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65,
-0x6E, 0x74, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x62, 0x6F, 0x72, 0x64,
-0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x34, 0x70, 0x78, 0x3B, 0x0A,
-0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x67, 0x72,
-0x65, 0x79, 0x20, 0x31, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E,
-0x20, 0x7B, 0x0A, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74,
-0x65, 0x72, 0x3B, 0x0A, 0x7D, 0x0A, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3A, 0x61, 0x63, 0x74,
-0x69, 0x76, 0x65, 0x20, 0x7B, 0x0A, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
-0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x30, 0x30, 0x30, 0x3B, 0x0A, 0x63, 0x6F,
-0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x62, 0x74,
-0x6E, 0x20, 0x7B, 0x0A, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x6C, 0x65, 0x66, 0x74, 0x3A,
-0x20, 0x35, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x00
+'\x1F', '\x8B', '\x08', '\x00', '\x00', '\x00', '\x00', '\x00', '\x02', '\x03', '\x95', '\x90', '\xCF', '\x6A', '\x03', '\x21',
+'\x10', '\x87', '\xEF', '\xFB', '\x14', '\x03', '\xB9', '\xA4', '\x90', '\x0D', '\xB6', '\x74', '\x2F', '\xE6', '\x69', '\xFC',
+'\xBB', '\xB5', '\xB5', '\x8E', '\x8C', '\x63', '\x89', '\x94', '\xBC', '\x7B', '\x35', '\x4B', '\x42', '\xA1', '\xB9', '\x14',
+'\x64', '\x0E', '\xDF', '\xE8', '\x37', '\xE3', '\x4F', '\xA3', '\x6D', '\xF0', '\x3D', '\x69', '\x65', '\x3E', '\x56', '\xC2',
+'\x9A', '\xEC', '\x6C', '\x30', '\x22', '\x49', '\xA0', '\x55', '\xEF', '\x5F', '\xC4', '\xE1', '\x7A', '\x9E', '\x4E', '\xD3',
+'\x6F', '\xBA', '\x2C', '\x07', '\xB8', '\x95', '\xDE', '\xBA', '\x4C', '\x35', '\x76', '\x85', '\x0D', '\x25', '\x47', '\xD5',
+'\x24', '\xF8', '\xE8', '\xCE', '\x83', '\xC6', '\xD0', '\x69', '\x0C', '\x85', '\xE7', '\xC2', '\x2D', '\x3A', '\x09', '\x09',
+'\x93', '\x3B', '\x4D', '\x9F', '\x8A', '\xD6', '\x90', '\x24', '\x3C', '\xE7', '\x33', '\x2C', '\xF9', '\x7A', '\xF3', '\xCD',
+'\x29', '\xEB', '\xE8', '\xAF', '\x43', '\x23', '\x75', '\x3E', '\x93', '\xB2', '\xA1', '\x16', '\x09', '\xAF', '\xF9', '\xCE',
+'\x24', '\x14', '\x8C', '\xC1', '\xC2', '\x4A', '\xAE', '\x0D', '\xD3', '\xB0', '\x78', '\x44', '\x7E', '\x64', '\x79', '\xAF',
+'\x85', '\x83', '\x6F', '\xFD', '\x63', '\x89', '\x5D', '\x62', '\x09', '\xA6', '\x57', '\x47', '\xFF', '\xD5', '\xEB', '\xCA',
+'\x8C', '\xA9', '\xEB', '\x4D', '\xA5', '\x32', '\xB2', '\xC8', '\x18', '\x36', '\xCF', '\xAD', '\x27', '\x95', '\xE1', '\xF0',
+'\xE5', '\x1E', '\xC6', '\xB9', '\x13', '\x42', '\xDC', '\x53', '\xDC', '\x79', '\xEF', '\xC7', '\xB3', '\xA3', '\xE6', '\x21',
+'\xDC', '\x12', '\x99', '\xA3', '\xF3', '\x7D', '\xB9', '\x45', '\x6C', '\xE3', '\x7E', '\x00', '\xF7', '\x11', '\x51', '\x2F',
+'\x99', '\x01', '\x00', '\x00', 0x00
 };
@@ -28,8 +28,10 @@
 
 namespace http {
 static constexpr uint32_t BUFSIZE = 1440; //TODO We need the TCP max segment size here
+static constexpr uint32_t HEADER_SIZE = 320;
 enum class Status {
 	OK = 200,
+	NOT_MODIFIED = 304,
 	BAD_REQUEST = 400,
 	NOT_FOUND = 404,
 	REQUEST_TIMEOUT = 408,
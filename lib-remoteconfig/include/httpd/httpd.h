@@ -33,7 +33,7 @@
 
 #include "network.h"
 
-#include "../../lib-network/config/net_config.h"
+#include "net_config.h"
 
 class HttpDaemon {
 public:
@@ -41,6 +41,13 @@ public:
 	~HttpDaemon();
 
 	void Run() {
+		// A connection with a pending response does not block the others
+		for (auto *pHandler : pHandleRequest) {
+			if (__builtin_expect((pHandler->IsBusy()), 0)) {
+				pHandler->ContinueWrite();
+			}
+		}
+
 		uint32_t nConnectionHandle;
 		const auto nBytesReceived = Network::Get()->TcpRead(m_nHandle, const_cast<const uint8_t **>(reinterpret_cast<uint8_t **>(&m_RequestHeaderResponse)), nConnectionHandle);
 
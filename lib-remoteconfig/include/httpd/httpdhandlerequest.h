@@ -42,7 +42,26 @@ public:
 
 	void HandleRequest(const uint32_t nBytesReceived, char *pRequestHeaderResponse);
 
+	/**
+	 * Writes the part of the response which did not fit in the TCP send queue,
+	 * then handles the requests which were buffered in the meantime.
+	 */
+	void ContinueWrite();
+
+	bool IsWritePending() const {
+		return (m_nPendingHeaderLength != 0) || (m_nPendingContentLength != 0);
+	}
+
+	bool IsBusy() const {
+		return IsWritePending() || (m_nBufferedLength != 0);
+	}
+
 private:
+	void HandleRequests(const uint32_t nBytesReceived, char *pRequestHeaderResponse);
+	void HandleRequest();
+	void Buffer(const char *pData, const uint32_t nLength);
+	void SetSharedBuffersOwner();
+	bool Write(const char *&pData, uint32_t& nLength);
 	http::Status ParseRequest();
 	http::Status ParseMethod(char *pLine);
 	http::Status ParseHeaderField(char *pLine);
@@ -58,19 +77,31 @@ private:
 	uint32_t m_nFileDataLength { 0 };
 	uint32_t m_nRequestContentSize { 0 };
 	uint32_t m_nBytesReceived { 0 };
+	uint32_t m_nPipelineOffset { 0 };
+	uint32_t m_nContentETag { 0 };
+	uint32_t m_nPendingHeaderLength { 0 };
+	uint32_t m_nPendingContentLength { 0 };
+	uint32_t m_nBufferedLength { 0 };
 
 	char *m_pUri { nullptr };
 	char *m_pFileData { nullptr };
 	const char *m_pContent { nullptr };
 	char *m_RequestHeaderResponse { nullptr };
+	const char *m_pIfNoneMatch { nullptr };
+	const char *m_pPendingHeader { nullptr };
+	const char *m_pPendingContent { nullptr };
 
 	http::Status m_Status { http::Status::UNKNOWN_ERROR };
 	http::RequestMethod m_RequestMethod { http::RequestMethod::UNKNOWN };
 	http::contentTypes m_ContentType { http::contentTypes::NOT_DEFINED };
 
 	bool m_IsAction { false };
+	bool m_bConnectionClose { false };
+	bool m_bContentGzip { false };
 
 	static char m_DynamicContent[http::BUFSIZE];
+	static char s_ResponseHeader[http::HEADER_SIZE];
+	static HttpDeamonHandleRequest *s_pSharedBuffersOwner;
 };
 
 
@@ -35,6 +35,18 @@
 # include "gd32.h"
 #endif
 
+/*
+ * With CONFIG_TFTP_FLASH_STREAM the firmware is programmed while it is received,
+ * there is no RAM buffer of the full image.
+ * The blocks are collected in sector buffers, erase and write are overlapped with the network.
+ */
+#if defined (CONFIG_TFTP_FLASH_STREAM)
+# if !defined (CONFIG_TFTP_FLASH_STREAM_OFFSET)
+#  error CONFIG_TFTP_FLASH_STREAM_OFFSET is not defined
+# endif
+# include "flashcode.h"
+#endif
+
 namespace tftpfileserver {
 	bool is_valid(const void *pBuffer);
 #if defined(__linux__) || defined (__APPLE__)
@@ -63,7 +75,11 @@ namespace tftpfileserver {
 
 class TFTPFileServer final: public TFTPDaemon {
 public:
+#if defined (CONFIG_TFTP_FLASH_STREAM)
+	explicit TFTPFileServer(uint32_t nSize);
+#else
 	TFTPFileServer(uint8_t *pBuffer, uint32_t nSize);
+#endif
 	~TFTPFileServer() override {}
 
 	bool FileOpen(const char *pFileName, tftp::Mode mode) override;
@@ -71,6 +87,9 @@ public:
 	bool FileClose() override;
 	size_t FileRead(void *pBuffer, size_t nCount, unsigned nBlockNumber) override;
 	size_t FileWrite(const void *pBuffer, size_t nCount, unsigned nBlockNumber) override;
+#if defined (CONFIG_TFTP_FLASH_STREAM)
+	bool FileWriteReady() override;
+#endif
 	void Exit() override;
 
 	uint32_t GetFileSize() const {
@@ -82,7 +101,30 @@ public:
 	}
 
 private:
+#if defined (CONFIG_TFTP_FLASH_STREAM)
+	void FlashRun();
+
+	static constexpr uint32_t SECTOR_SIZE = 4096;
+	static constexpr uint32_t SECTOR_BUFFERS = 3;
+
+	enum class FlashState {
+		IDLE, ERASE, WRITE, ERROR
+	};
+
+	struct SectorBuffer {
+		uint8_t data[SECTOR_SIZE];
+		uint32_t nLength;
+	};
+
+	SectorBuffer m_SectorBuffer[SECTOR_BUFFERS];
+	uint32_t m_nFlashOffset { 0 };
+	uint32_t m_nFlashIndex { 0 };	///< Next sector buffer to be programmed
+	uint32_t m_nFillIndex { 0 };	///< Sector buffer being filled by FileWrite
+	uint32_t m_nPending { 0 };		///< Full sector buffers not yet programmed
+	FlashState m_FlashState { FlashState::IDLE };
+#else
 	uint8_t *m_pBuffer;
+#endif
 	uint32_t m_nSize;
 	uint32_t m_nFileSize { 0 };
 	bool m_bDone { false };
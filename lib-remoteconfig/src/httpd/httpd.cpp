@@ -33,7 +33,7 @@
 #include "network.h"
 #include "net/apps/mdns.h"
 
-#include "../../lib-network/config/net_config.h"
+#include "net_config.h"
 
 HttpDaemon::HttpDaemon() {
 	DEBUG_ENTRY
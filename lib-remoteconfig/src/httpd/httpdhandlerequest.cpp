@@ -49,6 +49,8 @@
 #include "net/apps/mdns.h"
 #include "display.h"
 
+#include "net_config.h"
+
 #if defined(RDM_CONTROLLER)
 # include "artnetnode.h"
 #endif
@@ -70,10 +72,19 @@
 
 #if defined ENABLE_CONTENT
 //uint32_t get_file_content(const char *fileName, char *pDst, http::contentTypes& contentType);
-const char *get_file_content(const char *fileName, uint32_t& nSize, http::contentTypes& contentType);
+const char *get_file_content(const char *fileName, uint32_t& nSize, http::contentTypes& contentType, uint32_t& nETag, bool& isGzip);
 #endif
 
 char HttpDeamonHandleRequest::m_DynamicContent[http::BUFSIZE];
+char HttpDeamonHandleRequest::s_ResponseHeader[http::HEADER_SIZE];
+HttpDeamonHandleRequest *HttpDeamonHandleRequest::s_pSharedBuffersOwner;
+
+/*
+ * Requests received while the connection has a pending response,
+ * or while another connection has its response pending in the shared buffers.
+ * The heap is too small for these, so they are static.
+ */
+static char s_RequestBuffer[TCP_MAX_TCBS_ALLOWED][http::BUFSIZE];
 
 #ifndef NDEBUG
 static constexpr char s_request_method[][8] = {"GET", "POST", "DELETE", "UNKNOWN" };
@@ -82,12 +93,68 @@ static constexpr char s_request_method[][8] = {"GET", "POST", "DELETE", "UNKNOWN
 static constexpr char s_contentType[static_cast<uint32_t>(http::contentTypes::NOT_DEFINED)][32] =
 { "text/html", "text/css", "text/javascript", "application/json", "application/octet-stream" };
 
+/**
+ * HTTP/1.1 persistent connections: the connection is kept open unless the client
+ * sends "Connection: close" or the request cannot be parsed.
+ * Pipelined GET requests are handled in order, a request which cannot be
+ * handled yet is buffered until the pending response is written.
+ */
 void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char *pRequestHeaderResponse) {
 	DEBUG_ENTRY
 
+	if (IsBusy() || ((s_pSharedBuffersOwner != nullptr) && (s_pSharedBuffersOwner != this))) {
+		Buffer(pRequestHeaderResponse, nBytesReceived);
+		DEBUG_EXIT
+		return;
+	}
+
+	HandleRequests(nBytesReceived, pRequestHeaderResponse);
+
+	DEBUG_EXIT
+}
+
+void HttpDeamonHandleRequest::HandleRequests(const uint32_t nBytesReceived, char *pRequestHeaderResponse) {
+	DEBUG_ENTRY
+
 	m_nBytesReceived = nBytesReceived;
 	m_RequestHeaderResponse = pRequestHeaderResponse;
 
+	for (;;) {
+		m_nPipelineOffset = 0;
+
+		HandleRequest();
+
+		if (IsWritePending()) {
+			SetSharedBuffersOwner();
+
+			if ((m_nPipelineOffset != 0) && !m_bConnectionClose) {
+				Buffer(&m_RequestHeaderResponse[m_nPipelineOffset], m_nBytesReceived - m_nPipelineOffset);
+			}
+			break;
+		}
+
+		if ((m_nPipelineOffset == 0) || m_bConnectionClose) {
+			break;
+		}
+
+		DEBUG_PRINTF("Pipelined request at %u", m_nPipelineOffset);
+
+		m_RequestHeaderResponse += m_nPipelineOffset;
+		m_nBytesReceived -= m_nPipelineOffset;
+	}
+
+	// The request is completed when m_Status is reset, a POST can still wait for its data
+	if (m_bConnectionClose && (m_Status == http::Status::UNKNOWN_ERROR) && !IsWritePending()) {
+		m_bConnectionClose = false;
+		Network::Get()->TcpClose(m_nHandle, m_nConnectionHandle);
+	}
+
+	DEBUG_EXIT
+}
+
+void HttpDeamonHandleRequest::HandleRequest() {
+	DEBUG_ENTRY
+
 	const char *pStatusMsg = "OK";
 
 	DEBUG_PRINTF("%u: m_Status=%u", m_nConnectionHandle, static_cast<uint32_t>(m_Status));
@@ -133,7 +200,13 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 	}
 #endif
 
-	if (m_Status != http::Status::OK) {
+	if (m_Status == http::Status::NOT_MODIFIED) {
+		pStatusMsg = "Not Modified";
+	} else if (m_Status != http::Status::OK) {
+		if (m_Status != http::Status::NOT_FOUND) {
+			m_bConnectionClose = true;
+		}
+
 		switch (m_Status) {
 		case http::Status::BAD_REQUEST:
 			pStatusMsg = "Bad Request";
@@ -162,6 +235,8 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 		}
 
 		m_ContentType = http::contentTypes::TEXT_HTML;
+		m_nContentETag = 0;
+		m_bContentGzip = false;
 		m_pContent = m_DynamicContent;
 		m_nContentSize = static_cast<uint32_t>(snprintf(m_DynamicContent, http::BUFSIZE - 1U,
 				"<!DOCTYPE html>\n"
@@ -171,16 +246,44 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 				"</html>\n", static_cast<unsigned int>(m_Status), pStatusMsg, pStatusMsg));
 	}
 
-	const auto nHeaderLength = snprintf(m_RequestHeaderResponse, http::BUFSIZE - 1U,
+	auto nHeaderLength = snprintf(s_ResponseHeader, sizeof(s_ResponseHeader),
 			"HTTP/1.1 %u %s\r\n"
 			"Server: %s\r\n"
 			"Content-Type: %s\r\n"
-			"Content-Length: %u\r\n"
-			"Connection: close\r\n"
-			"\r\n", static_cast<unsigned int>(m_Status), pStatusMsg, Network::Get()->GetHostName(), s_contentType[static_cast<uint32_t>(m_ContentType)], static_cast<unsigned int>(m_nContentSize));
+			"Content-Length: %u\r\n", static_cast<unsigned int>(m_Status), pStatusMsg, Network::Get()->GetHostName(), s_contentType[static_cast<uint32_t>(m_ContentType)], static_cast<unsigned int>(m_nContentSize));
+
+	if (m_bContentGzip) {
+		nHeaderLength += snprintf(&s_ResponseHeader[nHeaderLength], sizeof(s_ResponseHeader) - static_cast<size_t>(nHeaderLength),
+				"Content-Encoding: gzip\r\n");
+	}
+
+	if (m_nContentETag != 0) {
+		// The browser must revalidate, so new content is picked up after a firmware update
+		nHeaderLength += snprintf(&s_ResponseHeader[nHeaderLength], sizeof(s_ResponseHeader) - static_cast<size_t>(nHeaderLength),
+				"ETag: \"%08x\"\r\n"
+				"Cache-Control: no-cache\r\n", static_cast<unsigned int>(m_nContentETag));
+	}
+
+	if (m_bConnectionClose) {
+		nHeaderLength += snprintf(&s_ResponseHeader[nHeaderLength], sizeof(s_ResponseHeader) - static_cast<size_t>(nHeaderLength),
+				"Connection: close\r\n"
+				"\r\n");
+	} else {
+		nHeaderLength += snprintf(&s_ResponseHeader[nHeaderLength], sizeof(s_ResponseHeader) - static_cast<size_t>(nHeaderLength),
+				"Connection: keep-alive\r\n"
+				"Keep-Alive: timeout=%u\r\n"
+				"\r\n", static_cast<unsigned int>(TCP_IDLE_TIMEOUT_SECONDS));
+	}
+
+	m_pPendingHeader = s_ResponseHeader;
+	m_nPendingHeaderLength = static_cast<uint32_t>(nHeaderLength);
+	m_pPendingContent = m_pContent;
+	m_nPendingContentLength = (m_Status != http::Status::NOT_MODIFIED) ? m_nContentSize : 0;
+
+	if (Write(m_pPendingHeader, m_nPendingHeaderLength)) {
+		Write(m_pPendingContent, m_nPendingContentLength);
+	}
 
-	Network::Get()->TcpWrite(m_nHandle, reinterpret_cast<uint8_t *>(m_RequestHeaderResponse), nHeaderLength, m_nConnectionHandle);
-	Network::Get()->TcpWrite(m_nHandle, reinterpret_cast<const uint8_t *>(m_pContent), m_nContentSize, m_nConnectionHandle);
 	DEBUG_PRINTF("m_nContentLength=%u", m_nContentSize);
 
 	m_Status = http::Status::UNKNOWN_ERROR;
@@ -189,6 +292,99 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 	DEBUG_EXIT
 }
 
+/**
+ * The requests are appended, the buffer can hold the requests of which it is the source.
+ */
+void HttpDeamonHandleRequest::Buffer(const char *pData, const uint32_t nLength) {
+	if ((m_nBufferedLength + nLength) > http::BUFSIZE) {
+		DEBUG_PUTS("Request buffer is full -> close");
+		m_nBufferedLength = 0;
+		m_bConnectionClose = true;
+
+		if (!IsWritePending()) {
+			m_bConnectionClose = false;
+			Network::Get()->TcpClose(m_nHandle, m_nConnectionHandle);
+		}
+		return;
+	}
+
+	memmove(&s_RequestBuffer[m_nConnectionHandle][m_nBufferedLength], pData, nLength);
+	m_nBufferedLength += nLength;
+
+	DEBUG_PRINTF("%u: m_nBufferedLength=%u", m_nConnectionHandle, m_nBufferedLength);
+}
+
+/**
+ * The shared buffers are in use as long as the response header,
+ * or dynamic content, is pending.
+ */
+void HttpDeamonHandleRequest::SetSharedBuffersOwner() {
+	const auto isDynamicContent = (m_pPendingContent >= m_DynamicContent) && (m_pPendingContent < &m_DynamicContent[http::BUFSIZE]);
+
+	if ((m_nPendingHeaderLength != 0) || ((m_nPendingContentLength != 0) && isDynamicContent)) {
+		s_pSharedBuffersOwner = this;
+	} else if (s_pSharedBuffersOwner == this) {
+		s_pSharedBuffersOwner = nullptr;
+	}
+}
+
+/**
+ * @return true when all data is written, or the connection is gone
+ */
+bool HttpDeamonHandleRequest::Write(const char *&pData, uint32_t& nLength) {
+	if (nLength == 0) {
+		return true;
+	}
+
+	const auto nWritten = Network::Get()->TcpWrite(m_nHandle, reinterpret_cast<const uint8_t *>(pData), nLength, m_nConnectionHandle);
+
+	if (nWritten < 0) {
+		DEBUG_PUTS("Connection is closed");
+		m_nPendingHeaderLength = 0;
+		m_nPendingContentLength = 0;
+		m_nBufferedLength = 0;
+		return true;
+	}
+
+	pData += nWritten;
+	nLength -= static_cast<uint32_t>(nWritten);
+
+	return (nLength == 0);
+}
+
+void HttpDeamonHandleRequest::ContinueWrite() {
+	DEBUG_ENTRY
+
+	if (IsWritePending()) {
+		if (Write(m_pPendingHeader, m_nPendingHeaderLength)) {
+			Write(m_pPendingContent, m_nPendingContentLength);
+		}
+
+		SetSharedBuffersOwner();
+
+		if (IsWritePending()) {
+			DEBUG_EXIT
+			return;
+		}
+
+		if (m_bConnectionClose) {
+			m_bConnectionClose = false;
+			m_nBufferedLength = 0;
+			Network::Get()->TcpClose(m_nHandle, m_nConnectionHandle);
+			DEBUG_EXIT
+			return;
+		}
+	}
+
+	if ((m_nBufferedLength != 0) && ((s_pSharedBuffersOwner == nullptr) || (s_pSharedBuffersOwner == this))) {
+		const auto nLength = m_nBufferedLength;
+		m_nBufferedLength = 0;
+		HandleRequests(nLength, s_RequestBuffer[m_nConnectionHandle]);
+	}
+
+	DEBUG_EXIT
+}
+
 http::Status HttpDeamonHandleRequest::ParseRequest() {
 	char *pLine = m_RequestHeaderResponse;
 	uint32_t nLine = 0;
@@ -196,6 +392,10 @@ http::Status HttpDeamonHandleRequest::ParseRequest() {
 	m_ContentType = http::contentTypes::NOT_DEFINED;
 	m_nRequestContentSize = 0;
 	m_nFileDataLength = 0;
+	m_nContentETag = 0;
+	m_pIfNoneMatch = nullptr;
+	m_bConnectionClose = false;
+	m_bContentGzip = false;
 
 	for (uint32_t i = 0; i < m_nBytesReceived; i++) {
 		if (m_RequestHeaderResponse[i] == '\n') {
@@ -208,6 +408,14 @@ http::Status HttpDeamonHandleRequest::ParseRequest() {
 				if (pLine[0] == '\0') {
 					assert((i + 1) <= m_nBytesReceived);
 					m_nFileDataLength = static_cast<uint16_t>(m_nBytesReceived - 1 - i);
+					if (m_RequestMethod == http::RequestMethod::GET) {
+						// A GET has no body, what follows is a pipelined request
+						if (m_nFileDataLength > 0) {
+							m_nPipelineOffset = i + 1;
+						}
+						m_nFileDataLength = 0;
+						return http::Status::OK;
+					}
 					if (m_nFileDataLength > 0) {
 						m_pFileData = &m_RequestHeaderResponse[i + 1];
 						m_pFileData[m_nFileDataLength] = '\0';
@@ -277,7 +485,7 @@ http::Status HttpDeamonHandleRequest::ParseMethod(char *pLine) {
 }
 
 /**
- * Only interested in "Content-Type" and "Content-Length"
+ * Only interested in "Content-Type", "Content-Length", "Connection" and "If-None-Match"
  * Where we check for "Content-Type: application/json" and "Content-Type: application/octet-stream"
  */
 
@@ -307,6 +515,15 @@ http::Status HttpDeamonHandleRequest::ParseHeaderField(char *pLine) {
 				return http::Status::OK;
 			}
 		}
+	} else if (strcasecmp(pToken, "Connection") == 0) {
+		if ((pToken = strtok(nullptr, " ")) == nullptr) {
+			return http::Status::BAD_REQUEST;
+		}
+
+		m_bConnectionClose = (strcasecmp(pToken, "close") == 0);
+	} else if (strcasecmp(pToken, "If-None-Match") == 0) {
+		// Keep the complete value, it can be a list of entity tags
+		m_pIfNoneMatch = strtok(nullptr, "");
 	} else if (strcasecmp(pToken, "Content-Length") == 0) {
 		if ((pToken = strtok(nullptr, " ")) == nullptr) {
 			return http::Status::BAD_REQUEST;
@@ -504,40 +721,35 @@ http::Status HttpDeamonHandleRequest::HandleGet() {
 	}
 #if defined (ENABLE_CONTENT)
 	else if (strcmp(m_pUri, "/") == 0) {
-		m_pContent = get_file_content("index.html", nLength, m_ContentType);
+		m_pContent = get_file_content("index.html", nLength, m_ContentType, m_nContentETag, m_bContentGzip);
 	}
 #if defined (HAVE_DMX)
 	else if (strcmp(m_pUri, "/dmx") == 0) {
-		m_pContent = get_file_content("dmx.html", nLength, m_ContentType);
+		m_pContent = get_file_content("dmx.html", nLength, m_ContentType, m_nContentETag, m_bContentGzip);
 	}
 #endif
 #if defined (RDM_CONTROLLER) && !defined (CONFIG_HTTP_HTML_NO_RDM)
 	else if (strcmp(m_pUri, "/rdm") == 0) {
-		m_pContent = get_file_content("rdm.html", nLength, m_ContentType);
+		m_pContent = get_file_content("rdm.html", nLength, m_ContentType, m_nContentETag, m_bContentGzip);
 	}
 #endif
 #if defined (NODE_SHOWFILE)
 	else if (strcmp(m_pUri, "/showfile") == 0) {
-		m_pContent = get_file_content("showfile.html", nLength, m_ContentType);
-	}
-#endif
-#if defined (ENABLE_PHY_SWITCH)
-	else if (strcmp(m_pUri, "/dsa") == 0) {
-		m_pContent = get_file_content("dsa.html", nLength, m_ContentType);
+		m_pContent = get_file_content("showfile.html", nLength, m_ContentType, m_nContentETag, m_bContentGzip);
 	}
 #endif
 #if !defined (CONFIG_HTTP_HTML_NO_TIME)
 	else if (strcmp(m_pUri, "/time") == 0) {
-		m_pContent = get_file_content("time.html", nLength, m_ContentType);
+		m_pContent = get_file_content("time.html", nLength, m_ContentType, m_nContentETag, m_bContentGzip);
 	}
 #endif
 #if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
 	else if (strcmp(m_pUri, "/rtc") == 0) {
-		m_pContent = get_file_content("rtc.html", nLength, m_ContentType);
+		m_pContent = get_file_content("rtc.html", nLength, m_ContentType, m_nContentETag, m_bContentGzip);
 	}
 #endif
 	else {
-		m_pContent = get_file_content(&m_pUri[1], nLength, m_ContentType);
+		m_pContent = get_file_content(&m_pUri[1], nLength, m_ContentType, m_nContentETag, m_bContentGzip);
 	}
 #endif
 
@@ -548,6 +760,18 @@ http::Status HttpDeamonHandleRequest::HandleGet() {
 
 	m_nContentSize = nLength;
 
+#if defined (ENABLE_CONTENT)
+	if ((m_nContentETag != 0) && (m_pIfNoneMatch != nullptr)) {
+		char etag[12];
+		snprintf(etag, sizeof(etag), "\"%08x\"", static_cast<unsigned int>(m_nContentETag));
+
+		if (strstr(m_pIfNoneMatch, etag) != nullptr) {
+			DEBUG_EXIT
+			return http::Status::NOT_MODIFIED;
+		}
+	}
+#endif
+
 	DEBUG_EXIT
 	return http::Status::OK;
 }
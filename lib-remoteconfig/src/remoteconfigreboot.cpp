@@ -53,6 +53,7 @@ void RemoteConfig::HandleReboot() {
 
 	Display::Get()->Cls();
 	Display::Get()->TextStatus("Rebooting ...");
+	Display::Get()->Flush();
 
 	Hardware::Get()->Reboot();
 	__builtin_unreachable() ;
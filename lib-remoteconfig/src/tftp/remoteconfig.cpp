@@ -44,13 +44,19 @@
 
 #include "debug.h"
 
+#if !defined (CONFIG_TFTP_FLASH_STREAM)
 static uint8_t s_TFTPBuffer[FIRMWARE_MAX_SIZE];
+#endif
 
 void RemoteConfig::PlatformHandleTftpSet() {
 	DEBUG_ENTRY
 
 	if (m_bEnableTFTP && (m_pTFTPFileServer == nullptr)) {
+#if defined (CONFIG_TFTP_FLASH_STREAM)
+		m_pTFTPFileServer = new TFTPFileServer(FIRMWARE_MAX_SIZE);
+#else
 		m_pTFTPFileServer = new TFTPFileServer(s_TFTPBuffer, FIRMWARE_MAX_SIZE);
+#endif
 		assert(m_pTFTPFileServer != nullptr);
 		Display::Get()->TextStatus("TFTP On", CONSOLE_GREEN);
 	} else if (!m_bEnableTFTP && (m_pTFTPFileServer != nullptr)) {
@@ -59,6 +65,14 @@ void RemoteConfig::PlatformHandleTftpSet() {
 
 		bool bSucces = true;
 
+#if defined (CONFIG_TFTP_FLASH_STREAM)
+		// The firmware is programmed while it is received
+		bSucces = m_pTFTPFileServer->isDone() || (nFileSize == 0);
+
+		if (!bSucces) {
+			Display::Get()->TextStatus("Error: TFTP", CONSOLE_RED);
+		}
+#else
 		if (m_pTFTPFileServer->isDone()) {
 			bSucces = FlashCodeInstall::Get()->WriteFirmware(s_TFTPBuffer, nFileSize);
 
@@ -66,6 +80,7 @@ void RemoteConfig::PlatformHandleTftpSet() {
 				Display::Get()->TextStatus("Error: TFTP", CONSOLE_RED);
 			}
 		}
+#endif
 
 		delete m_pTFTPFileServer;
 		m_pTFTPFileServer = nullptr;
@@ -26,6 +26,7 @@
 #include <cstdint>
 #include <cstring>
 #include <cstdio>
+#include <algorithm>
 #include <cassert>
 
 #include "tftp/tftpfileserver.h"
@@ -38,6 +39,17 @@ using namespace tftpfileserver;
 
 static constexpr auto FILE_NAME_LENGTH = sizeof(FILE_NAME) - 1;
 
+#if defined (CONFIG_TFTP_FLASH_STREAM)
+TFTPFileServer::TFTPFileServer(uint32_t nSize): m_nSize(nSize) {
+	DEBUG_ENTRY
+
+	assert(nSize != 0);
+	assert(FlashCode::Get() != nullptr);
+	assert(FlashCode::Get()->GetSectorSize() <= SECTOR_SIZE);
+
+	DEBUG_EXIT
+}
+#else
 TFTPFileServer::TFTPFileServer(uint8_t *pBuffer, uint32_t nSize): m_pBuffer(pBuffer), m_nSize(nSize) {
 	DEBUG_ENTRY
 
@@ -46,6 +58,7 @@ TFTPFileServer::TFTPFileServer(uint8_t *pBuffer, uint32_t nSize): m_pBuffer(pBuf
 
 	DEBUG_EXIT
 }
+#endif
 
 void TFTPFileServer::Exit() {
 	DEBUG_ENTRY
@@ -81,6 +94,15 @@ bool TFTPFileServer::FileCreate(const char* pFileName, tftp::Mode mode) {
 	Display::Get()->TextStatus("TFTP Started", CONSOLE_GREEN);
 
 	m_nFileSize = 0;
+	m_bDone = false;
+#if defined (CONFIG_TFTP_FLASH_STREAM)
+	m_nFlashOffset = 0;
+	m_nFlashIndex = 0;
+	m_nFillIndex = 0;
+	m_nPending = 0;
+	m_SectorBuffer[0].nLength = 0;
+	m_FlashState = FlashState::IDLE;
+#endif
 
 	DEBUG_EXIT
 	return (true);
@@ -89,7 +111,31 @@ bool TFTPFileServer::FileCreate(const char* pFileName, tftp::Mode mode) {
 bool TFTPFileServer::FileClose() {
 	DEBUG_ENTRY
 
+#if defined (CONFIG_TFTP_FLASH_STREAM)
+	auto& sector = m_SectorBuffer[m_nFillIndex];
+
+	if (sector.nLength != 0) {
+		// The flash is programmed in words
+		while ((sector.nLength & 0x3) != 0) {
+			sector.data[sector.nLength++] = 0xFF;
+		}
+		m_nPending++;
+	}
+
+	while ((m_nPending != 0) && (m_FlashState != FlashState::ERROR)) {
+		FlashRun();
+	}
+
+	m_bDone = (m_FlashState != FlashState::ERROR);
+
+	if (!m_bDone) {
+		Display::Get()->TextStatus("Error: TFTP", CONSOLE_RED);
+		DEBUG_EXIT
+		return false;
+	}
+#else
 	m_bDone = true;
+#endif
 
 	Display::Get()->TextStatus("TFTP Ended", CONSOLE_GREEN);
 
@@ -104,31 +150,113 @@ size_t TFTPFileServer::FileRead([[maybe_unused]] void* pBuffer, [[maybe_unused]]
 	return 0;
 }
 
+/**
+ * The daemon delivers the blocks once and in sequence, whatever the negotiated block size.
+ */
 size_t TFTPFileServer::FileWrite(const void *pBuffer, size_t nCount, unsigned nBlockNumber) {
-	DEBUG_PRINTF("pBuffer=%p, nCount=%d, nBlockNumber=%d (%d)", pBuffer, nCount, nBlockNumber, m_nSize / 512);
+	DEBUG_PRINTF("pBuffer=%p, nCount=%d, nBlockNumber=%d, m_nFileSize=%u", pBuffer, nCount, nBlockNumber, m_nFileSize);
+
+	assert(nBlockNumber != 0);
 
-	if (nBlockNumber > (m_nSize / 512)) {
+	if ((m_nFileSize + nCount) > m_nSize) {
 		m_nFileSize = 0;
 		return 0;
 	}
 
-	assert(nBlockNumber != 0);
-
 	if (nBlockNumber == 1) {
 		if (!is_valid(pBuffer)) {
 			return 0;
 		}
 	}
 
-	const auto nOffset = (nBlockNumber - 1) * 512U;
+#if defined (CONFIG_TFTP_FLASH_STREAM)
+	const auto *pSrc = reinterpret_cast<const uint8_t *>(pBuffer);
+	auto nRemaining = static_cast<uint32_t>(nCount);
+
+	while (nRemaining != 0) {
+		auto& sector = m_SectorBuffer[m_nFillIndex];
+		const auto nCopy = std::min(nRemaining, SECTOR_SIZE - sector.nLength);
 
-	assert((nOffset + nCount) <= m_nSize);
+		memcpy(&sector.data[sector.nLength], pSrc, nCopy);
 
-	memcpy(&m_pBuffer[nOffset], pBuffer, nCount);
+		sector.nLength += nCopy;
+		pSrc += nCopy;
+		nRemaining -= nCopy;
+
+		if (sector.nLength == SECTOR_SIZE) {
+			// FileWriteReady keeps a free sector buffer for the next window
+			assert(m_nPending < (SECTOR_BUFFERS - 1));
+			m_nPending++;
+			m_nFillIndex = (m_nFillIndex + 1) % SECTOR_BUFFERS;
+			m_SectorBuffer[m_nFillIndex].nLength = 0;
+		}
+	}
+#else
+	memcpy(&m_pBuffer[m_nFileSize], pBuffer, nCount);
+#endif
 
-	m_nFileSize += nCount; //FIXME BUG When in retry ?
+	m_nFileSize += static_cast<uint32_t>(nCount);
 
 	Display::Get()->Progress();
 
 	return nCount;
 }
+
+#if defined (CONFIG_TFTP_FLASH_STREAM)
+/**
+ * A full sector buffer can be received while the previous one is programmed.
+ */
+bool TFTPFileServer::FileWriteReady() {
+	FlashRun();
+
+	if (m_FlashState == FlashState::ERROR) {
+		return true;	// FileWrite fails, the daemon sends an error
+	}
+
+	return m_nPending < (SECTOR_BUFFERS - 1);
+}
+
+void TFTPFileServer::FlashRun() {
+	auto *pFlashCode = FlashCode::Get();
+	const auto& sector = m_SectorBuffer[m_nFlashIndex];
+	flashcode::result nResult;
+
+	switch (m_FlashState) {
+	case FlashState::IDLE:
+		if (m_nPending != 0) {
+			m_FlashState = FlashState::ERASE;
+			pFlashCode->Erase(CONFIG_TFTP_FLASH_STREAM_OFFSET + m_nFlashOffset, SECTOR_SIZE, nResult);
+		}
+		break;
+	case FlashState::ERASE:
+		if (pFlashCode->Erase(CONFIG_TFTP_FLASH_STREAM_OFFSET + m_nFlashOffset, SECTOR_SIZE, nResult)) {
+			if (nResult != flashcode::result::OK) {
+				m_FlashState = FlashState::ERROR;
+				break;
+			}
+			m_FlashState = FlashState::WRITE;
+			pFlashCode->Write(CONFIG_TFTP_FLASH_STREAM_OFFSET + m_nFlashOffset, sector.nLength, sector.data, nResult);
+		}
+		break;
+	case FlashState::WRITE:
+		if (pFlashCode->Write(CONFIG_TFTP_FLASH_STREAM_OFFSET + m_nFlashOffset, sector.nLength, sector.data, nResult)) {
+			if (nResult != flashcode::result::OK) {
+				m_FlashState = FlashState::ERROR;
+				break;
+			}
+			DEBUG_PRINTF("m_nFlashOffset=%x, nLength=%u", m_nFlashOffset, sector.nLength);
+			m_nFlashOffset += SECTOR_SIZE;
+			m_nFlashIndex = (m_nFlashIndex + 1) % SECTOR_BUFFERS;
+			m_nPending--;
+			m_FlashState = FlashState::IDLE;
+		}
+		break;
+	case FlashState::ERROR:
+		break;
+	default:
+		assert(0);
+		__builtin_unreachable();
+		break;
+	}
+}
+#endif
@@ -32,19 +32,45 @@
 #endif
 
 #include <cstdio>
+#include <cstring>
 #include <cassert>
 
 #include "showfileprotocol.h"
 #include "showfileconst.h"
 
+#include "hardware.h"
+
 #include "debug.h"
 
 #define SHOWFILE_PREFIX	"show"
 #define SHOWFILE_SUFFIX	".txt"
 
+#if !defined (CONFIG_SHOWFILE_RECORD_BUFFER_SIZE)
+# define CONFIG_SHOWFILE_RECORD_BUFFER_SIZE	(16 * 1024)
+#endif
+
 namespace showfile {
 static constexpr uint32_t FILE_NAME_LENGTH = sizeof(SHOWFILE_PREFIX "NN" SHOWFILE_SUFFIX) - 1U;
 static constexpr uint32_t FILE_MAX_NUMBER = 99;
+/*
+ * Universes staged ahead of a frame deadline. A node outputs at most its own ports.
+ * A controller sends the universes of the show file, there is no such limit.
+ */
+#if defined (CONFIG_SHOWFILE_FRAME_UNIVERSES)
+static constexpr uint32_t FRAME_UNIVERSES = CONFIG_SHOWFILE_FRAME_UNIVERSES;
+#elif defined (CONFIG_SHOWFILE_PROTOCOL_NODE_E131)
+static constexpr uint32_t FRAME_UNIVERSES = e131bridge::MAX_PORTS;
+#elif defined (CONFIG_SHOWFILE_PROTOCOL_NODE_ARTNET)
+static constexpr uint32_t FRAME_UNIVERSES = artnetnode::MAX_PORTS;
+#else
+static constexpr uint32_t FRAME_UNIVERSES = 4;
+#endif
+static constexpr uint32_t MAX_LATE_MILLIS = 1000;	///< Beyond this the timeline is restarted instead of catching up
+static constexpr uint32_t LINE_SIZE = 6 + 6 + (512 * 4) + 1;	///< Delay line, universe and 512 slots
+static constexpr uint32_t RECORD_BUFFER_SIZE = CONFIG_SHOWFILE_RECORD_BUFFER_SIZE;
+static constexpr uint32_t RECORD_FLUSH_SIZE = 2048;	///< Bytes per write to the file system
+static_assert((RECORD_BUFFER_SIZE & (RECORD_BUFFER_SIZE - 1)) == 0, "RECORD_BUFFER_SIZE must be a power of 2");
+static_assert(RECORD_BUFFER_SIZE >= (RECORD_FLUSH_SIZE + LINE_SIZE));
 }  // namespace showfile
 
 class ShowFileFormat: ShowFileProtocol {
@@ -74,6 +100,7 @@ public:
 
 		fseek(m_pShowFile, 0L, SEEK_SET);
 
+		FrameReset();
 		m_OlaState = OlaState::IDLE;
 
 		DEBUG_EXIT
@@ -82,6 +109,14 @@ public:
 	void ShowFileStop() {
 		DEBUG_ENTRY
 
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+		if ((m_OlaState == OlaState::RECORD_FIRST) || (m_OlaState == OlaState::RECORDING)) {
+			RecordFlush(true);
+			m_OlaState = OlaState::IDLE;
+			DEBUG_PRINTF("m_nRecordOverruns=%u", m_nRecordOverruns);
+		}
+#endif
+
 		DEBUG_EXIT
 	}
 
@@ -90,6 +125,7 @@ public:
 
 		m_nDelayMillis = 0;
 		m_nLastMillis = 0;
+		m_nFrameMillis = Hardware::Get()->Millis();
 
 		DEBUG_EXIT
 	}
@@ -98,15 +134,20 @@ public:
 		DEBUG_ENTRY
 		DEBUG_PRINTF("m_pShowFile%snullptr", m_pShowFile != nullptr ? "!=" : "==");
 
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
 		if (m_pShowFile != nullptr) {
-			fputs("OLA Show\n", m_pShowFile);
-#ifndef NDEBUG
-			perror("fputs");
-#endif
+			m_nRecordHead = 0;
+			m_nRecordTail = 0;
+			m_nRecordOverruns = 0;
+
+			static constexpr char HEADER[] = "OLA Show\n";
+			RecordPut(HEADER, sizeof(HEADER) - 1);
+
 			m_OlaState = OlaState::RECORD_FIRST;
 		} else {
 			m_OlaState = OlaState::IDLE;
 		}
+#endif
 
 		ShowFileProtocol::Record();
 
@@ -122,6 +163,11 @@ public:
 		if (doRun) {
 			Run();
 		}
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+		else if (m_OlaState == OlaState::RECORDING) {
+			RecordFlush(false);
+		}
+#endif
 
 		ShowFileProtocol::Run();
 	}
@@ -130,25 +176,21 @@ public:
 		ShowFileProtocol::DoRunCleanupProcess(bDoRun);
 	}
 
-	void ShowfileWrite(const uint8_t *pDmxData,const uint32_t nSize, const uint32_t nUniverse, const uint32_t nMillis) {
-		if (m_OlaState == OlaState::RECORD_FIRST) {
-			m_OlaState = OlaState::RECORDING;
-		} else {
-			auto *p = m_buffer;
+	/**
+	 * Called from the receive path with the receive time stamp. The lines
+	 * are only formatted into the RAM ring here, the file system writes are
+	 * done from ShowFileRun(). A packet that does not fit is dropped and
+	 * counted, the next delay line then covers the gap.
+	 */
+	void ShowfileWrite([[maybe_unused]] const uint8_t *pDmxData, [[maybe_unused]] const uint32_t nSize, [[maybe_unused]] const uint32_t nUniverse, [[maybe_unused]] const uint32_t nMillis) {
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+		auto *p = m_buffer;
+
+		if (m_OlaState != OlaState::RECORD_FIRST) {
 			p += fast_itoa_universe(nMillis - m_nLastMillis, p);
 			*p++ = '\n';
-			*p = '\0';
-			fputs(m_buffer, m_pShowFile);
-#ifndef NDEBUG
-			perror("fputs");
-			printf("[%s]", m_buffer);
-#endif
 		}
 
-		m_nLastMillis = nMillis;
-
-		auto *p = m_buffer;
-
 		p += fast_itoa_universe(nUniverse & 0xFFFF, p);
 		*p++ = ' ';
 
@@ -158,15 +200,24 @@ public:
 		}
 
 		*--p = '\n';
-		*++p = '\0';
+		p++;
 
-		fputs(m_buffer, m_pShowFile);
-#ifndef NDEBUG
-		perror("fputs");
-		printf("[%s]", m_buffer);
+		if (!RecordPut(m_buffer, static_cast<uint32_t>(p - m_buffer))) {
+			m_nRecordOverruns++;
+			return;
+		}
+
+		m_nLastMillis = nMillis;
+		m_OlaState = OlaState::RECORDING;
 #endif
 	}
 
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+	uint32_t GetRecordOverruns() const {
+		return m_nRecordOverruns;
+	}
+#endif
+
 	void BlackOut() {
 #if defined (CONFIG_SHOWFILE_ENABLE_MASTER)
 		ShowFileProtocol::DmxBlackout();
@@ -189,6 +240,17 @@ public:
 
 private:
 	void Run();
+	void FrameParse();
+	void FrameOut();
+
+	void FrameReset() {
+		m_nFrameMillis = Hardware::Get()->Millis();
+		m_nFrameDelayMillis = 0;
+		m_nFrameUniverses = 0;
+		m_bFrameHasData = false;
+		m_bFrameComplete = false;
+		m_bEndOfFile = false;
+	}
 	/*
 	 * Using a lookup table to convert binary numbers from 0 to 99
 	 * into ascii characters as described by Andrei Alexandrescu in
@@ -290,16 +352,83 @@ private:
 	OlaParseCode ParseLine(const char *pLine);
 	OlaParseCode ParseDmxData(const char *pLine);
 
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+	bool RecordPut(const char *pData, const uint32_t nLength) {
+		if ((showfile::RECORD_BUFFER_SIZE - (m_nRecordHead - m_nRecordTail)) < nLength) {
+			return false;
+		}
+
+		const auto nOffset = m_nRecordHead & (showfile::RECORD_BUFFER_SIZE - 1);
+		const auto nPart = (nLength < (showfile::RECORD_BUFFER_SIZE - nOffset)) ? nLength : (showfile::RECORD_BUFFER_SIZE - nOffset);
+
+		memcpy(&s_RecordBuffer[nOffset], pData, nPart);
+		memcpy(s_RecordBuffer, &pData[nPart], nLength - nPart);
+
+		m_nRecordHead += nLength;
+		return true;
+	}
+
+	/*
+	 * The ring size is a multiple of RECORD_FLUSH_SIZE, so a full chunk
+	 * never wraps. Only the final flush writes a partial chunk.
+	 */
+	void RecordFlush(const bool bAll) {
+		while ((m_nRecordHead - m_nRecordTail) >= (bAll ? 1 : showfile::RECORD_FLUSH_SIZE)) {
+			const auto nOffset = m_nRecordTail & (showfile::RECORD_BUFFER_SIZE - 1);
+			auto nLength = m_nRecordHead - m_nRecordTail;
+
+			if (nLength > showfile::RECORD_FLUSH_SIZE) {
+				nLength = showfile::RECORD_FLUSH_SIZE;
+			}
+
+			if (nLength > (showfile::RECORD_BUFFER_SIZE - nOffset)) {
+				nLength = showfile::RECORD_BUFFER_SIZE - nOffset;
+			}
+
+			fwrite(&s_RecordBuffer[nOffset], 1, nLength, m_pShowFile);
+			m_nRecordTail += nLength;
+
+			if (!bAll) {
+				return;
+			}
+		}
+	}
+#endif
+
 private:
 	OlaParseCode m_OlaParseCode { OlaParseCode::FAILED };
 	OlaState m_OlaState { OlaState::IDLE };
-	char m_buffer[2048];
+	char m_buffer[showfile::LINE_SIZE];
 	char m_digitsTable[200];
 	uint32_t m_nDelayMillis { 0 };
 	uint32_t m_nLastMillis { 0 };
-	uint32_t m_nDmxDataLength { 0 };
-	uint16_t m_nUniverse { 0 };
-	uint8_t m_DmxData[512];
+	/*
+	 * The frame is decoded ahead while waiting for its deadline.
+	 * m_nFrameMillis is an absolute point on the show timeline,
+	 * each delay line moves it forward by the delay.
+	 */
+	struct Universe {
+		uint16_t nUniverse;
+		uint16_t nLength;
+		uint8_t data[512];
+	};
+	static Universe s_Frame[showfile::FRAME_UNIVERSES];
+	uint32_t m_nFrameMillis { 0 };
+	uint32_t m_nFrameDelayMillis { 0 };
+	uint32_t m_nFrameUniverses { 0 };
+	bool m_bFrameHasData { false };
+	bool m_bFrameComplete { false };
+	bool m_bEndOfFile { false };
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+	/*
+	 * Recorder RAM ring, m_nRecordHead and m_nRecordTail are free running.
+	 * Static, as ShowFile is constructed on the stack.
+	 */
+	static char s_RecordBuffer[showfile::RECORD_BUFFER_SIZE];
+	uint32_t m_nRecordHead { 0 };
+	uint32_t m_nRecordTail { 0 };
+	uint32_t m_nRecordOverruns { 0 };
+#endif
 
 	static ShowFileFormat *s_pThis;
 };
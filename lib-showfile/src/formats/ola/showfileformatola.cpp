@@ -36,36 +36,96 @@
 #include "debug.h"
 
 ShowFileFormat *ShowFileFormat::s_pThis;
-
+ShowFileFormat::Universe ShowFileFormat::s_Frame[showfile::FRAME_UNIVERSES];
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+char ShowFileFormat::s_RecordBuffer[showfile::RECORD_BUFFER_SIZE];
+#endif
+
+/*
+ * One line is decoded per call into the frame staging buffer. The frame is
+ * sent when its deadline on the show timeline has passed: all universes back
+ * to back, followed by the sync. The staging buffer holds the universes of
+ * the output ports, the remaining universes of a larger frame are decoded and
+ * sent straight after the staged ones, before the sync.
+ */
 void ShowFileFormat::Run() {
 	if (m_OlaState != OlaState::TIME_WAITING) {
-		m_OlaParseCode = GetNextLine();
+		if (m_nFrameUniverses == showfile::FRAME_UNIVERSES) {
+			m_OlaState = OlaState::TIME_WAITING;
+		} else {
+			FrameParse();
+		}
+	}
 
-		if (m_OlaParseCode == OlaParseCode::DMX) {
-			if (m_nDmxDataLength != 0) {
-				ShowFileProtocol::DmxOut(m_nUniverse, m_DmxData, m_nDmxDataLength);
-			}
-		} else if (m_OlaParseCode == OlaParseCode::TIME) {
-			if (m_nDelayMillis != 0) {
-				if (m_nDmxDataLength != 0) {
-					ShowFileProtocol::DmxSync();
-				}
+	if (m_OlaState == OlaState::TIME_WAITING) {
+		const auto nMillis = Hardware::Get()->Millis();
+		const auto nLate = static_cast<int32_t>(nMillis - m_nFrameMillis);
+
+		if (nLate >= 0) {
+			if (nLate > static_cast<int32_t>(showfile::MAX_LATE_MILLIS)) {
+				m_nFrameMillis = nMillis;
 			}
+
+			FrameOut();
+		}
+	}
+}
+
+void ShowFileFormat::FrameParse() {
+	m_OlaParseCode = GetNextLine();
+
+	if (m_OlaParseCode == OlaParseCode::DMX) {
+		if (s_Frame[m_nFrameUniverses].nLength != 0) {
+			m_nFrameUniverses++;
+		}
+	} else if (m_OlaParseCode == OlaParseCode::TIME) {
+		if (m_nDelayMillis != 0) {
+			m_nFrameDelayMillis = m_nDelayMillis;
+			m_bFrameComplete = true;
+			m_OlaState = OlaState::TIME_WAITING;
+		}
+	} else if (m_OlaParseCode == OlaParseCode::EOFILE) {
+		if (m_bDoLoop) {
+			fseek(m_pShowFile, 0L, SEEK_SET);
+		} else {
+			m_bEndOfFile = true;
 			m_OlaState = OlaState::TIME_WAITING;
-		} else if (m_OlaParseCode == OlaParseCode::EOFILE) {
-			if (m_bDoLoop) {
-				fseek(m_pShowFile, 0L, SEEK_SET);
-			} else {
-				ShowFile::Get()->SetStatus(showfile::Status::ENDED);
-			}
 		}
 	}
+}
+
+void ShowFileFormat::FrameOut() {
+	for (;;) {
+		for (uint32_t nIndex = 0; nIndex < m_nFrameUniverses; nIndex++) {
+			const auto& universe = s_Frame[nIndex];
+			ShowFileProtocol::DmxOut(universe.nUniverse, universe.data, universe.nLength);
+		}
+
+		m_bFrameHasData = m_bFrameHasData || (m_nFrameUniverses != 0);
+		m_nFrameUniverses = 0;
 
-	const auto nMillis = Hardware::Get()->Millis();
+		if (m_bFrameComplete || m_bEndOfFile || (m_OlaParseCode == OlaParseCode::EOFILE)) {
+			break;
+		}
 
-	if ((nMillis - m_nLastMillis) >= m_nDelayMillis) {
-		m_nLastMillis = nMillis;
-		m_OlaState = OlaState::PARSING_DMX;
+		FrameParse();
+	}
+
+	if (m_bFrameComplete) {
+		if (m_bFrameHasData) {
+			ShowFileProtocol::DmxSync();
+		}
+
+		m_nFrameMillis += m_nFrameDelayMillis;
+		m_bFrameHasData = false;
+		m_bFrameComplete = false;
+	}
+
+	m_OlaState = OlaState::PARSING_DMX;
+
+	if (m_bEndOfFile) {
+		m_bEndOfFile = false;
+		ShowFile::Get()->SetStatus(showfile::Status::ENDED);
 	}
 }
 
@@ -73,6 +133,9 @@ ShowFileFormat::OlaParseCode ShowFileFormat::ParseDmxData(const char *pLine) {
 	char *p = const_cast<char *>(pLine);
 	int64_t k = 0;
 	uint32_t nLength = 0;
+	auto& universe = s_Frame[m_nFrameUniverses];
+
+	universe.nLength = 0;
 
 	while (isdigit(*p) == 1) {
 		k = k * 10 + *p - '0';
@@ -86,12 +149,12 @@ ShowFileFormat::OlaParseCode ShowFileFormat::ParseDmxData(const char *pLine) {
 
 		if (*p == ',' || (isdigit(*p) == 0)) {
 
-			if (nLength > 512) {
+			if (nLength >= sizeof(universe.data)) {
 				DEBUG_EXIT
 				return OlaParseCode::FAILED;
 			}
 
-			m_DmxData[nLength] = static_cast<uint8_t>(k);
+			universe.data[nLength] = static_cast<uint8_t>(k);
 
 			k = 0;
 			nLength++;
@@ -99,7 +162,7 @@ ShowFileFormat::OlaParseCode ShowFileFormat::ParseDmxData(const char *pLine) {
 		}
 	}
 
-	m_nDmxDataLength  = nLength;
+	universe.nLength = static_cast<uint16_t>(nLength);
 
 	return OlaParseCode::DMX;
 }
@@ -119,7 +182,7 @@ ShowFileFormat::OlaParseCode ShowFileFormat::ParseLine(const char *pLine) {
 
 	if (*p++ == ' ') {
 		m_nDelayMillis = 0;
-		m_nUniverse = static_cast<uint16_t>(k);
+		s_Frame[m_nFrameUniverses].nUniverse = static_cast<uint16_t>(k);
 		return ParseDmxData(p);
 	}
 
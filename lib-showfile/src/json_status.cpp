@@ -98,6 +98,17 @@ uint32_t json_get_status(char *pOutBuffer, const uint32_t nOutBufferSize) {
 	const auto status = ShowFile::Get()->GetStatus();
 	assert(status != ::showfile::Status::UNDEFINED);
 
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+	const auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
+						"{\"mode\":\"%s\",\"%s\":\"%u\",\"status\":\"%s\",\"%s\":\"%s\",\"overruns\":\"%u\"}",
+						ShowFile::Get()->GetMode() == ::showfile::Mode::RECORDER ? "Recorder" : "Player",
+						ShowFileParamsConst::SHOW,
+						static_cast<unsigned int>(ShowFile::Get()->GetShowFileCurrent()),
+						::showfile::STATUS[static_cast<int>(status)],
+						ShowFileParamsConst::OPTION_LOOP,
+						ShowFile::Get()->GetDoLoop() ? "1" : "0",
+						static_cast<unsigned int>(ShowFile::Get()->GetRecordOverruns())));
+#else
 	const auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
 						"{\"mode\":\"%s\",\"%s\":\"%u\",\"status\":\"%s\",\"%s\":\"%s\"}",
 						ShowFile::Get()->GetMode() == ::showfile::Mode::RECORDER ? "Recorder" : "Player",
@@ -106,6 +117,7 @@ uint32_t json_get_status(char *pOutBuffer, const uint32_t nOutBufferSize) {
 						::showfile::STATUS[static_cast<int>(status)],
 						ShowFileParamsConst::OPTION_LOOP,
 						ShowFile::Get()->GetDoLoop() ? "1" : "0"));
+#endif
 	return nLength;
 }
 
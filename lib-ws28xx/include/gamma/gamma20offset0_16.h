@@ -0,0 +1,19 @@
+// gamma=2.0, offset=0.0, 16-bit (0x0000-0xFF00)
+static constexpr uint16_t gamma20_0_16[256] = {
+     0,     1,     4,     9,    16,    25,    36,    49,    64,    81,   100,   121,   145,   170,   197,   226,
+   257,   290,   325,   362,   402,   443,   486,   531,   578,   627,   679,   732,   787,   844,   904,   965,
+  1028,  1093,  1161,  1230,  1301,  1374,  1450,  1527,  1606,  1688,  1771,  1856,  1944,  2033,  2124,  2218,
+  2313,  2410,  2510,  2611,  2715,  2820,  2927,  3037,  3148,  3262,  3377,  3495,  3614,  3736,  3859,  3985,
+  4112,  4242,  4373,  4507,  4642,  4780,  4919,  5061,  5204,  5350,  5497,  5647,  5799,  5952,  6108,  6265,
+  6425,  6587,  6750,  6916,  7084,  7253,  7425,  7599,  7774,  7952,  8132,  8313,  8497,  8683,  8871,  9060,
+  9252,  9446,  9642,  9839, 10039, 10241, 10445, 10651, 10858, 11068, 11280, 11494, 11710, 11928, 12147, 12369,
+ 12593, 12819, 13047, 13277, 13509, 13743, 13979, 14217, 14456, 14698, 14942, 15188, 15436, 15686, 15938, 16192,
+ 16448, 16706, 16966, 17228, 17492, 17758, 18026, 18296, 18569, 18843, 19119, 19397, 19677, 19959, 20243, 20529,
+ 20817, 21107, 21400, 21694, 21990, 22288, 22588, 22890, 23195, 23501, 23809, 24119, 24431, 24746, 25062, 25380,
+ 25700, 26023, 26347, 26673, 27001, 27332, 27664, 27998, 28335, 28673, 29013, 29356, 29700, 30046, 30395, 30745,
+ 31097, 31452, 31808, 32167, 32527, 32889, 33254, 33620, 33989, 34359, 34732, 35106, 35483, 35861, 36242, 36624,
+ 37009, 37395, 37784, 38174, 38567, 38961, 39358, 39756, 40157, 40559, 40964, 41371, 41779, 42190, 42602, 43017,
+ 43434, 43852, 44273, 44696, 45120, 45547, 45976, 46406, 46839, 47274, 47710, 48149, 48590, 49033, 49477, 49924,
+ 50373, 50824, 51276, 51731, 52188, 52647, 53107, 53570, 54035, 54502, 54971, 55442, 55914, 56389, 56866, 57345,
+ 57826, 58309, 58794, 59281, 59769, 60260, 60753, 61248, 61745, 62244, 62745, 63248, 63753, 64260, 64769, 65280 
+};
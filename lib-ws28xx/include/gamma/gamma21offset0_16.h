@@ -0,0 +1,19 @@
+// gamma=2.1, offset=0.0, 16-bit (0x0000-0xFF00)
+static constexpr uint16_t gamma21_0_16[256] = {
+     0,     1,     2,     6,    11,    17,    25,    34,    45,    58,    73,    89,   106,   126,   147,   170,
+   195,   221,   250,   280,   311,   345,   380,   418,   457,   497,   540,   585,   631,   679,   729,   781,
+   835,   891,   949,  1008,  1070,  1133,  1198,  1266,  1335,  1406,  1479,  1554,  1630,  1709,  1790,  1873,
+  1957,  2044,  2132,  2223,  2316,  2410,  2507,  2605,  2705,  2808,  2912,  3019,  3127,  3238,  3350,  3465,
+  3581,  3700,  3820,  3943,  4067,  4194,  4323,  4453,  4586,  4721,  4858,  4997,  5138,  5281,  5426,  5573,
+  5722,  5873,  6026,  6182,  6339,  6499,  6660,  6824,  6990,  7158,  7327,  7500,  7674,  7850,  8028,  8209,
+  8391,  8576,  8762,  8951,  9142,  9335,  9530,  9728,  9927, 10128, 10332, 10538, 10746, 10956, 11168, 11382,
+ 11599, 11817, 12038, 12261, 12486, 12713, 12942, 13173, 13407, 13643, 13880, 14120, 14363, 14607, 14853, 15102,
+ 15353, 15606, 15861, 16118, 16378, 16639, 16903, 17169, 17437, 17708, 17980, 18255, 18532, 18811, 19092, 19375,
+ 19661, 19949, 20239, 20531, 20825, 21122, 21421, 21722, 22025, 22330, 22638, 22948, 23260, 23574, 23891, 24209,
+ 24530, 24853, 25178, 25506, 25836, 26167, 26502, 26838, 27177, 27517, 27860, 28206, 28553, 28903, 29255, 29609,
+ 29966, 30324, 30685, 31048, 31414, 31781, 32151, 32523, 32898, 33274, 33653, 34034, 34417, 34803, 35191, 35581,
+ 35973, 36368, 36765, 37164, 37565, 37969, 38374, 38783, 39193, 39606, 40021, 40438, 40857, 41279, 41703, 42129,
+ 42558, 42989, 43422, 43857, 44295, 44735, 45177, 45621, 46068, 46517, 46968, 47422, 47878, 48336, 48796, 49259,
+ 49724, 50191, 50661, 51133, 51607, 52084, 52562, 53043, 53527, 54012, 54500, 54991, 55483, 55978, 56475, 56975,
+ 57476, 57980, 58487, 58996, 59506, 60020, 60535, 61053, 61574, 62096, 62621, 63148, 63678, 64209, 64744, 65280 
+};
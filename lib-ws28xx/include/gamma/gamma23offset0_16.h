@@ -0,0 +1,19 @@
+// gamma=2.3, offset=0.0, 16-bit (0x0000-0xFF00)
+static constexpr uint16_t gamma23_0_16[256] = {
+     0,     0,     1,     2,     5,     8,    12,    17,    23,    30,    38,    47,    58,    69,    82,    97,
+   112,   129,   147,   166,   187,   209,   233,   258,   285,   313,   342,   373,   406,   440,   475,   513,
+   552,   592,   634,   678,   723,   770,   819,   869,   921,   975,  1031,  1088,  1147,  1208,  1271,  1335,
+  1401,  1470,  1539,  1611,  1685,  1760,  1838,  1917,  1998,  2081,  2166,  2253,  2341,  2432,  2525,  2620,
+  2716,  2815,  2915,  3018,  3123,  3229,  3338,  3449,  3561,  3676,  3793,  3912,  4033,  4156,  4281,  4408,
+  4538,  4669,  4803,  4939,  5077,  5217,  5359,  5503,  5650,  5799,  5950,  6103,  6258,  6416,  6576,  6738,
+  6902,  7068,  7237,  7408,  7581,  7757,  7934,  8115,  8297,  8482,  8668,  8858,  9049,  9243,  9439,  9638,
+  9839, 10042, 10248, 10455, 10666, 10878, 11093, 11311, 11531, 11753, 11977, 12204, 12434, 12666, 12900, 13137,
+ 13376, 13617, 13861, 14108, 14357, 14608, 14862, 15118, 15377, 15638, 15902, 16169, 16437, 16709, 16982, 17259,
+ 17538, 17819, 18103, 18389, 18678, 18970, 19264, 19561, 19860, 20162, 20466, 20773, 21083, 21395, 21709, 22027,
+ 22347, 22669, 22994, 23322, 23653, 23986, 24321, 24660, 25001, 25344, 25690, 26039, 26391, 26745, 27102, 27462,
+ 27824, 28189, 28556, 28927, 29300, 29676, 30054, 30435, 30819, 31206, 31595, 31987, 32382, 32779, 33180, 33583,
+ 33988, 34397, 34808, 35222, 35639, 36059, 36481, 36906, 37334, 37765, 38198, 38635, 39074, 39516, 39961, 40408,
+ 40859, 41312, 41768, 42227, 42688, 43153, 43620, 44091, 44564, 45040, 45518, 46000, 46485, 46972, 47462, 47956,
+ 48452, 48951, 49452, 49957, 50465, 50975, 51489, 52005, 52524, 53046, 53572, 54100, 54631, 55164, 55701, 56241,
+ 56784, 57329, 57878, 58429, 58984, 59541, 60102, 60665, 61232, 61801, 62373, 62949, 63527, 64108, 64693, 65280 
+};
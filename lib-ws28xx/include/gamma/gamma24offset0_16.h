@@ -0,0 +1,19 @@
+// gamma=2.4, offset=0.0, 16-bit (0x0000-0xFF00)
+static constexpr uint16_t gamma24_0_16[256] = {
+     0,     0,     1,     2,     3,     5,     8,    12,    16,    21,    27,    35,    43,    52,    62,    73,
+    85,    98,   113,   128,   145,   163,   182,   203,   225,   248,   272,   298,   325,   354,   384,   415,
+   448,   483,   518,   556,   595,   635,   677,   721,   766,   812,   861,   911,   962,  1016,  1071,  1128,
+  1186,  1246,  1308,  1372,  1437,  1504,  1573,  1644,  1717,  1791,  1868,  1946,  2026,  2108,  2192,  2278,
+  2365,  2455,  2547,  2640,  2736,  2833,  2933,  3035,  3138,  3244,  3352,  3461,  3573,  3687,  3803,  3921,
+  4041,  4163,  4288,  4414,  4543,  4674,  4807,  4942,  5080,  5219,  5361,  5505,  5652,  5800,  5951,  6104,
+  6259,  6417,  6577,  6739,  6904,  7071,  7240,  7411,  7585,  7761,  7940,  8121,  8304,  8490,  8678,  8869,
+  9062,  9257,  9455,  9655,  9858, 10063, 10271, 10481, 10693, 10909, 11126, 11346, 11569, 11794, 12022, 12252,
+ 12485, 12720, 12958, 13199, 13442, 13688, 13936, 14187, 14440, 14696, 14955, 15217, 15481, 15747, 16017, 16289,
+ 16564, 16841, 17121, 17404, 17689, 17978, 18268, 18562, 18859, 19158, 19460, 19764, 20072, 20382, 20695, 21011,
+ 21329, 21650, 21975, 22301, 22631, 22964, 23299, 23638, 23979, 24323, 24670, 25019, 25372, 25727, 26086, 26447,
+ 26811, 27178, 27548, 27921, 28297, 28676, 29057, 29442, 29830, 30220, 30614, 31010, 31410, 31812, 32218, 32626,
+ 33037, 33452, 33869, 34290, 34713, 35140, 35570, 36002, 36438, 36877, 37319, 37764, 38212, 38663, 39117, 39574,
+ 40035, 40498, 40965, 41434, 41907, 42383, 42862, 43345, 43830, 44319, 44810, 45305, 45803, 46305, 46809, 47317,
+ 47828, 48342, 48859, 49379, 49903, 50430, 50960, 51494, 52030, 52570, 53113, 53659, 54209, 54762, 55318, 55878,
+ 56440, 57007, 57576, 58149, 58724, 59304, 59886, 60472, 61062, 61654, 62250, 62849, 63452, 64058, 64667, 65280 
+};
@@ -0,0 +1,19 @@
+// gamma=2.5, offset=0.0, 16-bit (0x0000-0xFF00)
+static constexpr uint16_t gamma25_0_16[256] = {
+     0,     0,     0,     1,     2,     4,     6,     8,    11,    15,    20,    25,    31,    38,    46,    55,
+    64,    75,    86,    99,   112,   127,   143,   159,   177,   196,   217,   238,   261,   285,   310,   336,
+   364,   393,   424,   456,   489,   524,   560,   597,   636,   677,   719,   762,   807,   854,   902,   952,
+  1004,  1057,  1111,  1168,  1226,  1286,  1347,  1410,  1475,  1542,  1611,  1681,  1753,  1827,  1903,  1981,
+  2060,  2141,  2225,  2310,  2397,  2486,  2577,  2670,  2765,  2862,  2961,  3063,  3166,  3271,  3378,  3487,
+  3599,  3712,  3828,  3946,  4066,  4188,  4312,  4438,  4567,  4698,  4831,  4966,  5104,  5244,  5386,  5530,
+  5677,  5826,  5977,  6131,  6287,  6445,  6606,  6769,  6934,  7102,  7273,  7445,  7621,  7798,  7978,  8161,
+  8346,  8533,  8724,  8916,  9111,  9309,  9509,  9712,  9917, 10125, 10335, 10549, 10764, 10983, 11204, 11427,
+ 11653, 11882, 12114, 12348, 12585, 12825, 13067, 13313, 13561, 13811, 14065, 14321, 14580, 14841, 15106, 15373,
+ 15644, 15917, 16192, 16471, 16753, 17037, 17324, 17615, 17908, 18204, 18503, 18804, 19109, 19417, 19728, 20041,
+ 20358, 20677, 21000, 21325, 21654, 21986, 22320, 22658, 22999, 23342, 23689, 24039, 24392, 24748, 25107, 25470,
+ 25835, 26204, 26575, 26950, 27328, 27709, 28094, 28481, 28872, 29266, 29663, 30063, 30467, 30873, 31283, 31697,
+ 32113, 32533, 32956, 33382, 33812, 34245, 34681, 35121, 35564, 36010, 36459, 36912, 37368, 37828, 38291, 38757,
+ 39227, 39700, 40177, 40657, 41140, 41627, 42118, 42611, 43109, 43609, 44113, 44621, 45132, 45647, 46165, 46687,
+ 47212, 47740, 48273, 48808, 49348, 49891, 50437, 50987, 51541, 52098, 52659, 53223, 53791, 54363, 54938, 55517,
+ 56099, 56686, 57275, 57869, 58466, 59067, 59672, 60280, 60892, 61507, 62127, 62750, 63377, 64008, 64642, 65280 
+};
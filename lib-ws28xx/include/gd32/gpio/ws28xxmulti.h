@@ -38,6 +38,11 @@ public:
 	void SetColourRTZ(const uint32_t nPortIndex, const uint32_t nPixelIndex, const uint8_t nColour1, const uint8_t nColour2, const uint8_t nColour3);
 	void SetColourRTZ(const uint32_t nPortIndex, const uint32_t nPixelIndex, const uint8_t nRed, const uint8_t nGreen, const uint8_t nBlue, const uint8_t nWhite);
 	void SetColourWS2801(const uint32_t nPortIndex, const uint32_t nPixelIndex, const uint8_t nColour1, const uint8_t nColour2, const uint8_t nColour3);
+	/**
+	 * 16-bit per colour pixel types (UCS8903, UCS8904). The colours are in wire order.
+	 */
+	void SetColourRTZ16(const uint32_t nPortIndex, const uint32_t nPixelIndex, const uint16_t nColour1, const uint16_t nColour2, const uint16_t nColour3);
+	void SetColourRTZ16(const uint32_t nPortIndex, const uint32_t nPixelIndex, const uint16_t nColour1, const uint16_t nColour2, const uint16_t nColour3, const uint16_t nColour4);
 	void SetPixel4Bytes(const uint32_t nPortIndex, const uint32_t nPixelIndex, const uint8_t nCtrl, const uint8_t nColour1, const uint8_t nColour2, const uint8_t nColour3);
 
 	bool IsUpdating();
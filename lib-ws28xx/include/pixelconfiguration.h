@@ -119,10 +119,32 @@ public:
 		return m_nLedsPerPixel;
 	}
 
+	/**
+	 * DMX slots per pixel. With 16-bit pixel types each led takes a coarse and a fine slot.
+	 */
+	uint32_t GetChannelsPerPixel() const {
+		return m_nChannelsPerPixel;
+	}
+
+	bool Is16Bit() const {
+		return m_bIs16Bit;
+	}
+
 	uint32_t GetRefreshRate() const {
 		return m_nRefreshRate;
 	}
 
+	/**
+	 * Caps the output frame rate, 0 is no limit.
+	 */
+	void SetMaxFps(const uint32_t nMaxFps) {
+		m_nMaxFps = nMaxFps;
+	}
+
+	uint32_t GetMaxFps() const {
+		return m_nMaxFps;
+	}
+
 #if defined (CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
 	void SetEnableGammaCorrection(const bool doEnable) {
 		m_bEnableGammaCorrection = doEnable;
@@ -141,6 +163,35 @@ public:
 	}
 #endif
 
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+	void SetEnableDithering(const bool doEnable) {
+		m_bEnableDithering = doEnable;
+	}
+
+	bool IsEnableDithering() const {
+		return m_bEnableDithering;
+	}
+
+	void SetDitherGamma(const uint32_t nValue) {
+		m_nDitherGammaValue = static_cast<uint8_t>(nValue);
+	}
+
+	uint32_t GetDitherGamma() const {
+		return m_nDitherGammaValue;
+	}
+
+	/**
+	 * 0xRRGGBB, 0xFF is 100%
+	 */
+	void SetWhiteBalance(const uint32_t nWhiteBalance) {
+		m_nWhiteBalance = nWhiteBalance & 0xFFFFFF;
+	}
+
+	uint32_t GetWhiteBalance() const {
+		return m_nWhiteBalance;
+	}
+#endif
+
 	void GetTxH(const pixel::Type type, uint8_t &nLowCode, uint8_t &nHighCode) {
 		nLowCode = 0xC0;
 		nHighCode = (type == pixel::Type::WS2812B ? 0xF8 :
@@ -150,14 +201,20 @@ public:
 	void Validate() {
 		DEBUG_ENTRY
 
-		if (m_type == pixel::Type::SK6812W) {
-			m_nCount = m_nCount <= static_cast<uint16_t>(pixel::max::ledcount::RGBW) ? m_nCount : static_cast<uint16_t>(pixel::max::ledcount::RGBW);
+		m_bIs16Bit = pixel::pixel_is_16bit(m_type);
+
+		if (pixel::pixel_is_rgbw(m_type)) {
+			const auto nMaxCount = m_bIs16Bit ? static_cast<uint32_t>(pixel::max::ledcount::RGBW16) : static_cast<uint32_t>(pixel::max::ledcount::RGBW);
+			m_nCount = m_nCount <= nMaxCount ? m_nCount : nMaxCount;
 			m_nLedsPerPixel = 4;
 		} else {
-			m_nCount = m_nCount <= static_cast<uint16_t>(pixel::max::ledcount::RGB) ? m_nCount : static_cast<uint16_t>(pixel::max::ledcount::RGB);
+			const auto nMaxCount = m_bIs16Bit ? static_cast<uint32_t>(pixel::max::ledcount::RGB16) : static_cast<uint32_t>(pixel::max::ledcount::RGB);
+			m_nCount = m_nCount <= nMaxCount ? m_nCount : nMaxCount;
 			m_nLedsPerPixel = 3;
 		}
 
+		m_nChannelsPerPixel = m_bIs16Bit ? (2 * m_nLedsPerPixel) : m_nLedsPerPixel;
+
 		if ((m_type == pixel::Type::APA102) || (m_type == pixel::Type::SK9822)){
 			if (m_nGlobalBrightness > 0x1F) {
 				m_nGlobalBrightness = 0xFF;
@@ -223,7 +280,7 @@ public:
 			//                  8 * 1000.000
 			// led time (us) =  ------------ * 8 = 10 us
 			//                   6.400.000
-			const auto nLedsTime = 10U * m_nCount * m_nLedsPerPixel;
+			const auto nLedsTime = 10U * m_nCount * m_nChannelsPerPixel;
 			m_nRefreshRate = 1000000U / nLedsTime;
 		}
 
@@ -239,12 +296,19 @@ public:
 		}
 #endif
 
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+		// The dithering is for 8-bit pixel chips only
+		if (m_bIs16Bit) {
+			m_bEnableDithering = false;
+		}
+#endif
+
 		DEBUG_EXIT
 	}
 
 	void Print() {
 		puts("Pixel configuration");
-		printf(" Type    : %s [%d] <%d leds/pixel>\n", pixel::pixel_get_type(m_type), static_cast<int>(m_type), static_cast<int>(m_nLedsPerPixel));
+		printf(" Type    : %s [%d] <%d leds/pixel%s>\n", pixel::pixel_get_type(m_type), static_cast<int>(m_type), static_cast<int>(m_nLedsPerPixel), m_bIs16Bit ? ", 16-bit" : "");
 		printf(" Count   : %d\n", m_nCount);
 
 		if (m_bIsRTZProtocol) {
@@ -259,9 +323,15 @@ public:
 
 		printf(" Clock   : %u Hz\n", static_cast<unsigned int>(m_nClockSpeedHz));
 		printf(" Refresh : %u Hz\n", static_cast<unsigned int>(m_nRefreshRate));
+		if (m_nMaxFps != 0) {
+			printf(" Max fps : %u\n", static_cast<unsigned int>(m_nMaxFps));
+		}
 
 #if defined (CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
 		printf(" Gamma correction %s\n", m_bEnableGammaCorrection ? "Yes" :  "No");
+#endif
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+		printf(" Dithering %s [Gamma %u, White balance %.6X]\n", m_bEnableDithering ? "Yes" :  "No", static_cast<unsigned int>(m_nDitherGammaValue), static_cast<unsigned int>(m_nWhiteBalance));
 #endif
 	}
 
@@ -274,18 +344,26 @@ private:
 	uint32_t m_nCount { pixel::defaults::COUNT };
 	uint32_t m_nClockSpeedHz { 0 };
 	uint32_t m_nLedsPerPixel { 3 };
+	uint32_t m_nChannelsPerPixel { 3 };
 	pixel::Type m_type { pixel::defaults::TYPE };
 	pixel::Map m_map { pixel::Map::UNDEFINED };
 	bool m_bIsRTZProtocol { true };
+	bool m_bIs16Bit { false };
 	uint8_t m_nLowCode { 0 };
 	uint8_t m_nHighCode { 0 };
 	uint8_t m_nGlobalBrightness { 0xFF };
 	uint32_t m_nRefreshRate { 0 };
+	uint32_t m_nMaxFps { 0 };
 #if defined (CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
 	uint8_t m_nGammaValue { 0 };
 	bool m_bEnableGammaCorrection { false };
 	const uint8_t *m_pGammaTable { gamma10_0 };
 #endif
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+	uint32_t m_nWhiteBalance { 0xFFFFFF };
+	uint8_t m_nDitherGammaValue { 0 };
+	bool m_bEnableDithering { false };
+#endif
 
 	static inline PixelConfiguration *s_pThis { nullptr };
 };
@@ -0,0 +1,97 @@
+/**
+ * @file pixeldither.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PIXELDITHER_H_
+#define PIXELDITHER_H_
+
+/**
+ * Output stage for 8-bit pixel chips:
+ * 8-bit DMX -> gamma and white balance into a 16-bit intermediate -> temporal dithering -> 8-bit.
+ * The fraction which cannot be shown in the current frame is carried to the next frame, per led.
+ * The output must be refreshed continuously for the dithering to be visible, see WS28xxDmxMulti::Run
+ */
+
+#include <cstdint>
+#include <cassert>
+
+#include "pixeltype.h"
+
+namespace pixel {
+namespace dither {
+#if !defined (CONFIG_PIXELDMX_MAX_PORTS)
+# define CONFIG_PIXELDMX_MAX_PORTS	8U
+#endif
+static constexpr uint32_t MAX_PORTS = CONFIG_PIXELDMX_MAX_PORTS;
+static constexpr uint32_t MAX_LEDS = (max::ledcount::RGB * 3) > (max::ledcount::RGBW * 4) ? (max::ledcount::RGB * 3) : (max::ledcount::RGBW * 4);
+static constexpr uint32_t WHITE_BALANCE_DEFAULT = 0xFFFFFF;
+}  // namespace dither
+}  // namespace pixel
+
+class PixelDither {
+public:
+	/**
+	 * @param nGammaValue 20-25 (2.0-2.5), 0 is the default for the pixel type
+	 */
+	static void Init(const pixel::Type type, const uint32_t nGammaValue);
+
+	/**
+	 * 0xFF is 100%. Colour temperature is set with the RGB ratio.
+	 */
+	static void SetWhiteBalance(const uint32_t nPortIndex, const uint8_t nRed, const uint8_t nGreen, const uint8_t nBlue, const uint8_t nWhite = 0xFF);
+	static void SetWhiteBalance(const uint8_t nRed, const uint8_t nGreen, const uint8_t nBlue) {
+		for (uint32_t nPortIndex = 0; nPortIndex < pixel::dither::MAX_PORTS; nPortIndex++) {
+			SetWhiteBalance(nPortIndex, nRed, nGreen, nBlue);
+		}
+	}
+
+	static void Reset();
+
+	/**
+	 * @param nLedIndex (nPixelIndex * nLedsPerPixel) + nColour
+	 * @param nColour 0 = Red, 1 = Green, 2 = Blue, 3 = White
+	 */
+	static uint8_t Get(const uint32_t nPortIndex, const uint32_t nLedIndex, const uint32_t nColour, const uint8_t nValue) {
+		assert(nPortIndex < pixel::dither::MAX_PORTS);
+		assert(nLedIndex < pixel::dither::MAX_LEDS);
+		assert(nColour < 4);
+
+		// 0xFF00 * 0x100 >> 8 -> maximum is 0xFF00
+		const auto nValue16 = (static_cast<uint32_t>(s_pGamma16[nValue]) * s_nWhiteBalance[nPortIndex][nColour]) >> 8;
+		const auto nAccumulated = s_Residual[nPortIndex][nLedIndex] + (nValue16 & 0xFF);
+
+		s_Residual[nPortIndex][nLedIndex] = static_cast<uint8_t>(nAccumulated);
+
+		return static_cast<uint8_t>((nValue16 >> 8) + (nAccumulated >> 8));
+	}
+
+	static void Print();
+
+private:
+	static const uint16_t *s_pGamma16;
+	static uint16_t s_nWhiteBalance[pixel::dither::MAX_PORTS][4];
+	static uint8_t s_Residual[pixel::dither::MAX_PORTS][pixel::dither::MAX_LEDS];
+};
+
+#endif /* PIXELDITHER_H_ */
@@ -134,6 +134,12 @@ private:
 				s_pOutput->SetColourRTZ(nPortIndex, nPixelIndex, nRed, nGreen, nBlue, 0x00);
 			}
 			break;
+		case pixel::Type::UCS8903:
+			s_pOutput->SetColourRTZ16(nPortIndex, nPixelIndex, static_cast<uint16_t>(nRed * 0x101), static_cast<uint16_t>(nGreen * 0x101), static_cast<uint16_t>(nBlue * 0x101));
+			break;
+		case pixel::Type::UCS8904:
+			s_pOutput->SetColourRTZ16(nPortIndex, nPixelIndex, static_cast<uint16_t>(nRed * 0x101), static_cast<uint16_t>(nGreen * 0x101), static_cast<uint16_t>(nBlue * 0x101), 0x0000);
+			break;
 		default:
 			s_pOutput->SetColourRTZ(nPortIndex, nPixelIndex, nRed, nGreen, nBlue);
 			break;
@@ -142,7 +148,11 @@ private:
 		auto& pixelConfiguration = PixelConfiguration::Get();
 		const auto type = pixelConfiguration.GetType();
 
-		if (type != pixel::Type::SK6812W) {
+		if (type == pixel::Type::UCS8903) {
+			s_pOutput->SetPixel16(nPixelIndex, static_cast<uint16_t>(nRed * 0x101), static_cast<uint16_t>(nGreen * 0x101), static_cast<uint16_t>(nBlue * 0x101));
+		} else if (type == pixel::Type::UCS8904) {
+			s_pOutput->SetPixel16(nPixelIndex, static_cast<uint16_t>(nRed * 0x101), static_cast<uint16_t>(nGreen * 0x101), static_cast<uint16_t>(nBlue * 0x101), 0x0000);
+		} else if (type != pixel::Type::SK6812W) {
 			s_pOutput->SetPixel(nPixelIndex, nRed, nGreen, nBlue);
 		} else {
 			if ((nRed == nGreen) && (nGreen == nBlue)) {
@@ -0,0 +1,161 @@
+/**
+ * @file pixelstatistics.h
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PIXELSTATISTICS_H_
+#define PIXELSTATISTICS_H_
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+#include "hardware.h"
+
+namespace pixel {
+namespace statistics {
+#if !defined (CONFIG_PIXELDMX_MAX_PORTS)
+# define CONFIG_PIXELDMX_MAX_PORTS	8U
+#endif
+static constexpr uint32_t MAX_PORTS = CONFIG_PIXELDMX_MAX_PORTS;
+/**
+ * Upper bounds (us) of the histogram buckets, the last bucket has no upper bound
+ */
+static constexpr uint32_t HISTOGRAM_BOUNDS[] = { 250, 500, 1000, 2000, 4000, 8000, 16000 };
+static constexpr uint32_t HISTOGRAM_BUCKETS = (sizeof(HISTOGRAM_BOUNDS) / sizeof(HISTOGRAM_BOUNDS[0])) + 1;
+}  // namespace statistics
+
+struct Statistics {
+	struct {
+		uint32_t Output;		///< DMA transfers started for a received frame
+		uint32_t Refreshed;		///< DMA transfers started for a dithered or blended frame in between
+		uint32_t Dropped;		///< Encoded frames overwritten before they were output
+		uint32_t Coalesced;		///< Frames waiting for the running DMA transfer
+		uint32_t Limited;		///< Frames held back by the maximum frame rate
+	} Frames;
+
+	struct {
+		uint32_t Output;
+		uint32_t Received[statistics::MAX_PORTS];
+	} Fps;
+
+	struct {
+		uint32_t Encode[statistics::HISTOGRAM_BUCKETS];		///< Encoding the frame
+		uint32_t Latency[statistics::HISTOGRAM_BUCKETS];	///< Last universe received -> DMA start
+		uint32_t Dma[statistics::HISTOGRAM_BUCKETS];		///< DMA transfer
+	} Histogram;
+};
+}  // namespace pixel
+
+class PixelStatistics {
+public:
+	static void Reset() {
+		memset(&s_Statistics, 0, sizeof(struct pixel::Statistics));
+		memset(s_nFramesReceived, 0, sizeof(s_nFramesReceived));
+		s_nFramesOutput = 0;
+		s_nMillis = Hardware::Get()->Millis();
+	}
+
+	static void FrameReceived(const uint32_t nOutputIndex) {
+		if (nOutputIndex < pixel::statistics::MAX_PORTS) {
+			s_nFramesReceived[nOutputIndex]++;
+		}
+	}
+
+	static void FrameEncoded(const uint32_t nMicros) {
+		s_Statistics.Histogram.Encode[GetBucket(nMicros)]++;
+	}
+
+	static void FrameOutput(const uint32_t nLatencyMicros) {
+		s_Statistics.Frames.Output++;
+		s_Statistics.Histogram.Latency[GetBucket(nLatencyMicros)]++;
+	}
+
+	static void FrameRefreshed() {
+		s_Statistics.Frames.Refreshed++;
+	}
+
+	static void FrameDropped() {
+		s_Statistics.Frames.Dropped++;
+	}
+
+	static void FrameCoalesced() {
+		s_Statistics.Frames.Coalesced++;
+	}
+
+	static void FrameLimited() {
+		s_Statistics.Frames.Limited++;
+	}
+
+	/**
+	 * Called from the DMA completion interrupt
+	 */
+	static void DmaDone(const uint32_t nMicros) {
+		s_Statistics.Histogram.Dma[GetBucket(nMicros)]++;
+	}
+
+	/**
+	 * The frame rates are updated once a second
+	 */
+	static void Run() {
+		const auto nMillis = Hardware::Get()->Millis();
+		const auto nElapsed = nMillis - s_nMillis;
+
+		if (__builtin_expect((nElapsed < 1000), 1)) {
+			return;
+		}
+
+		s_nMillis = nMillis;
+
+		s_Statistics.Fps.Output = ((s_Statistics.Frames.Output - s_nFramesOutput) * 1000U) / nElapsed;
+		s_nFramesOutput = s_Statistics.Frames.Output;
+
+		for (uint32_t nIndex = 0; nIndex < pixel::statistics::MAX_PORTS; nIndex++) {
+			s_Statistics.Fps.Received[nIndex] = (s_nFramesReceived[nIndex] * 1000U) / nElapsed;
+			s_nFramesReceived[nIndex] = 0;
+		}
+	}
+
+	static const pixel::Statistics& Get() {
+		return s_Statistics;
+	}
+
+private:
+	static uint32_t GetBucket(const uint32_t nMicros) {
+		uint32_t nBucket = 0;
+
+		while ((nBucket < (pixel::statistics::HISTOGRAM_BUCKETS - 1)) && (nMicros >= pixel::statistics::HISTOGRAM_BOUNDS[nBucket])) {
+			nBucket++;
+		}
+
+		return nBucket;
+	}
+
+private:
+	static inline pixel::Statistics s_Statistics;
+	static inline uint32_t s_nFramesReceived[pixel::statistics::MAX_PORTS];
+	static inline uint32_t s_nFramesOutput;
+	static inline uint32_t s_nMillis;
+};
+
+#endif /* PIXELSTATISTICS_H_ */
@@ -45,6 +45,8 @@ enum class Type {
 	APA102,
 	SK9822,
 	P9813,
+	UCS8903,
+	UCS8904,
 	UNDEFINED
 };
 enum class Map {
@@ -55,11 +57,15 @@ namespace max {
 namespace ledcount {
 static constexpr auto RGB = (4 * 170);
 static constexpr auto RGBW = (4 * 128);
+static constexpr auto RGB16 = (4 * 85);
+static constexpr auto RGBW16 = (4 * 64);
 }  // namespace ledcount
 }  // namespace max
 namespace single {
 static constexpr auto RGB = 24;
 static constexpr auto RGBW = 32;
+static constexpr auto RGB16 = 48;
+static constexpr auto RGBW16 = 64;
 }  // namespace single
 namespace spi {
 namespace speed {
@@ -79,8 +85,19 @@ static constexpr auto COUNT = 170;
 static constexpr auto OUTPUT_PORTS = 1;
 }  // namespace defaults
 
+/**
+ * 16 bits per colour channel. The DMX footprint is coarse/fine per colour.
+ */
+inline bool pixel_is_16bit(const pixel::Type type) {
+	return (type == pixel::Type::UCS8903) || (type == pixel::Type::UCS8904);
+}
+
+inline bool pixel_is_rgbw(const pixel::Type type) {
+	return (type == pixel::Type::SK6812W) || (type == pixel::Type::UCS8904);
+}
+
 inline Map pixel_get_map(const pixel::Type type) {
-	if ((type == pixel::Type::WS2811) || (type == pixel::Type::UCS2903)) {
+	if ((type == pixel::Type::WS2811) || (type == pixel::Type::UCS2903) || (type == pixel::Type::UCS8903) || (type == pixel::Type::UCS8904)) {
 		return pixel::Map::RGB;
 	}
 
@@ -39,6 +39,9 @@ public:
 
 	void SetPixel(uint32_t nIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue);
 	void SetPixel(uint32_t nIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue, uint8_t nWhite);
+	// 16-bit per colour pixel types (UCS8903, UCS8904)
+	void SetPixel16(uint32_t nIndex, uint16_t nRed, uint16_t nGreen, uint16_t nBlue);
+	void SetPixel16(uint32_t nIndex, uint16_t nRed, uint16_t nGreen, uint16_t nBlue, uint16_t nWhite);
 
 	bool IsUpdating () {
 #if defined (GD32)
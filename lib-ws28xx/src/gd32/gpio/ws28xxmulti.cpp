@@ -40,6 +40,7 @@
 #include "ws28xxmulti.h"
 #include "pixelconfiguration.h"
 #include "pixeltype.h"
+#include "pixelstatistics.h"
 
 #include "gd32/gpio/pixelmulti_config.h"
 #include "gd32.h"
@@ -81,6 +82,17 @@ namespace pixel {
 static constexpr auto PORT_COUNT = __builtin_popcount(GPIO_PINx);
 static_assert(PORT_COUNT <= 16, "Too many ports");
 //
+/**
+ * One half is the transmit buffer, the other half is the staging buffer.
+ * A half must hold the largest frame of all the RTZ pixel types.
+ */
+static constexpr uint32_t max_frame_bits(const uint32_t a, const uint32_t b) {
+	return a > b ? a : b;
+}
+static constexpr uint32_t MAX_FRAME_BITS = max_frame_bits(
+		max_frame_bits(max::ledcount::RGB * single::RGB, max::ledcount::RGBW * single::RGBW),
+		max_frame_bits(max::ledcount::RGB16 * single::RGB16, max::ledcount::RGBW16 * single::RGBW16));
+static_assert(MAX_FRAME_BITS <= 1024 * 16, "DMA buffer too small");
 static uint16_t s_DmaBuffer[2 * 1024 * 16] __attribute__ ((aligned (4))) SECTION_DMA_BUFFER;
 static constexpr auto DMA_BUFFER_SIZE = sizeof(pixel::s_DmaBuffer) / sizeof(s_DmaBuffer[0]);
 const auto *const s_pBuffer = reinterpret_cast<uint16_t *>(pixel::s_DmaBuffer + pixel::DMA_BUFFER_SIZE / 2);
@@ -94,6 +106,7 @@ static constexpr auto MAX_APA102 = ((DMA_BUFFER_SIZE / 8) - 8 ) / 4;
 }  // namespace pixel
 
 static volatile bool sv_isRunning;
+static uint32_t s_nDmaStartCycles;
 
 extern "C" {
 void TIMER3_IRQHandler() { // Slave
@@ -109,6 +122,8 @@ void TIMER3_IRQHandler() { // Slave
 		sv_isRunning = false;
 
 		GPIO_BC(GPIOx) = GPIO_PINx;
+
+		PixelStatistics::DmaDone((DWT->CYCCNT - s_nDmaStartCycles) / (MCU_CLOCK_FREQ / 1000000U));
 #ifndef NDEBUG
 		GPIO_BOP(DEBUG_CS_GPIOx) = DEBUG_CS_GPIO_PINx;
 #endif
@@ -144,7 +159,7 @@ WS28xxMulti::WS28xxMulti() {
 	}
 
 	const auto nCount = pixelConfiguration.GetCount();
-	m_nBufSize = nCount * nLedsPerPixel;
+	m_nBufSize = nCount * (pixelConfiguration.Is16Bit() ? 2U * nLedsPerPixel : nLedsPerPixel);
 
 	if ((type == pixel::Type::APA102) || (type == pixel::Type::SK9822) || (type == pixel::Type::P9813)) {
 		m_nBufSize += nCount;
@@ -624,6 +639,7 @@ void WS28xxMulti::Update() {
 #endif
 
 	sv_isRunning = true;
+	s_nDmaStartCycles = DWT->CYCCNT;
 
 	TIMER_CTL0(TIMER3) &= (~TIMER_CTL0_CEN);
 	TIMER_CNT(TIMER3) = 0;
@@ -947,3 +963,68 @@ void WS28xxMulti::SetColourRTZ(const uint32_t nPortIndex, const uint32_t nPixelI
 		j++;
 	}
 }
+
+void WS28xxMulti::SetColourRTZ16(const uint32_t nPortIndex, const uint32_t nPixelIndex, const uint16_t nColour1, const uint16_t nColour2, const uint16_t nColour3) {
+	assert(nPortIndex < pixel::PORT_COUNT);
+	assert((nPixelIndex * pixel::single::RGB16) < m_nBufSize);
+
+	uint32_t j = 0;
+	const auto k = nPixelIndex * pixel::single::RGB16;
+	const auto nBit = nPortIndex + GPIO_PIN_OFFSET;
+	auto *p = &pixel::s_pBuffer[k];
+
+	for (uint16_t mask = 0x8000; mask != 0; mask = static_cast<uint16_t>(mask >> 1)) {
+		if (!(mask & nColour1)) {
+			BIT_SET(p[j], nBit);
+		} else {
+			BIT_CLEAR(p[j], nBit);
+		}
+		if (!(mask & nColour2)) {
+			BIT_SET(p[16 + j], nBit);
+		} else {
+			BIT_CLEAR(p[16 + j], nBit);
+		}
+		if (!(mask & nColour3)) {
+			BIT_SET(p[32 + j], nBit);
+		} else {
+			BIT_CLEAR(p[32 + j], nBit);
+		}
+
+		j++;
+	}
+}
+
+void WS28xxMulti::SetColourRTZ16(const uint32_t nPortIndex, const uint32_t nPixelIndex, const uint16_t nColour1, const uint16_t nColour2, const uint16_t nColour3, const uint16_t nColour4) {
+	assert(nPortIndex < pixel::PORT_COUNT);
+	assert((nPixelIndex * pixel::single::RGBW16) < m_nBufSize);
+
+	uint32_t j = 0;
+	const auto k = nPixelIndex * pixel::single::RGBW16;
+	const auto nBit = nPortIndex + GPIO_PIN_OFFSET;
+	auto *p = &pixel::s_pBuffer[k];
+
+	for (uint16_t mask = 0x8000; mask != 0; mask = static_cast<uint16_t>(mask >> 1)) {
+		if (!(mask & nColour1)) {
+			BIT_SET(p[j], nBit);
+		} else {
+			BIT_CLEAR(p[j], nBit);
+		}
+		if (!(mask & nColour2)) {
+			BIT_SET(p[16 + j], nBit);
+		} else {
+			BIT_CLEAR(p[16 + j], nBit);
+		}
+		if (!(mask & nColour3)) {
+			BIT_SET(p[32 + j], nBit);
+		} else {
+			BIT_CLEAR(p[32 + j], nBit);
+		}
+		if (!(mask & nColour4)) {
+			BIT_SET(p[48 + j], nBit);
+		} else {
+			BIT_CLEAR(p[48 + j], nBit);
+		}
+
+		j++;
+	}
+}
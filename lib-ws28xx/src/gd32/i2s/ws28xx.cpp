@@ -54,7 +54,7 @@ WS28xx::WS28xx() {
 
 	const auto nCount = pixelConfiguration.GetCount();
 
-	m_nBufSize = nCount * pixelConfiguration.GetLedsPerPixel();
+	m_nBufSize = nCount * pixelConfiguration.GetChannelsPerPixel();
 
 	if (pixelConfiguration.IsRTZProtocol()) {
 		m_nBufSize *= 8;
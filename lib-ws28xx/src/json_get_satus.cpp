@@ -27,10 +27,74 @@
 #include <cstdio>
 
 #include "pixelconfiguration.h"
+#if defined (OUTPUT_DMX_PIXEL_MULTI)
+# include "pixelstatistics.h"
+#endif
 
 namespace remoteconfig::pixel {
+#if defined (OUTPUT_DMX_PIXEL_MULTI)
+static uint32_t add_array(char *pOutBuffer, const uint32_t nOutBufferSize, const char *pName, const uint32_t *pValues, const uint32_t nCount) {
+	auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize, "\"%s\":[", pName));
+
+	for (uint32_t i = 0; (i < nCount) && (nLength < nOutBufferSize); i++) {
+		nLength += static_cast<uint32_t>(snprintf(&pOutBuffer[nLength], nOutBufferSize - nLength, "%s%u", i == 0 ? "" : ",", static_cast<unsigned int>(pValues[i])));
+	}
+
+	if (nLength < nOutBufferSize) {
+		nLength += static_cast<uint32_t>(snprintf(&pOutBuffer[nLength], nOutBufferSize - nLength, "]"));
+	}
+
+	return nLength;
+}
+#endif
+
 uint32_t json_get_status(char *pOutBuffer, const uint32_t nOutBufferSize) {
 	auto& pixelConfiguration = PixelConfiguration::Get();
+#if !defined (OUTPUT_DMX_PIXEL_MULTI)
 	return static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize, "{\"refresh_rate\":\"%u\"}", pixelConfiguration.GetRefreshRate()));
+#else
+	const auto& statistics = PixelStatistics::Get();
+
+	auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
+			"{\"refresh_rate\":\"%u\",\"max_fps\":\"%u\",\"fps\":\"%u\","
+			"\"frames\":{\"output\":\"%u\",\"refreshed\":\"%u\",\"dropped\":\"%u\",\"coalesced\":\"%u\",\"limited\":\"%u\"},",
+			static_cast<unsigned int>(pixelConfiguration.GetRefreshRate()),
+			static_cast<unsigned int>(pixelConfiguration.GetMaxFps()),
+			static_cast<unsigned int>(statistics.Fps.Output),
+			static_cast<unsigned int>(statistics.Frames.Output),
+			static_cast<unsigned int>(statistics.Frames.Refreshed),
+			static_cast<unsigned int>(statistics.Frames.Dropped),
+			static_cast<unsigned int>(statistics.Frames.Coalesced),
+			static_cast<unsigned int>(statistics.Frames.Limited)));
+
+	struct {
+		const char *pName;
+		const uint32_t *pValues;
+		uint32_t nCount;
+		const char *pSeparator;
+	} const arrays[] = {
+			{ "fps_received", statistics.Fps.Received, ::pixel::statistics::MAX_PORTS, ",\"histogram_us\":{" },
+			{ "bounds", ::pixel::statistics::HISTOGRAM_BOUNDS, ::pixel::statistics::HISTOGRAM_BUCKETS - 1, "," },
+			{ "encode", statistics.Histogram.Encode, ::pixel::statistics::HISTOGRAM_BUCKETS, "," },
+			{ "latency", statistics.Histogram.Latency, ::pixel::statistics::HISTOGRAM_BUCKETS, "," },
+			{ "dma", statistics.Histogram.Dma, ::pixel::statistics::HISTOGRAM_BUCKETS, "}}" }
+	};
+
+	for (const auto& array : arrays) {
+		if (nLength >= nOutBufferSize) {
+			return nOutBufferSize;
+		}
+
+		nLength += add_array(&pOutBuffer[nLength], nOutBufferSize - nLength, array.pName, array.pValues, array.nCount);
+
+		if (nLength >= nOutBufferSize) {
+			return nOutBufferSize;
+		}
+
+		nLength += static_cast<uint32_t>(snprintf(&pOutBuffer[nLength], nOutBufferSize - nLength, "%s", array.pSeparator));
+	}
+
+	return nLength < nOutBufferSize ? nLength : nOutBufferSize;
+#endif
 }
 }  // namespace remoteconfig::pixel
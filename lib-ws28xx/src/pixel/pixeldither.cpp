@@ -0,0 +1,101 @@
+/**
+ * @file pixeldither.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (DEBUG_PIXEL)
+# undef NDEBUG
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cassert>
+
+#include "pixeldither.h"
+#include "pixeltype.h"
+
+#include "gamma/gamma_tables16.h"
+
+#include "debug.h"
+
+/**
+ * https://www.gd32-dmx.org/memory.html
+ */
+#if defined (GD32F20X) || defined (GD32F4XX)
+# define SECTION_DITHER		__attribute__ ((section (".pixel")))
+#else
+# define SECTION_DITHER
+#endif
+
+const uint16_t *PixelDither::s_pGamma16 { gamma10_0_16 };
+uint16_t PixelDither::s_nWhiteBalance[pixel::dither::MAX_PORTS][4];
+uint8_t PixelDither::s_Residual[pixel::dither::MAX_PORTS][pixel::dither::MAX_LEDS] SECTION_DITHER;
+
+static uint16_t scale(const uint8_t nValue) {
+	return static_cast<uint16_t>(nValue == 0xFF ? 0x100 : nValue);
+}
+
+void PixelDither::Init(const pixel::Type type, const uint32_t nGammaValue) {
+	DEBUG_ENTRY
+
+	if (nGammaValue == 0) {
+		s_pGamma16 = gamma::get_table16_default(type);
+	} else {
+		s_pGamma16 = gamma::get_table16(nGammaValue);
+	}
+
+	for (uint32_t nPortIndex = 0; nPortIndex < pixel::dither::MAX_PORTS; nPortIndex++) {
+		for (auto& nWhiteBalance : s_nWhiteBalance[nPortIndex]) {
+			nWhiteBalance = 0x100;
+		}
+	}
+
+	Reset();
+
+	DEBUG_EXIT
+}
+
+void PixelDither::SetWhiteBalance(const uint32_t nPortIndex, const uint8_t nRed, const uint8_t nGreen, const uint8_t nBlue, const uint8_t nWhite) {
+	assert(nPortIndex < pixel::dither::MAX_PORTS);
+
+	s_nWhiteBalance[nPortIndex][0] = scale(nRed);
+	s_nWhiteBalance[nPortIndex][1] = scale(nGreen);
+	s_nWhiteBalance[nPortIndex][2] = scale(nBlue);
+	s_nWhiteBalance[nPortIndex][3] = scale(nWhite);
+}
+
+void PixelDither::Reset() {
+	memset(s_Residual, 0, sizeof(s_Residual));
+}
+
+void PixelDither::Print() {
+	puts("Pixel dithering");
+
+	for (uint32_t nPortIndex = 0; nPortIndex < pixel::dither::MAX_PORTS; nPortIndex++) {
+		const auto& wb = s_nWhiteBalance[nPortIndex];
+		if ((wb[0] != 0x100) || (wb[1] != 0x100) || (wb[2] != 0x100) || (wb[3] != 0x100)) {
+			printf(" Port %c white balance %u:%u:%u:%u\n", 'A' + nPortIndex, wb[0], wb[1], wb[2], wb[3]);
+		}
+	}
+}
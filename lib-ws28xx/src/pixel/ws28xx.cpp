@@ -150,3 +150,33 @@ void WS28xx::SetPixel(uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_
 	SetColorWS28xx(nOffset + 16, nBlue);
 	SetColorWS28xx(nOffset + 24, nWhite);
 }
+
+void WS28xx::SetPixel16(uint32_t nPixelIndex, uint16_t nRed, uint16_t nGreen, uint16_t nBlue) {
+	assert(nPixelIndex < PixelConfiguration::Get().GetCount());
+	assert(PixelConfiguration::Get().GetType() == pixel::Type::UCS8903);
+
+	const auto nOffset = nPixelIndex * 48U;
+
+	SetColorWS28xx(nOffset, static_cast<uint8_t>(nRed >> 8));
+	SetColorWS28xx(nOffset + 8, static_cast<uint8_t>(nRed));
+	SetColorWS28xx(nOffset + 16, static_cast<uint8_t>(nGreen >> 8));
+	SetColorWS28xx(nOffset + 24, static_cast<uint8_t>(nGreen));
+	SetColorWS28xx(nOffset + 32, static_cast<uint8_t>(nBlue >> 8));
+	SetColorWS28xx(nOffset + 40, static_cast<uint8_t>(nBlue));
+}
+
+void WS28xx::SetPixel16(uint32_t nPixelIndex, uint16_t nRed, uint16_t nGreen, uint16_t nBlue, uint16_t nWhite) {
+	assert(nPixelIndex < PixelConfiguration::Get().GetCount());
+	assert(PixelConfiguration::Get().GetType() == pixel::Type::UCS8904);
+
+	const auto nOffset = nPixelIndex * 64U;
+
+	SetColorWS28xx(nOffset, static_cast<uint8_t>(nRed >> 8));
+	SetColorWS28xx(nOffset + 8, static_cast<uint8_t>(nRed));
+	SetColorWS28xx(nOffset + 16, static_cast<uint8_t>(nGreen >> 8));
+	SetColorWS28xx(nOffset + 24, static_cast<uint8_t>(nGreen));
+	SetColorWS28xx(nOffset + 32, static_cast<uint8_t>(nBlue >> 8));
+	SetColorWS28xx(nOffset + 40, static_cast<uint8_t>(nBlue));
+	SetColorWS28xx(nOffset + 48, static_cast<uint8_t>(nWhite >> 8));
+	SetColorWS28xx(nOffset + 56, static_cast<uint8_t>(nWhite));
+}
@@ -44,7 +44,8 @@ const char TYPES[static_cast<uint32_t>(pixel::Type::UNDEFINED)][pixel::TYPES_MAX
 		  "CS8812",																	// 1
 		  "APA102\0", "SK9822\0",													// 2
 		  "P9813",																	// 1
-		};																			// = 14
+		  "UCS8903", "UCS8904"														// 2
+		};																			// = 16
 
 const char MAPS[static_cast<uint32_t>(pixel::Map::UNDEFINED)][4] = { "RGB", "RBG", "GRB", "GBR", "BRG", "BGR"};
 
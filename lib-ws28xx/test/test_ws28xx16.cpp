@@ -0,0 +1,188 @@
+/**
+ * @file test_ws28xx16.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "ws28xx.h"
+#include "pixelconfiguration.h"
+#include "pixeltype.h"
+
+static int s_nFailed;
+
+#define CHECK(x)	do { if (!(x)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #x); s_nFailed++; } } while (0)
+
+/*
+ * The platform part of WS28xx is a test double.
+ * The buffer has the SPI layout: a leading 0 byte, then one code byte per bit.
+ */
+static constexpr uint32_t BUFFER_SIZE = (pixel::max::ledcount::RGB16 * pixel::single::RGB16) > (pixel::max::ledcount::RGBW16 * pixel::single::RGBW16) ?
+		(pixel::max::ledcount::RGB16 * pixel::single::RGB16) : (pixel::max::ledcount::RGBW16 * pixel::single::RGBW16);
+static uint8_t s_Buffer[1 + BUFFER_SIZE];
+
+WS28xx *WS28xx::s_pThis;
+
+WS28xx::WS28xx() {
+	s_pThis = this;
+	m_nBufSize = sizeof(s_Buffer);
+	m_pBuffer = s_Buffer;
+	memset(s_Buffer, 0, sizeof(s_Buffer));
+}
+
+WS28xx::~WS28xx() {
+	s_pThis = nullptr;
+}
+
+/*
+ * Decode the codes of nBits bits starting at bit nBitOffset, MSB first
+ */
+static uint64_t decode(const uint32_t nBitOffset, const uint32_t nBits, const uint8_t nLowCode, const uint8_t nHighCode, bool& isValid) {
+	uint64_t nValue = 0;
+	isValid = true;
+
+	for (uint32_t i = 0; i < nBits; i++) {
+		const auto nCode = s_Buffer[1 + nBitOffset + i];
+		nValue = (nValue << 1) | (nCode == nHighCode ? 1U : 0U);
+		isValid = isValid && ((nCode == nHighCode) || (nCode == nLowCode));
+	}
+
+	return nValue;
+}
+
+static void test_configuration() {
+	auto& pixelConfiguration = PixelConfiguration::Get();
+
+	pixelConfiguration.SetType(pixel::Type::UCS8903);
+	pixelConfiguration.SetCount(1000);
+	pixelConfiguration.Validate();
+
+	CHECK(pixelConfiguration.Is16Bit());
+	CHECK(pixelConfiguration.IsRTZProtocol());
+	CHECK(pixelConfiguration.GetLedsPerPixel() == 3);
+	CHECK(pixelConfiguration.GetChannelsPerPixel() == 6);
+	CHECK(pixelConfiguration.GetCount() == pixel::max::ledcount::RGB16);
+	CHECK(pixelConfiguration.GetMap() == pixel::Map::RGB);
+
+	pixelConfiguration.SetType(pixel::Type::UCS8904);
+	pixelConfiguration.SetCount(1000);
+	pixelConfiguration.Validate();
+
+	CHECK(pixelConfiguration.Is16Bit());
+	CHECK(pixelConfiguration.GetLedsPerPixel() == 4);
+	CHECK(pixelConfiguration.GetChannelsPerPixel() == 8);
+	CHECK(pixelConfiguration.GetCount() == pixel::max::ledcount::RGBW16);
+
+	pixelConfiguration.SetType(pixel::Type::WS2812B);
+	pixelConfiguration.SetCount(170);
+	pixelConfiguration.Validate();
+
+	CHECK(!pixelConfiguration.Is16Bit());
+	CHECK(pixelConfiguration.GetChannelsPerPixel() == 3);
+}
+
+static void test_ucs8903(WS28xx& ws28xx) {
+	auto& pixelConfiguration = PixelConfiguration::Get();
+
+	pixelConfiguration.SetType(pixel::Type::UCS8903);
+	pixelConfiguration.SetCount(pixel::max::ledcount::RGB16);
+	pixelConfiguration.Validate();
+
+	const auto nLowCode = pixelConfiguration.GetLowCode();
+	const auto nHighCode = pixelConfiguration.GetHighCode();
+	CHECK(nLowCode != nHighCode);
+
+	const uint32_t nPixels[] = { 0, 1, 2, pixel::max::ledcount::RGB16 - 1 };
+
+	for (const auto nPixel : nPixels) {
+		const uint16_t nRed = static_cast<uint16_t>(0x8001 ^ nPixel);
+		const uint16_t nGreen = static_cast<uint16_t>(0x1234 + nPixel);
+		const uint16_t nBlue = static_cast<uint16_t>(0xFFFE - nPixel);
+
+		ws28xx.SetPixel16(nPixel, nRed, nGreen, nBlue);
+
+		bool isValid;
+		const auto nFrame = decode(nPixel * pixel::single::RGB16, pixel::single::RGB16, nLowCode, nHighCode, isValid);
+
+		CHECK(isValid);
+		CHECK(nFrame == ((static_cast<uint64_t>(nRed) << 32) | (static_cast<uint64_t>(nGreen) << 16) | nBlue));
+	}
+
+	// The neighbours are not touched
+	ws28xx.SetPixel16(1, 0xFFFF, 0xFFFF, 0xFFFF);
+	ws28xx.SetPixel16(0, 0, 0, 0);
+	ws28xx.SetPixel16(2, 0, 0, 0);
+
+	bool isValid;
+	CHECK(decode(pixel::single::RGB16, pixel::single::RGB16, nLowCode, nHighCode, isValid) == 0xFFFFFFFFFFFF);
+	CHECK(decode(0, pixel::single::RGB16, nLowCode, nHighCode, isValid) == 0);
+	CHECK(decode(2 * pixel::single::RGB16, pixel::single::RGB16, nLowCode, nHighCode, isValid) == 0);
+}
+
+static void test_ucs8904(WS28xx& ws28xx) {
+	auto& pixelConfiguration = PixelConfiguration::Get();
+
+	pixelConfiguration.SetType(pixel::Type::UCS8904);
+	pixelConfiguration.SetCount(pixel::max::ledcount::RGBW16);
+	pixelConfiguration.Validate();
+
+	const auto nLowCode = pixelConfiguration.GetLowCode();
+	const auto nHighCode = pixelConfiguration.GetHighCode();
+
+	const uint32_t nPixels[] = { 0, 1, pixel::max::ledcount::RGBW16 - 1 };
+
+	for (const auto nPixel : nPixels) {
+		const uint16_t nRed = static_cast<uint16_t>(0xA5A5 + nPixel);
+		const uint16_t nGreen = static_cast<uint16_t>(0x0F0F ^ nPixel);
+		const uint16_t nBlue = 0x0001;
+		const uint16_t nWhite = 0x8000;
+
+		ws28xx.SetPixel16(nPixel, nRed, nGreen, nBlue, nWhite);
+
+		bool isValid;
+		const auto nFrame = decode(nPixel * pixel::single::RGBW16, pixel::single::RGBW16, nLowCode, nHighCode, isValid);
+
+		CHECK(isValid);
+		CHECK(nFrame == ((static_cast<uint64_t>(nRed) << 48) | (static_cast<uint64_t>(nGreen) << 32) | (static_cast<uint64_t>(nBlue) << 16) | nWhite));
+	}
+}
+
+int main() {
+	PixelConfiguration pixelConfiguration;
+	WS28xx ws28xx;
+
+	test_configuration();
+	test_ucs8903(ws28xx);
+	test_ucs8904(ws28xx);
+
+	if (s_nFailed != 0) {
+		printf("%d failed\n", s_nFailed);
+		return EXIT_FAILURE;
+	}
+
+	puts("ws28xx16: passed");
+	return EXIT_SUCCESS;
+}
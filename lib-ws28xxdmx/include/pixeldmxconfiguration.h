@@ -42,10 +42,22 @@
 #include "debug.h"
 
 namespace pixeldmxconfiguration {
+#if !defined (CONFIG_PIXELDMX_MAX_PORTS)
+# define CONFIG_PIXELDMX_MAX_PORTS	8U
+#endif
+static constexpr uint32_t MAX_PORTS = CONFIG_PIXELDMX_MAX_PORTS;
+
 struct PortInfo {
 	uint16_t nBeginIndexPort[4];
 	uint16_t nProtocolPortIndexLast;
 };
+
+struct OutputPort {
+	uint16_t nCount;
+	uint16_t nGroupingCount;
+	uint16_t nGroups;
+	pixel::Map map;
+};
 }  // namespace pixeldmxconfiguration
 
 class PixelDmxConfiguration: public PixelConfiguration {
@@ -56,6 +68,10 @@ public:
     	assert(s_pThis == nullptr);
     	s_pThis = this;
 
+    	for (auto& map : m_mapPort) {
+    		map = pixel::Map::UNDEFINED;
+    	}
+
     	DEBUG_EXIT
 	}
 
@@ -79,6 +95,27 @@ public:
 		return m_nGroups;
 	}
 
+	/**
+	 * Output port pixel count and colour order. 0 and pixel::Map::UNDEFINED are the defaults for all outputs.
+	 * The pixel type is the same for all outputs, as all outputs are clocked out in parallel.
+	 */
+	void SetCountPort(const uint32_t nPortIndex, const uint16_t nCount) {
+		if (nPortIndex < pixeldmxconfiguration::MAX_PORTS) {
+			m_nCountPort[nPortIndex] = nCount;
+		}
+	}
+
+	void SetMapPort(const uint32_t nPortIndex, const pixel::Map map) {
+		if (nPortIndex < pixeldmxconfiguration::MAX_PORTS) {
+			m_mapPort[nPortIndex] = map;
+		}
+	}
+
+	const pixeldmxconfiguration::OutputPort& GetOutputPort(const uint32_t nPortIndex) const {
+		assert(nPortIndex < pixeldmxconfiguration::MAX_PORTS);
+		return m_outputPort[nPortIndex];
+	}
+
 	uint32_t GetUniverses() const {
 		return m_nUniverses;
 	}
@@ -99,9 +136,24 @@ public:
 		return m_nDmxFootprint;
 	}
 
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	/**
+	 * Output blended frames in between the received frames.
+	 */
+	void SetEnableInterpolation(const bool bEnableInterpolation) {
+		m_bEnableInterpolation = bEnableInterpolation;
+	}
+
+	bool IsEnableInterpolation() const {
+		return m_bEnableInterpolation;
+	}
+#endif
+
 	void Validate(const uint32_t nPortsMax) {
 		DEBUG_ENTRY
 
+		m_nOutputPorts = std::min(nPortsMax, m_nOutputPorts);
+
 		PixelConfiguration::Validate();
 
 		if (!PixelConfiguration::IsRTZProtocol()) {
@@ -112,26 +164,71 @@ public:
 			PixelConfiguration::Validate();
 		}
 
+		/**
+		 * RGB -> 170, RGBW -> 128, RGB 16-bit -> 85, RGBW 16-bit -> 64 pixels per universe
+		 */
+		const auto nPixelsPerUniverse = static_cast<uint16_t>(512U / PixelConfiguration::GetChannelsPerPixel());
+
 		m_portInfo.nBeginIndexPort[0] = 0;
+		m_portInfo.nBeginIndexPort[1] = nPixelsPerUniverse;
+		m_portInfo.nBeginIndexPort[2] = static_cast<uint16_t>(2U * nPixelsPerUniverse);
+		m_portInfo.nBeginIndexPort[3] = static_cast<uint16_t>(3U * nPixelsPerUniverse);
+
+		/**
+		 * An output port has at most 4 universes, a port pixel count is clamped to what they carry.
+		 * The DMA transfer length is set by the longest active output.
+		 */
+		const auto nCountDefault = PixelConfiguration::GetCount();
+		const auto nCountPortMax = static_cast<uint32_t>(sizeof(m_portInfo.nBeginIndexPort) / sizeof(m_portInfo.nBeginIndexPort[0])) * nPixelsPerUniverse;
+		uint32_t nCountMax = 0;
+
+		for (uint32_t nPortIndex = 0; nPortIndex < pixeldmxconfiguration::MAX_PORTS; nPortIndex++) {
+			if (m_nCountPort[nPortIndex] > nCountPortMax) {
+				DEBUG_PRINTF("Port %u: %u -> %u", nPortIndex + 1, m_nCountPort[nPortIndex], nCountPortMax);
+				m_nCountPort[nPortIndex] = static_cast<uint16_t>(nCountPortMax);
+			}
 
-		if (PixelConfiguration::GetType() == pixel::Type::SK6812W) {
-			m_portInfo.nBeginIndexPort[1] = 128;
-			m_portInfo.nBeginIndexPort[2] = 256;
-			m_portInfo.nBeginIndexPort[3] = 384;
-		} else {
-			m_portInfo.nBeginIndexPort[1] = 170;
-			m_portInfo.nBeginIndexPort[2] = 340;
-			m_portInfo.nBeginIndexPort[3] = 510;
+			if (nPortIndex < m_nOutputPorts) {
+				const auto nCount = (m_nCountPort[nPortIndex] == 0) ? nCountDefault : m_nCountPort[nPortIndex];
+				nCountMax = std::max(nCountMax, nCount);
+			}
+		}
+
+		if ((nCountMax != 0) && (nCountMax != nCountDefault)) {
+			PixelConfiguration::SetCount(nCountMax);
+			PixelConfiguration::Validate();
 		}
 
 		if ((m_nGroupingCount == 0) || (m_nGroupingCount > PixelConfiguration::GetCount())) {
 			m_nGroupingCount = PixelConfiguration::GetCount();
 		}
 
-		m_nGroups = PixelConfiguration::GetCount() / m_nGroupingCount;
-		m_nOutputPorts = std::min(nPortsMax, m_nOutputPorts);
+		m_nGroups = 0;
+
+		for (uint32_t nPortIndex = 0; nPortIndex < pixeldmxconfiguration::MAX_PORTS; nPortIndex++) {
+			auto& outputPort = m_outputPort[nPortIndex];
+
+			const auto nCount = (m_nCountPort[nPortIndex] == 0) ? nCountDefault : m_nCountPort[nPortIndex];
+
+			outputPort.nCount = static_cast<uint16_t>(std::min(nCount, PixelConfiguration::GetCount()));
+			outputPort.nGroupingCount = static_cast<uint16_t>(std::min(m_nGroupingCount, static_cast<uint32_t>(outputPort.nCount)));
+			outputPort.nGroups = static_cast<uint16_t>((outputPort.nGroupingCount == 0) ? 0 : (outputPort.nCount / outputPort.nGroupingCount));
+			outputPort.map = (m_mapPort[nPortIndex] == pixel::Map::UNDEFINED) ? PixelConfiguration::GetMap() : m_mapPort[nPortIndex];
+
+			if (nPortIndex < m_nOutputPorts) {
+				m_nGroups = std::max(m_nGroups, static_cast<uint32_t>(outputPort.nGroups));
+			}
+		}
+
 		m_nUniverses = (1U + (m_nGroups  / (1U + m_portInfo.nBeginIndexPort[1])));
-		m_nDmxFootprint = PixelConfiguration::GetLedsPerPixel() * m_nGroups;
+		m_nDmxFootprint = PixelConfiguration::GetChannelsPerPixel() * m_nGroups;
+
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+		// The coarse and fine slots cannot be blended independently
+		if (PixelConfiguration::Is16Bit()) {
+			m_bEnableInterpolation = false;
+		}
+#endif
 
 		if (nPortsMax == 1) {
 			m_portInfo.nProtocolPortIndexLast = static_cast<uint16_t>(m_nGroups / (1U + m_portInfo.nBeginIndexPort[1]));
@@ -154,6 +251,16 @@ public:
 		printf(" Universes      : %u\n", m_nUniverses);
 		printf(" DmxFootprint   : %u\n", m_nDmxFootprint);
 
+		for (uint32_t nPortIndex = 0; nPortIndex < std::min(m_nOutputPorts, pixeldmxconfiguration::MAX_PORTS); nPortIndex++) {
+			if ((m_nCountPort[nPortIndex] != 0) || (m_mapPort[nPortIndex] != pixel::Map::UNDEFINED)) {
+				const auto& outputPort = m_outputPort[nPortIndex];
+				printf(" Port %-2u        : %u %s [Groups : %u]\n", nPortIndex + 1, outputPort.nCount, pixel::pixel_get_map(outputPort.map), outputPort.nGroups);
+			}
+		}
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+		printf(" Interpolation  : %s\n", m_bEnableInterpolation ? "Yes" : "No");
+#endif
+
 #ifndef NDEBUG
 		const auto& beginIndexPort = m_portInfo.nBeginIndexPort;
 		printf(" %u:%u:%u:%u -> %u\n", beginIndexPort[0], beginIndexPort[1], beginIndexPort[2], beginIndexPort[3], m_portInfo.nProtocolPortIndexLast);
@@ -173,6 +280,12 @@ private:
 	uint32_t m_nDmxStartAddress { 1 };
 	uint32_t m_nDmxFootprint { 0 };
 	pixeldmxconfiguration::PortInfo m_portInfo;
+	uint16_t m_nCountPort[pixeldmxconfiguration::MAX_PORTS] {};
+	pixel::Map m_mapPort[pixeldmxconfiguration::MAX_PORTS];
+	pixeldmxconfiguration::OutputPort m_outputPort[pixeldmxconfiguration::MAX_PORTS];
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	bool m_bEnableInterpolation { false };
+#endif
 
 	static inline PixelDmxConfiguration *s_pThis { nullptr };
 };
@@ -53,10 +53,24 @@ struct Params {
 	uint8_t nLowCode;										///< 1	  21
 	uint8_t nHighCode;										///< 1	  22
 	uint16_t nStartUniverse[pixeldmxparams::MAX_PORTS];		///< 16   38
+	uint8_t nWhiteBalance[3];								///< 3    41
+	uint8_t nMaxFps;										///< 1    42	0 = no limit
 }__attribute__((packed));
 
 static_assert(sizeof(struct Params) <= 64, "struct Params is too large");
 
+/**
+ * Per output port pixel count and colour order, in a store of their own
+ * so that the 16 ports layout of Params still fits.
+ */
+struct PortParams {
+    uint32_t nSetList;										///< 4	   4
+	uint16_t nCount[pixeldmxparams::MAX_PORTS];				///< 32   36
+	uint8_t nMap[pixeldmxparams::MAX_PORTS];				///< 16   52
+}__attribute__((packed));
+
+static_assert(sizeof(struct PortParams) <= 64, "struct PortParams is too large");
+
 struct Mask {
 	static constexpr auto TYPE = (1U << 0);
 	static constexpr auto COUNT = (1U << 1);
@@ -71,7 +85,20 @@ struct Mask {
 	static constexpr auto LOW_CODE = (1U << 10);
 	static constexpr auto HIGH_CODE = (1U << 11);
 	static constexpr auto START_UNI_PORT_1 = (1U << 12);
+	static constexpr auto DITHERING = (1U << 28);
+	static constexpr auto WHITE_BALANCE = (1U << 29);
+	static constexpr auto INTERPOLATION = (1U << 30);
+	static constexpr auto MAX_FPS = (1U << 31);
 };
+
+static_assert((12 + MAX_PORTS) <= 28, "START_UNI_PORT overlaps");
+
+struct PortMask {
+	static constexpr auto COUNT_PORT_1 = (1U << 0);
+	static constexpr auto MAP_PORT_1 = (1U << 16);
+};
+
+static_assert(MAX_PORTS <= 16, "COUNT_PORT overlaps");
 }  // pixeldmxparams
 
 class PixelDmxParamsStore {
@@ -83,6 +110,14 @@ public:
 	static void Copy(struct pixeldmxparams::Params *pParams) {
 		ConfigStore::Get()->Copy(configstore::Store::WS28XXDMX, pParams, sizeof(struct pixeldmxparams::Params));
 	}
+
+	static void Update(const struct pixeldmxparams::PortParams *pParams) {
+		ConfigStore::Get()->Update(configstore::Store::WS28XXDMX_PORTS, pParams, sizeof(struct pixeldmxparams::PortParams));
+	}
+
+	static void Copy(struct pixeldmxparams::PortParams *pParams) {
+		ConfigStore::Get()->Copy(configstore::Store::WS28XXDMX_PORTS, pParams, sizeof(struct pixeldmxparams::PortParams));
+	}
 };
 
 class PixelDmxParams {
@@ -123,8 +158,24 @@ private:
     	return (m_Params.nSetList & nMask) == nMask;
     }
 
+	bool isPortMaskSet(uint32_t nMask) const {
+		return (m_PortParams.nSetList & nMask) == nMask;
+	}
+
+	uint16_t GetCountPort(const uint32_t nPortIndex) const {
+		return isPortMaskSet(pixeldmxparams::PortMask::COUNT_PORT_1 << nPortIndex) ? m_PortParams.nCount[nPortIndex] : 0;
+	}
+
+	pixel::Map GetMapPort(const uint32_t nPortIndex) const {
+		if (isPortMaskSet(pixeldmxparams::PortMask::MAP_PORT_1 << nPortIndex) && (m_PortParams.nMap[nPortIndex] < static_cast<uint8_t>(pixel::Map::UNDEFINED))) {
+			return static_cast<pixel::Map>(m_PortParams.nMap[nPortIndex]);
+		}
+		return pixel::Map::UNDEFINED;
+	}
+
 private:
     pixeldmxparams::Params m_Params;
+    pixeldmxparams::PortParams m_PortParams;
 };
 
 #endif /* PIXELDMXPARAMS_H_ */
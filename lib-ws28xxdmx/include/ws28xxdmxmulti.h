@@ -36,6 +36,9 @@
 
 #include "pixeldmxconfiguration.h"
 #include "pixelpatterns.h"
+#include "pixelstatistics.h"
+
+#include "hardware.h"
 
 #include "logic_analyzer.h"
 
@@ -57,6 +60,15 @@ public:
 	void SetData(const uint32_t nPortIndex, [[maybe_unused]] const uint8_t *pData, [[maybe_unused]] uint32_t nLength, const bool doUpdate) override {
 		logic_analyzer::ch0_set();
 
+		uint32_t nOutIndex;
+		uint32_t nSwitch;
+
+		GetOutIndex(nPortIndex, nOutIndex, nSwitch);
+
+		if (nSwitch == 0) {
+			PixelStatistics::FrameReceived(nOutIndex);
+		}
+
 		if (!doUpdate) {
 			logic_analyzer::ch0_clear();
 			return;
@@ -68,12 +80,31 @@ public:
 		if (nPortIndex == portInfo.nProtocolPortIndexLast) {
 			logic_analyzer::ch1_set();
 
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+			if (m_bInterpolation) {
+				InterpolationStart();
+
+				logic_analyzer::ch1_clear();
+				logic_analyzer::ch0_clear();
+				return;
+			}
+#endif
+
+			const auto nMicros = Hardware::Get()->Micros();
+
 			for (uint32_t nIndex = 0 ; nIndex <= portInfo.nProtocolPortIndexLast;nIndex++) {
 				logic_analyzer::ch2_set();
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+				if (m_bDithering) {
+					SetData(nIndex, Latch(nIndex), m_nLength[nIndex]);
+				} else
+#endif
 				SetData(nIndex, lightset::Data::Backup(nIndex), lightset::Data::GetLength(nIndex));
 				logic_analyzer::ch2_clear();
 			}
 
+			PixelStatistics::FrameEncoded(Hardware::Get()->Micros() - nMicros);
+
 #if defined (H3)
 			logic_analyzer::ch3_set();
 
@@ -84,7 +115,7 @@ public:
 			logic_analyzer::ch3_clear();
 #endif
 
-			m_pWS28xxMulti->Update();
+			Output(nMicros);
 
 			logic_analyzer::ch1_clear();
 		}
@@ -93,8 +124,18 @@ public:
 	}
 
 	void Sync(const uint32_t nPortIndex) override {
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+		if (m_bInterpolation) {
+			return;
+		}
+#endif
 		logic_analyzer::ch2_set();
 
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+		if (m_bDithering) {
+			SetData(nPortIndex, Latch(nPortIndex), m_nLength[nPortIndex]);
+		} else
+#endif
 		SetData(nPortIndex, lightset::Data::Backup(nPortIndex), lightset::Data::GetLength(nPortIndex));
 
 		logic_analyzer::ch2_clear();
@@ -102,6 +143,15 @@ public:
 
 	void Sync() override {
 		logic_analyzer::ch1_set();
+
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+		if (m_bInterpolation) {
+			InterpolationStart();
+
+			logic_analyzer::ch1_clear();
+			return;
+		}
+#endif
 		logic_analyzer::ch3_set();
 
 		while (m_pWS28xxMulti->IsUpdating()) {
@@ -110,7 +160,7 @@ public:
 
 		logic_analyzer::ch3_clear();
 
-		m_pWS28xxMulti->Update();
+		Output(Hardware::Get()->Micros());
 
 		logic_analyzer::ch1_clear();
 	}
@@ -122,6 +172,47 @@ public:
 	}
 #endif
 
+	/**
+	 * Outputs the frame held back by a running DMA transfer or by the maximum frame rate.
+	 * With dithering enabled, the output is refreshed from the last complete frame as fast as the pixels allow.
+	 * With interpolation enabled, the blended frames are output in between the received frames.
+	 */
+	void Run() {
+		PixelStatistics::Run();
+
+		if (m_bBlackout || (m_bIsStarted == 0) || m_pWS28xxMulti->IsUpdating()) {
+			return;
+		}
+
+		if (m_bOutputPending) {
+			OutputPending();
+			return;
+		}
+
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING) || defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+		const auto nMicros = Hardware::Get()->Micros();
+
+		if (!IsOutputAllowed(nMicros)) {
+			return;
+		}
+# if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+		if (m_bInterpolation) {
+			InterpolationRun();
+			return;
+		}
+# endif
+# if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+		if (m_bDithering) {
+			Refresh(nMicros);
+		}
+# endif
+#endif
+	}
+
+	uint32_t GetRefreshRate() override {
+		return PixelDmxConfiguration::Get().GetRefreshRate();
+	}
+
 	void Blackout(bool bBlackout) override;
 	void FullOn() override;
 
@@ -143,13 +234,62 @@ public:
 	}
 
 private:
+	void GetOutIndex(const uint32_t nPortIndex, uint32_t& nOutIndex, uint32_t& nSwitch) const {
+#if defined (NODE_DDP_DISPLAY)
+		nOutIndex = (nPortIndex / 4);
+		nSwitch = nPortIndex - (nOutIndex * 4);
+#else
+		const auto nUniverses = PixelDmxConfiguration::Get().GetUniverses();
+		nOutIndex = (nPortIndex / nUniverses);
+		nSwitch = nPortIndex - (nOutIndex * nUniverses);
+#endif
+	}
+
+	bool IsOutputAllowed(const uint32_t nMicros) const {
+		return (m_nOutputIntervalMicros == 0) || ((nMicros - m_nOutputMicros) >= m_nOutputIntervalMicros);
+	}
+
+	void Output(const uint32_t nMicrosReceived);
+	void OutputPending();
 	void SetData(const uint32_t nPortIndex, const uint8_t *pData, uint32_t nLength);
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING) || defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	const uint8_t *Latch(const uint32_t nPortIndex);
+	void Refresh(const uint32_t nMicros);
+#endif
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+	void SetDataDither(const uint32_t nOutIndex, const uint8_t *pData, const uint32_t nLength, const uint32_t beginIndex, const uint32_t endIndex);
+#endif
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	void InterpolationStart();
+	void InterpolationRun();
+	void InterpolationOutput(const uint32_t nMicros);
+#endif
 
 private:
 	WS28xxMulti *m_pWS28xxMulti { nullptr };
 
 	uint32_t m_bIsStarted { 0 };
+	uint32_t m_nOutputIntervalMicros { 0 };
+	uint32_t m_nOutputMicros { 0 };
+	uint32_t m_nOutputPendingMicros { 0 };
+	bool m_bOutputPending { false };
 	bool m_bBlackout { false };
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+	bool m_bDithering { false };
+#endif
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	bool m_bInterpolation { false };
+	struct {
+		uint32_t nStartMicros;
+		uint32_t nStepMicros;
+		uint32_t nIntervalMicros;
+		bool bActive;
+		bool bNewFrame;
+	} m_Interpolation;
+#endif
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING) || defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	uint16_t m_nLength[ws28xxdmxmulti::MAX_PORTS * 4];
+#endif
 };
 
 #endif /* WS28XXDMXMULTI_H_ */
@@ -128,7 +128,7 @@ void WS28xxDmx::SetData([[maybe_unused]] uint32_t nPortIndex, const uint8_t *pDa
 #else
 	const auto beginIndex = portInfo.nBeginIndexPort[nSwitch];
 #endif
-	const auto nChannelsPerPixel = pixelDmxConfiguration.GetLedsPerPixel();
+	const auto nChannelsPerPixel = pixelDmxConfiguration.GetChannelsPerPixel();
 	const auto endIndex = std::min(nGroups, (beginIndex + (nLength / nChannelsPerPixel)));
 
 	if ((nSwitch == 0) && (nGroups < portInfo.nBeginIndexPort[1])) {
@@ -137,7 +137,48 @@ void WS28xxDmx::SetData([[maybe_unused]] uint32_t nPortIndex, const uint8_t *pDa
 
 	const auto nGroupingCount = pixelDmxConfiguration.GetGroupingCount();
 
-	if (nChannelsPerPixel == 3) {
+	if (pixelDmxConfiguration.Is16Bit()) {
+		// Coarse/fine, big endian
+		auto value16 = [&](const uint32_t nOffset) {
+			return static_cast<uint16_t>((pData[nOffset] << 8) | pData[nOffset + 1]);
+		};
+
+		if (nChannelsPerPixel == 6) {
+			// Same channel order as WS28xxDmxMulti
+			constexpr uint32_t channelMap[6][3] = {
+			    {0, 2, 4}, // RGB
+			    {0, 4, 2}, // RBG
+			    {2, 0, 4}, // GRB
+			    {4, 0, 2}, // GBR
+			    {2, 4, 0}, // BRG
+			    {4, 2, 0}  // BGR
+			};
+
+			const auto mapIndex = static_cast<uint32_t>(pixelDmxConfiguration.GetMap());
+			assert(mapIndex < sizeof(channelMap) / sizeof(channelMap[0]));
+			auto const& map = channelMap[mapIndex];
+
+			for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
+				auto const nPixelIndexStart = (j * nGroupingCount);
+				const auto nColour1 = value16(d + map[0]);
+				const auto nColour2 = value16(d + map[1]);
+				const auto nColour3 = value16(d + map[2]);
+				for (uint32_t k = 0; k < nGroupingCount; k++) {
+					m_pWS28xx->SetPixel16(nPixelIndexStart + k, nColour1, nColour2, nColour3);
+				}
+				d = d + 6;
+			}
+		} else {
+			assert(nChannelsPerPixel == 8);
+			for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
+				auto const nPixelIndexStart = (j * nGroupingCount);
+				for (uint32_t k = 0; k < nGroupingCount; k++) {
+					m_pWS28xx->SetPixel16(nPixelIndexStart + k, value16(d), value16(d + 2), value16(d + 4), value16(d + 6));
+				}
+				d = d + 8;
+			}
+		}
+	} else if (nChannelsPerPixel == 3) {
 		switch (pixelDmxConfiguration.GetMap()) {
 		case pixel::Map::RGB:
 			for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
@@ -276,9 +317,21 @@ bool WS28xxDmx::GetSlotInfo(uint16_t nSlotOffset, lightset::SlotInfo& slotInfo)
 		return false;
 	}
 
+	auto nLedOffset = nSlotOffset;
+
+	if (pixelDmxConfiguration.Is16Bit()) {
+		if (nSlotOffset & 0x1) {
+			slotInfo.nType = 0x01;	// ST_SEC_FINE
+			slotInfo.nCategory = static_cast<uint16_t>(nSlotOffset - 1U);	// Slot Offset of the coarse slot
+			return true;
+		}
+
+		nLedOffset = static_cast<uint16_t>(nSlotOffset / 2U);
+	}
+
 	slotInfo.nType = 0x00;	// ST_PRIMARY
 
-	switch (nSlotOffset % pixelDmxConfiguration.GetLedsPerPixel()) {
+	switch (nLedOffset % pixelDmxConfiguration.GetLedsPerPixel()) {
 		case 0:
 			slotInfo.nCategory = 0x0205; // SD_COLOR_ADD_RED
 			break;
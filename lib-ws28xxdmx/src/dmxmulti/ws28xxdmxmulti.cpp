@@ -33,6 +33,7 @@
 #pragma GCC optimize ("-fprefetch-loop-arrays")
 
 #include <cstdint>
+#include <cstring>
 #include <algorithm>
 #include <cassert>
 
@@ -43,12 +44,50 @@
 #include "pixeldmxparams.h"
 #include "pixeldmxconfiguration.h"
 
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+# include "pixeldither.h"
+#endif
+
 #if defined (PIXELDMXSTARTSTOP_GPIO)
 # include "hal_gpio.h"
 #endif
 
 #include "debug.h"
 
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING) || defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+static constexpr uint32_t MAX_UNIVERSES = ws28xxdmxmulti::MAX_PORTS * 4;
+
+/**
+ * https://www.gd32-dmx.org/memory.html
+ */
+# if defined (GD32F20X) || defined (GD32F4XX)
+#  define SECTION_PIXELDMX		__attribute__ ((section (".pixel")))
+# else
+#  define SECTION_PIXELDMX
+# endif
+
+/**
+ * The last complete frame, copied when the last universe or the sync is received.
+ * The receive buffers already fill with the next frame, which must not be output.
+ */
+static uint8_t s_Latch[MAX_UNIVERSES][lightset::dmx::UNIVERSE_SIZE] SECTION_PIXELDMX;
+#endif
+
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+namespace interpolation {
+static constexpr uint32_t MIN_INTERVAL_US = 5000;
+/**
+ * Frames further apart are output without interpolation (below 10 fps)
+ */
+static constexpr uint32_t MAX_INTERVAL_US = 100000;
+}  // namespace interpolation
+
+/**
+ * The last output frame, this is the start of the next blend.
+ */
+static uint8_t s_Output[MAX_UNIVERSES][lightset::dmx::UNIVERSE_SIZE] SECTION_PIXELDMX;
+#endif
+
 WS28xxDmxMulti::WS28xxDmxMulti() {
 	DEBUG_ENTRY
 
@@ -58,6 +97,43 @@ WS28xxDmxMulti::WS28xxDmxMulti() {
 	assert(m_pWS28xxMulti != nullptr);
 	m_pWS28xxMulti->Blackout();
 
+	const auto nMaxFps = PixelDmxConfiguration::Get().GetMaxFps();
+
+	if (nMaxFps != 0) {
+		m_nOutputIntervalMicros = 1000000U / nMaxFps;
+	}
+
+	PixelStatistics::Reset();
+
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+	auto &pixelDmxConfiguration = PixelDmxConfiguration::Get();
+
+	m_bDithering = pixelDmxConfiguration.IsEnableDithering();
+
+	if (m_bDithering) {
+		const auto nWhiteBalance = pixelDmxConfiguration.GetWhiteBalance();
+		PixelDither::Init(pixelDmxConfiguration.GetType(), pixelDmxConfiguration.GetDitherGamma());
+		PixelDither::SetWhiteBalance(static_cast<uint8_t>(nWhiteBalance >> 16), static_cast<uint8_t>(nWhiteBalance >> 8), static_cast<uint8_t>(nWhiteBalance));
+	}
+
+#endif
+
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	m_bInterpolation = PixelDmxConfiguration::Get().IsEnableInterpolation();
+	m_Interpolation.nStartMicros = 0;
+	m_Interpolation.nStepMicros = 0;
+	m_Interpolation.nIntervalMicros = 0;
+	m_Interpolation.bActive = false;
+	m_Interpolation.bNewFrame = false;
+	memset(s_Output, 0, sizeof(s_Output));
+#endif
+
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING) || defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	for (auto& nLength : m_nLength) {
+		nLength = 0;
+	}
+#endif
+
 #if defined (PIXELDMXSTARTSTOP_GPIO)
 	FUNC_PREFIX(gpio_fsel(PIXELDMXSTARTSTOP_GPIO, GPIO_FSEL_OUTPUT));
 	FUNC_PREFIX(gpio_clr(PIXELDMXSTARTSTOP_GPIO));
@@ -103,28 +179,77 @@ void WS28xxDmxMulti::SetData(const uint32_t nPortIndex, const uint8_t* pData, ui
 
 	auto &pixelDmxConfiguration = PixelDmxConfiguration::Get();
 
-#if defined (NODE_DDP_DISPLAY)
-	const auto nOutIndex = (nPortIndex / 4);
-	const auto nSwitch = nPortIndex - (nOutIndex * 4);
-#else
-	const auto nUniverses = pixelDmxConfiguration.GetUniverses();
-	const auto nOutIndex = (nPortIndex / nUniverses);
-	const auto nSwitch = nPortIndex - (nOutIndex * nUniverses);
-#endif
+	uint32_t nOutIndex;
+	uint32_t nSwitch;
+
+	GetOutIndex(nPortIndex, nOutIndex, nSwitch);
 
 	auto &portInfo = pixelDmxConfiguration.GetPortInfo();
+	const auto& outputPort = pixelDmxConfiguration.GetOutputPort(nOutIndex);
 
-	const auto nGroups = pixelDmxConfiguration.GetGroups();
+	const auto nGroups = static_cast<uint32_t>(outputPort.nGroups);
 	const auto beginIndex = portInfo.nBeginIndexPort[nSwitch];
-	const auto nChannelsPerPixel = pixelDmxConfiguration.GetLedsPerPixel();
+	const auto nChannelsPerPixel = pixelDmxConfiguration.GetChannelsPerPixel();
 	const auto endIndex = std::min(nGroups, (beginIndex + (nLength / nChannelsPerPixel)));
-	const auto nGroupingCount = pixelDmxConfiguration.GetGroupingCount();
+	const auto nGroupingCount = static_cast<uint32_t>(outputPort.nGroupingCount);
 	const auto pixelType = pixelDmxConfiguration.GetType();
 	const auto isRTZProtocol = pixelDmxConfiguration.IsRTZProtocol();
 
 	uint32_t d = 0;
 
-	if (nChannelsPerPixel == 3) {
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+	if (m_bDithering) {
+		SetDataDither(nOutIndex, pData, nLength, beginIndex, endIndex);
+		return;
+	}
+#endif
+
+	if (pixelDmxConfiguration.Is16Bit()) {
+		assert(isRTZProtocol);
+		// Coarse/fine, big endian
+		auto value16 = [&](const uint32_t nOffset) {
+			return static_cast<uint16_t>((pData[nOffset] << 8) | pData[nOffset + 1]);
+		};
+
+		if (nChannelsPerPixel == 6) {
+			constexpr uint32_t channelMap[6][3] = {
+			    {0, 2, 4}, // RGB
+			    {0, 4, 2}, // RBG
+			    {2, 0, 4}, // GRB
+			    {4, 0, 2}, // GBR
+			    {2, 4, 0}, // BRG
+			    {4, 2, 0}  // BGR
+			};
+
+			const auto mapIndex = static_cast<uint32_t>(outputPort.map);
+			assert(mapIndex < sizeof(channelMap) / sizeof(channelMap[0]));
+			auto const& map = channelMap[mapIndex];
+
+			for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
+				auto const nPixelIndexStart = j * nGroupingCount;
+				const auto nColour1 = value16(d + map[0]);
+				const auto nColour2 = value16(d + map[1]);
+				const auto nColour3 = value16(d + map[2]);
+				for (uint32_t k = 0; k < nGroupingCount; k++) {
+					m_pWS28xxMulti->SetColourRTZ16(nOutIndex, nPixelIndexStart + k, nColour1, nColour2, nColour3);
+				}
+				d += 6;
+			}
+		} else {
+			assert(nChannelsPerPixel == 8);
+			for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
+				auto const nPixelIndexStart = j * nGroupingCount;
+				const auto nRed = value16(d);
+				const auto nGreen = value16(d + 2);
+				const auto nBlue = value16(d + 4);
+				const auto nWhite = value16(d + 6);
+				for (uint32_t k = 0; k < nGroupingCount; k++) {
+					m_pWS28xxMulti->SetColourRTZ16(nOutIndex, nPixelIndexStart + k, nRed, nGreen, nBlue, nWhite);
+				}
+				d += 8;
+			}
+		}
+	} else if (nChannelsPerPixel == 3) {
 		// Define a lambda to handle pixel setting based on color order
 		auto setPixelsColourRTZ = [&](const uint32_t nPortIndex, const uint32_t nPixelIndex, const uint32_t r, const uint32_t g, const uint32_t b) {
 #if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
@@ -174,7 +299,7 @@ void WS28xxDmxMulti::SetData(const uint32_t nPortIndex, const uint8_t* pData, ui
 		    {2, 1, 0}  // BGR
 		};
 
-		const auto mapIndex = static_cast<uint32_t>(pixelDmxConfiguration.GetMap());
+		const auto mapIndex = static_cast<uint32_t>(outputPort.map);
 		// Ensure mapIndex is within valid bounds
 		assert(mapIndex < sizeof(channelMap) / sizeof(channelMap[0]));  // Runtime check
 		auto const& map = channelMap[mapIndex];
@@ -209,8 +334,261 @@ void WS28xxDmxMulti::SetData(const uint32_t nPortIndex, const uint8_t* pData, ui
 	}
 }
 
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+void WS28xxDmxMulti::SetDataDither(const uint32_t nOutIndex, const uint8_t *pData, const uint32_t nLength, const uint32_t beginIndex, const uint32_t endIndex) {
+	auto &pixelDmxConfiguration = PixelDmxConfiguration::Get();
+
+	const auto& outputPort = pixelDmxConfiguration.GetOutputPort(nOutIndex);
+	const auto nChannelsPerPixel = pixelDmxConfiguration.GetChannelsPerPixel();
+	const auto nGroupingCount = static_cast<uint32_t>(outputPort.nGroupingCount);
+	const auto pixelType = pixelDmxConfiguration.GetType();
+	uint32_t d = 0;
+
+	if (nChannelsPerPixel == 4) {
+		assert(pixelDmxConfiguration.IsRTZProtocol());
+		for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
+			auto const nPixelIndexStart = (j * nGroupingCount);
+			for (uint32_t k = 0; k < nGroupingCount; k++) {
+				const auto nPixelIndex = nPixelIndexStart + k;
+				const auto nLedIndex = nPixelIndex * 4;
+				m_pWS28xxMulti->SetColourRTZ(nOutIndex, nPixelIndex,
+						PixelDither::Get(nOutIndex, nLedIndex, 0, pData[d]),
+						PixelDither::Get(nOutIndex, nLedIndex + 1, 1, pData[d + 1]),
+						PixelDither::Get(nOutIndex, nLedIndex + 2, 2, pData[d + 2]),
+						PixelDither::Get(nOutIndex, nLedIndex + 3, 3, pData[d + 3]));
+			}
+			d = d + 4;
+		}
+		return;
+	}
+
+	assert(nChannelsPerPixel == 3);
+
+	constexpr uint32_t channelMap[6][3] = {
+	    {0, 1, 2}, // RGB
+	    {0, 2, 1}, // RBG
+	    {1, 0, 2}, // GRB
+	    {2, 0, 1}, // GBR
+	    {1, 2, 0}, // BRG
+	    {2, 1, 0}  // BGR
+	};
+
+	const auto mapIndex = static_cast<uint32_t>(outputPort.map);
+	assert(mapIndex < sizeof(channelMap) / sizeof(channelMap[0]));
+	auto const& map = channelMap[mapIndex];
+
+	for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
+		auto const nPixelIndexStart = j * nGroupingCount;
+		for (uint32_t k = 0; k < nGroupingCount; k++) {
+			const auto nPixelIndex = nPixelIndexStart + k;
+			const auto nLedIndex = nPixelIndex * 3;
+			// The residual is kept in wire order, the white balance is in RGB order
+			const auto nColour1 = PixelDither::Get(nOutIndex, nLedIndex, map[0], pData[d + map[0]]);
+			const auto nColour2 = PixelDither::Get(nOutIndex, nLedIndex + 1, map[1], pData[d + map[1]]);
+			const auto nColour3 = PixelDither::Get(nOutIndex, nLedIndex + 2, map[2], pData[d + map[2]]);
+
+			switch (pixelType) {
+			case pixel::Type::WS2801:
+				m_pWS28xxMulti->SetColourWS2801(nOutIndex, nPixelIndex, nColour1, nColour2, nColour3);
+				break;
+			case pixel::Type::APA102:
+			case pixel::Type::SK9822:
+				m_pWS28xxMulti->SetPixel4Bytes(nOutIndex, 1 + nPixelIndex, pixelDmxConfiguration.GetGlobalBrightness(), nColour3, nColour2, nColour1);
+				break;
+			case pixel::Type::P9813: {
+				const auto nFlag = static_cast<uint8_t>(0xC0 | ((~nColour3 & 0xC0) >> 2) | ((~nColour1 & 0xC0) >> 4) | ((~nColour1 & 0xC0) >> 6));
+				m_pWS28xxMulti->SetPixel4Bytes(nOutIndex, 1 + nPixelIndex, nFlag, nColour3, nColour2, nColour1);
+			}
+				break;
+			default:
+				m_pWS28xxMulti->SetColourRTZ(nOutIndex, nPixelIndex, nColour1, nColour2, nColour3);
+				break;
+			}
+		}
+		d += 3;
+	}
+}
+#endif
+
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING) || defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+const uint8_t *WS28xxDmxMulti::Latch(const uint32_t nPortIndex) {
+	assert(nPortIndex < MAX_UNIVERSES);
+
+	const auto nLength = lightset::Data::GetLength(nPortIndex);
+
+	memcpy(s_Latch[nPortIndex], lightset::Data::Backup(nPortIndex), nLength);
+	m_nLength[nPortIndex] = static_cast<uint16_t>(nLength);
+
+	return s_Latch[nPortIndex];
+}
+
+/**
+ * Outputs the latched frame again, with a new dither pattern.
+ * This is not a received frame, so it is not counted as an output frame.
+ */
+void WS28xxDmxMulti::Refresh(const uint32_t nMicros) {
+	const auto nProtocolPortIndexLast = PixelDmxConfiguration::Get().GetPortInfo().nProtocolPortIndexLast;
+
+	for (uint32_t nIndex = 0 ; nIndex <= nProtocolPortIndexLast; nIndex++) {
+		SetData(nIndex, s_Latch[nIndex], m_nLength[nIndex]);
+	}
+
+	m_pWS28xxMulti->Update();
+	m_nOutputMicros = nMicros;
+
+	PixelStatistics::FrameRefreshed();
+}
+#endif
+
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+/**
+ * A new frame is received (or synchronized). It is latched, as the receive buffers fill with
+ * the next frame during the blend. The blend restarts from the last output frame
+ * towards the latched frame, spread over the measured frame interval.
+ */
+void WS28xxDmxMulti::InterpolationStart() {
+	const auto nMicros = Hardware::Get()->Micros();
+	const auto nInterval = nMicros - m_Interpolation.nStartMicros;
+	const auto nProtocolPortIndexLast = PixelDmxConfiguration::Get().GetPortInfo().nProtocolPortIndexLast;
+
+	assert(nProtocolPortIndexLast < MAX_UNIVERSES);
+
+	for (uint32_t nIndex = 0 ; nIndex <= nProtocolPortIndexLast; nIndex++) {
+		Latch(nIndex);
+	}
+
+	m_Interpolation.nStartMicros = nMicros;
+	m_Interpolation.nStepMicros = nMicros;
+	m_Interpolation.bNewFrame = true;
+
+	if (nInterval <= interpolation::MAX_INTERVAL_US) {
+		m_Interpolation.nIntervalMicros = std::max(nInterval, interpolation::MIN_INTERVAL_US);
+		m_Interpolation.bActive = true;
+		return;
+	}
+
+	m_Interpolation.bActive = false;
+
+	for (uint32_t nIndex = 0 ; nIndex <= nProtocolPortIndexLast; nIndex++) {
+		memcpy(s_Output[nIndex], s_Latch[nIndex], m_nLength[nIndex]);
+	}
+
+	InterpolationOutput(nMicros);
+}
+
+void WS28xxDmxMulti::InterpolationRun() {
+	if (!m_Interpolation.bActive) {
+#if defined (CONFIG_PIXELDMX_ENABLE_DITHERING)
+		if (m_bDithering) {
+			Refresh(Hardware::Get()->Micros());
+		}
+#endif
+		return;
+	}
+
+	const auto nMicros = Hardware::Get()->Micros();
+	int32_t nWeight;
+
+	if ((nMicros - m_Interpolation.nStartMicros) >= m_Interpolation.nIntervalMicros) {
+		nWeight = 256;
+		m_Interpolation.bActive = false;
+	} else {
+		/*
+		 * The step is relative to the remaining time, so the blend is linear
+		 * and ends exactly on the new frame, whatever the step timing.
+		 */
+		const auto nRemaining = m_Interpolation.nIntervalMicros - (m_Interpolation.nStepMicros - m_Interpolation.nStartMicros);
+		nWeight = static_cast<int32_t>(((nMicros - m_Interpolation.nStepMicros) << 8) / nRemaining);
+	}
+
+	m_Interpolation.nStepMicros = nMicros;
+
+	if (nWeight == 0) {
+		return;
+	}
+
+	const auto nProtocolPortIndexLast = PixelDmxConfiguration::Get().GetPortInfo().nProtocolPortIndexLast;
+
+	for (uint32_t nIndex = 0 ; nIndex <= nProtocolPortIndexLast; nIndex++) {
+		const auto *pTarget = s_Latch[nIndex];
+		auto *pOutput = s_Output[nIndex];
+
+		for (uint32_t i = 0; i < m_nLength[nIndex]; i++) {
+			const auto nDifference = static_cast<int32_t>(pTarget[i]) - static_cast<int32_t>(pOutput[i]);
+			pOutput[i] = static_cast<uint8_t>(pOutput[i] + ((nDifference * nWeight + 128) >> 8));
+		}
+	}
+
+	InterpolationOutput(nMicros);
+}
+
+/**
+ * The first output after InterpolationStart() carries the new frame,
+ * the blended frames after it are output as a refresh.
+ */
+void WS28xxDmxMulti::InterpolationOutput(const uint32_t nMicros) {
+	const auto nProtocolPortIndexLast = PixelDmxConfiguration::Get().GetPortInfo().nProtocolPortIndexLast;
+
+	for (uint32_t nIndex = 0 ; nIndex <= nProtocolPortIndexLast; nIndex++) {
+		SetData(nIndex, s_Output[nIndex], m_nLength[nIndex]);
+	}
+
+	if (m_Interpolation.bNewFrame) {
+		m_Interpolation.bNewFrame = false;
+		Output(m_Interpolation.nStartMicros);
+		return;
+	}
+
+	m_pWS28xxMulti->Update();
+	m_nOutputMicros = nMicros;
+
+	PixelStatistics::FrameRefreshed();
+}
+#endif
+
+/**
+ * The new frame is encoded. It is output now, or by Run() when the DMA transfer
+ * is still running or the maximum frame rate is reached.
+ */
+void WS28xxDmxMulti::Output(const uint32_t nMicrosReceived) {
+	if (m_bOutputPending) {
+		PixelStatistics::FrameDropped();
+	}
+
+	m_bOutputPending = true;
+	m_nOutputPendingMicros = nMicrosReceived;
+
+	if (m_pWS28xxMulti->IsUpdating()) {
+		PixelStatistics::FrameCoalesced();
+		return;
+	}
+
+	if (!IsOutputAllowed(Hardware::Get()->Micros())) {
+		PixelStatistics::FrameLimited();
+		return;
+	}
+
+	OutputPending();
+}
+
+void WS28xxDmxMulti::OutputPending() {
+	const auto nMicros = Hardware::Get()->Micros();
+
+	if (m_pWS28xxMulti->IsUpdating() || !IsOutputAllowed(nMicros)) {
+		return;
+	}
+
+	m_pWS28xxMulti->Update();
+
+	m_nOutputMicros = nMicros;
+	m_bOutputPending = false;
+
+	PixelStatistics::FrameOutput(nMicros - m_nOutputPendingMicros);
+}
+
 void WS28xxDmxMulti::Blackout(bool bBlackout) {
 	m_bBlackout = bBlackout;
+	m_bOutputPending = false;
 
 	while (m_pWS28xxMulti->IsUpdating()) {
 		// wait for completion
@@ -43,6 +43,9 @@
 #include "pixelconfiguration.h"
 
 #include "gamma/gamma_tables.h"
+#if defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
+# include "pixeldither.h"
+#endif
 
 #include "lightset.h"
 #include "lightsetparamsconst.h"
@@ -72,25 +75,41 @@ PixelDmxParams::PixelDmxParams() {
 	m_Params.nHighCode = 0;
 	m_Params.nGammaValue = 0;
 	m_Params.nTestPattern = 0;
+	m_Params.nMaxFps = 0;
+	m_Params.nWhiteBalance[0] = 0xFF;
+	m_Params.nWhiteBalance[1] = 0xFF;
+	m_Params.nWhiteBalance[2] = 0xFF;
 
 	for (uint32_t nPortIndex = 0; nPortIndex < pixeldmxparams::MAX_PORTS; nPortIndex++) {
 		m_Params.nStartUniverse[nPortIndex] = static_cast<uint16_t>(1 + (nPortIndex * 4));
 	}
+
+	m_PortParams.nSetList = 0;
+
+	for (uint32_t nPortIndex = 0; nPortIndex < pixeldmxparams::MAX_PORTS; nPortIndex++) {
+		m_PortParams.nCount[nPortIndex] = 0;
+		m_PortParams.nMap[nPortIndex] = static_cast<uint8_t>(Map::UNDEFINED);
+	}
 }
 
 void PixelDmxParams::Load() {
 	DEBUG_ENTRY
 
 	m_Params.nSetList = 0;
+	m_PortParams.nSetList = 0;
 
 #if !defined(DISABLE_FS)
 	ReadConfigFile configfile(PixelDmxParams::staticCallbackFunction, this);
 
 	if (configfile.Read(DevicesParamsConst::FILE_NAME)) {
 		PixelDmxParamsStore::Update(&m_Params);
+		PixelDmxParamsStore::Update(&m_PortParams);
 	} else
 #endif
+	{
 		PixelDmxParamsStore::Copy(&m_Params);
+		PixelDmxParamsStore::Copy(&m_PortParams);
+	}
 
 #ifndef NDEBUG
 	Dump();
@@ -105,12 +124,14 @@ void PixelDmxParams::Load(const char *pBuffer, uint32_t nLength) {
 	assert(nLength != 0);
 
 	m_Params.nSetList = 0;
+	m_PortParams.nSetList = 0;
 
 	ReadConfigFile config(PixelDmxParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
 	PixelDmxParamsStore::Update(&m_Params);
+	PixelDmxParamsStore::Update(&m_PortParams);
 
 #ifndef NDEBUG
 	Dump();
@@ -250,6 +271,36 @@ void PixelDmxParams::callbackFunction(const char *pLine) {
 		}
 	}
 
+#if defined(OUTPUT_DMX_PIXEL_MULTI)
+	for (uint32_t i = 0; i < pixeldmxparams::MAX_PORTS; i++) {
+		if (Sscan::Uint16(pLine, DevicesParamsConst::COUNT_PORT[i], nValue16) == Sscan::OK) {
+			if ((nValue16 != 0) && (nValue16 <= std::max(max::ledcount::RGB, max::ledcount::RGBW))) {
+				m_PortParams.nCount[i] = nValue16;
+				m_PortParams.nSetList |= (pixeldmxparams::PortMask::COUNT_PORT_1 << i);
+			} else {
+				m_PortParams.nCount[i] = 0;
+				m_PortParams.nSetList &= ~(pixeldmxparams::PortMask::COUNT_PORT_1 << i);
+			}
+			return;
+		}
+
+		nLength = 3;
+		if (Sscan::Char(pLine, DevicesParamsConst::MAP_PORT[i], cBuffer, nLength) == Sscan::OK) {
+			cBuffer[nLength] = '\0';
+			const auto map = pixel::pixel_get_map(cBuffer);
+
+			if (map != Map::UNDEFINED) {
+				m_PortParams.nSetList |= (pixeldmxparams::PortMask::MAP_PORT_1 << i);
+			} else {
+				m_PortParams.nSetList &= ~(pixeldmxparams::PortMask::MAP_PORT_1 << i);
+			}
+
+			m_PortParams.nMap[i] = static_cast<uint8_t>(map);
+			return;
+		}
+	}
+#endif
+
 #if defined(OUTPUT_DMX_PIXEL_MULTI)
 	if (Sscan::Uint8(pLine, DevicesParamsConst::ACTIVE_OUT, nValue8) == Sscan::OK) {
 		if ((nValue8 > 0) &&  (nValue8 <= pixeldmxparams::MAX_PORTS) &&  (nValue8 != pixel::defaults::OUTPUT_PORTS)) {
@@ -263,6 +314,17 @@ void PixelDmxParams::callbackFunction(const char *pLine) {
 	}
 #endif
 
+	if (Sscan::Uint8(pLine, DevicesParamsConst::MAX_FPS, nValue8) == Sscan::OK) {
+		m_Params.nMaxFps = nValue8;
+
+		if (nValue8 != 0) {
+			m_Params.nSetList |= pixeldmxparams::Mask::MAX_FPS;
+		} else {
+			m_Params.nSetList &= ~pixeldmxparams::Mask::MAX_FPS;
+		}
+		return;
+	}
+
 	if (Sscan::Uint8(pLine, DevicesParamsConst::TEST_PATTERN, nValue8) == Sscan::OK) {
 		if ((nValue8 != static_cast<uint8_t>(pixelpatterns::Pattern::NONE)) && (nValue8 < static_cast<uint8_t>(pixelpatterns::Pattern::LAST))) {
 			m_Params.nTestPattern = nValue8;
@@ -283,7 +345,43 @@ void PixelDmxParams::callbackFunction(const char *pLine) {
 		}
 		return;
 	}
+#endif
+
+#if defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
+	if (Sscan::Uint8(pLine, DevicesParamsConst::DITHERING, nValue8) == Sscan::OK) {
+		if (nValue8 != 0) {
+			m_Params.nSetList |= pixeldmxparams::Mask::DITHERING;
+		} else {
+			m_Params.nSetList &= ~pixeldmxparams::Mask::DITHERING;
+		}
+		return;
+	}
+
+	if (Sscan::Hex24Uint32(pLine, DevicesParamsConst::WHITE_BALANCE, nValue32) == Sscan::OK) {
+		if ((nValue32 & 0xFFFFFF) != pixel::dither::WHITE_BALANCE_DEFAULT) {
+			m_Params.nSetList |= pixeldmxparams::Mask::WHITE_BALANCE;
+		} else {
+			m_Params.nSetList &= ~pixeldmxparams::Mask::WHITE_BALANCE;
+		}
+		m_Params.nWhiteBalance[0] = static_cast<uint8_t>(nValue32 >> 16);
+		m_Params.nWhiteBalance[1] = static_cast<uint8_t>(nValue32 >> 8);
+		m_Params.nWhiteBalance[2] = static_cast<uint8_t>(nValue32);
+		return;
+	}
+#endif
 
+#if defined(CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	if (Sscan::Uint8(pLine, DevicesParamsConst::INTERPOLATION, nValue8) == Sscan::OK) {
+		if (nValue8 != 0) {
+			m_Params.nSetList |= pixeldmxparams::Mask::INTERPOLATION;
+		} else {
+			m_Params.nSetList &= ~pixeldmxparams::Mask::INTERPOLATION;
+		}
+		return;
+	}
+#endif
+
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE) || defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
 	if (Sscan::Float(pLine, DevicesParamsConst::GAMMA_VALUE, fValue) == Sscan::OK) {
 		const auto nValue = static_cast<uint8_t>(fValue * 10);
 		if ((nValue < gamma::MIN) || (nValue > gamma::MAX)) {
@@ -305,6 +403,8 @@ void PixelDmxParams::Builder(const struct pixeldmxparams::Params *ptWS28xxParams
 		PixelDmxParamsStore::Copy(&m_Params);
 	}
 
+	PixelDmxParamsStore::Copy(&m_PortParams);
+
 	PropertiesBuilder builder(DevicesParamsConst::FILE_NAME, pBuffer, nLength);
 
 	builder.Add(DevicesParamsConst::TYPE, pixel::pixel_get_type(static_cast<pixel::Type>(m_Params.nType)), isMaskSet(pixeldmxparams::Mask::TYPE));
@@ -312,7 +412,12 @@ void PixelDmxParams::Builder(const struct pixeldmxparams::Params *ptWS28xxParams
 
 #if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
 	builder.Add(DevicesParamsConst::GAMMA_CORRECTION, isMaskSet(pixeldmxparams::Mask::GAMMA_CORRECTION));
-
+#endif
+#if defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
+	builder.Add(DevicesParamsConst::DITHERING, isMaskSet(pixeldmxparams::Mask::DITHERING));
+	builder.AddHex24(DevicesParamsConst::WHITE_BALANCE, (static_cast<uint32_t>(m_Params.nWhiteBalance[0]) << 16) | (static_cast<uint32_t>(m_Params.nWhiteBalance[1]) << 8) | m_Params.nWhiteBalance[2], isMaskSet(pixeldmxparams::Mask::WHITE_BALANCE));
+#endif
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE) || defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
 	if (m_Params.nGammaValue == 0) {
 		builder.Add(DevicesParamsConst::GAMMA_VALUE, "<default>", false);
 	} else {
@@ -351,6 +456,9 @@ void PixelDmxParams::Builder(const struct pixeldmxparams::Params *ptWS28xxParams
 	builder.AddComment("Clock based chips");
 	builder.Add(DevicesParamsConst::SPI_SPEED_HZ, m_Params.nSpiSpeedHz, isMaskSet(pixeldmxparams::Mask::SPI_SPEED));
 
+	builder.AddComment("Output frame rate limit (0 = no limit)");
+	builder.Add(DevicesParamsConst::MAX_FPS, m_Params.nMaxFps, isMaskSet(pixeldmxparams::Mask::MAX_FPS));
+
 	builder.AddComment("APA102/SK9822");
 	builder.Add(DevicesParamsConst::GLOBAL_BRIGHTNESS, m_Params.nGlobalBrightness, isMaskSet(pixeldmxparams::Mask::GLOBAL_BRIGHTNESS));
 
@@ -364,6 +472,20 @@ void PixelDmxParams::Builder(const struct pixeldmxparams::Params *ptWS28xxParams
 	}
 #if defined(OUTPUT_DMX_PIXEL_MULTI)
 	builder.Add(DevicesParamsConst::ACTIVE_OUT, m_Params.nActiveOutputs, isMaskSet(pixeldmxparams::Mask::ACTIVE_OUT));
+
+	builder.AddComment("Output port (0 = led_count)");
+	for (uint32_t i = 0; i < pixeldmxparams::MAX_PORTS; i++) {
+		builder.Add(DevicesParamsConst::COUNT_PORT[i], GetCountPort(i), isPortMaskSet(pixeldmxparams::PortMask::COUNT_PORT_1 << i));
+	}
+
+	for (uint32_t i = 0; i < pixeldmxparams::MAX_PORTS; i++) {
+		const auto map = GetMapPort(i);
+		builder.Add(DevicesParamsConst::MAP_PORT[i], map == Map::UNDEFINED ? "<default>" : pixel::pixel_get_map(map), map != Map::UNDEFINED);
+	}
+#endif
+
+#if defined(CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	builder.Add(DevicesParamsConst::INTERPOLATION, isMaskSet(pixeldmxparams::Mask::INTERPOLATION));
 #endif
 
 	builder.AddComment("Test pattern");
@@ -406,6 +528,10 @@ void PixelDmxParams::Set() {
 		pixelConfiguration.SetGlobalBrightness(m_Params.nGlobalBrightness);
 	}
 
+	if (isMaskSet(pixeldmxparams::Mask::MAX_FPS)) {
+		pixelConfiguration.SetMaxFps(m_Params.nMaxFps);
+	}
+
 #if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
 	if (isMaskSet(pixeldmxparams::Mask::GAMMA_CORRECTION)) {
 		pixelConfiguration.SetEnableGammaCorrection(true);
@@ -415,6 +541,17 @@ void PixelDmxParams::Set() {
 	}
 #endif
 
+#if defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
+	if (isMaskSet(pixeldmxparams::Mask::DITHERING)) {
+		pixelConfiguration.SetEnableDithering(true);
+		pixelConfiguration.SetDitherGamma(m_Params.nGammaValue);
+	}
+
+	if (isMaskSet(pixeldmxparams::Mask::WHITE_BALANCE)) {
+		pixelConfiguration.SetWhiteBalance((static_cast<uint32_t>(m_Params.nWhiteBalance[0]) << 16) | (static_cast<uint32_t>(m_Params.nWhiteBalance[1]) << 8) | m_Params.nWhiteBalance[2]);
+	}
+#endif
+
 	// Dmx
 	auto& pixelDmxConfiguration = PixelDmxConfiguration::Get();
 
@@ -430,6 +567,15 @@ void PixelDmxParams::Set() {
 	if (isMaskSet(pixeldmxparams::Mask::ACTIVE_OUT)) {
 		pixelDmxConfiguration.SetOutputPorts(m_Params.nActiveOutputs);
 	}
+
+	for (uint32_t i = 0; i < pixeldmxparams::MAX_PORTS; i++) {
+		pixelDmxConfiguration.SetCountPort(i, GetCountPort(i));
+		pixelDmxConfiguration.SetMapPort(i, GetMapPort(i));
+	}
+#endif
+
+#if defined(CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	pixelDmxConfiguration.SetEnableInterpolation(isMaskSet(pixeldmxparams::Mask::INTERPOLATION));
 #endif
 }
 
@@ -453,13 +599,29 @@ void PixelDmxParams::Dump() {
 	}
 
 	printf(" %s=%d\n", DevicesParamsConst::ACTIVE_OUT, m_Params.nActiveOutputs);
+#if defined(OUTPUT_DMX_PIXEL_MULTI)
+	for (uint32_t i = 0; i < pixeldmxparams::MAX_PORTS; i++) {
+		if ((GetCountPort(i) != 0) || (GetMapPort(i) != Map::UNDEFINED)) {
+			printf(" %s=%d\n", DevicesParamsConst::COUNT_PORT[i], GetCountPort(i));
+			printf(" %s=%s\n", DevicesParamsConst::MAP_PORT[i], pixel::pixel_get_map(GetMapPort(i)));
+		}
+	}
+#endif
 	printf(" %s=%d\n", DevicesParamsConst::GROUPING_COUNT, m_Params.nGroupingCount);
 	printf(" %s=%u\n", DevicesParamsConst::SPI_SPEED_HZ, static_cast<unsigned int>(m_Params.nSpiSpeedHz));
 	printf(" %s=%d\n", DevicesParamsConst::GLOBAL_BRIGHTNESS, m_Params.nGlobalBrightness);
+	printf(" %s=%d\n", DevicesParamsConst::MAX_FPS, m_Params.nMaxFps);
 	printf(" %s=%d\n", LightSetParamsConst::DMX_START_ADDRESS, m_Params.nDmxStartAddress);
 	printf(" %s=%d\n", DevicesParamsConst::TEST_PATTERN, m_Params.nTestPattern);
 #if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
 	printf(" %s=%d\n", DevicesParamsConst::GAMMA_CORRECTION, isMaskSet(pixeldmxparams::Mask::GAMMA_CORRECTION));
 	printf(" %s=%1.1f [%u]\n", DevicesParamsConst::GAMMA_VALUE, static_cast<float>(m_Params.nGammaValue) / 10, m_Params.nGammaValue);
 #endif
+#if defined(CONFIG_PIXELDMX_ENABLE_DITHERING)
+	printf(" %s=%d\n", DevicesParamsConst::DITHERING, isMaskSet(pixeldmxparams::Mask::DITHERING));
+	printf(" %s=%.2X%.2X%.2X\n", DevicesParamsConst::WHITE_BALANCE, m_Params.nWhiteBalance[0], m_Params.nWhiteBalance[1], m_Params.nWhiteBalance[2]);
+#endif
+#if defined(CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	printf(" %s=%d\n", DevicesParamsConst::INTERPOLATION, isMaskSet(pixeldmxparams::Mask::INTERPOLATION));
+#endif
 }
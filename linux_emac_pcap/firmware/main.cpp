@@ -0,0 +1,162 @@
+/**
+ * @file main.cpp
+ *
+ */
+/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include <arpa/inet.h>
+
+#include "hardware.h"
+#include "network.h"
+
+#include "emac/emac.h"
+#include "emac/pcap.h"
+
+#include "debug.h"
+
+namespace net {
+void display_emac_config() {}
+void display_emac_start() {}
+void display_emac_status([[maybe_unused]] const bool isLinkUp) {}
+void display_emac_shutdown() {}
+void display_ip() {}
+void display_netmask() {}
+void display_gateway() {}
+void display_hostname() {}
+void display_dhcp_status([[maybe_unused]] net::dhcp::State state) {}
+}  // namespace net
+
+static constexpr uint16_t UDP_PORT = 6454;	///< Art-Net
+static constexpr uint32_t ACD_TIMEOUT_MILLIS = 10000;
+
+static void usage(const char *pName) {
+	fprintf(stderr, "Usage: %s [-r] [-i ip] [-m netmask] [-p port] replay.pcap [record.pcap]\n", pName);
+	fprintf(stderr, "  -r  replay at the captured timestamps, default is as fast as possible\n");
+}
+
+int main(int argc, char **argv) {
+	Hardware hw;
+
+	auto bRealTime = false;
+	net::ip4_addr_t ipaddr = { .addr = inet_addr("192.168.2.100") };
+	net::ip4_addr_t netmask = { .addr = inet_addr("255.255.255.0") };
+	uint16_t nPort = UDP_PORT;
+	int c;
+
+	while ((c = getopt(argc, argv, "ri:m:p:")) != -1) {
+		switch (c) {
+		case 'r':
+			bRealTime = true;
+			break;
+		case 'i':
+			ipaddr.addr = inet_addr(optarg);
+			break;
+		case 'm':
+			netmask.addr = inet_addr(optarg);
+			break;
+		case 'p':
+			nPort = static_cast<uint16_t>(atoi(optarg));
+			break;
+		default:
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if ((optind >= argc) || ((argc - optind) > 2)) {
+		usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	if (((argc - optind) == 2) && !emac::pcap::record_open(argv[optind + 1])) {
+		return EXIT_FAILURE;
+	}
+
+	net::Link link;
+
+	emac_config();
+	emac_start(net::globals::netif_default.hwaddr, link);
+
+	net::netif_init();
+
+	net::ip4_addr_t gw = { .addr = ipaddr.addr };
+	auto bUseDhcp = false;
+
+	net::net_init(link, ipaddr, netmask, gw, bUseDhcp);
+
+	/*
+	 * The address is set after the conflict detection probes are sent.
+	 * No frames are replayed before that.
+	 */
+	const auto nMillis = hw.Millis();
+
+	while (net::netif_ipaddr() == 0) {
+		if ((hw.Millis() - nMillis) > ACD_TIMEOUT_MILLIS) {
+			fprintf(stderr, "No IP address\n");
+			emac::pcap::close();
+			return EXIT_FAILURE;
+		}
+		net::net_handle();
+		hw.Run();
+		usleep(1000);
+	}
+
+	printf("IP " IPSTR ", UDP port %u\n", IP2STR(net::netif_ipaddr()), nPort);
+
+	if (!emac::pcap::replay_open(argv[optind], bRealTime)) {
+		emac::pcap::close();
+		return EXIT_FAILURE;
+	}
+
+	const auto nHandle = net::udp_begin(nPort);
+
+	uint32_t nUdpPackets = 0;
+	uint32_t nUdpBytes = 0;
+
+	while (!emac::pcap::replay_done()) {
+		net::net_handle();
+
+		const uint8_t *pBuffer;
+		uint32_t nFromIp;
+		uint16_t nFromPort;
+		uint32_t nBytes;
+
+		while ((nBytes = net::udp_recv2(nHandle, &pBuffer, &nFromIp, &nFromPort)) != 0) {
+			nUdpPackets++;
+			nUdpBytes += nBytes;
+		}
+
+		net::dhcp_run();
+		hw.Run();
+	}
+
+	emac::pcap::close();
+
+	printf("UDP port %u: %u packets, %u bytes\n", nPort, nUdpPackets, nUdpBytes);
+	emac::pcap::statistics_print();
+
+	return EXIT_SUCCESS;
+}